@@ -9,6 +9,28 @@
 #include "extern/ini-parser/ini-parser.h"
 
 #include <ctype.h>
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <inttypes.h>
+#include <sys/stat.h>
+
+#if !defined(_WIN32)
+    #include <unistd.h>
+    #include <errno.h>
+    #include <fcntl.h>
+    #include <poll.h>
+    #include <signal.h>
+    #include <strings.h>
+    #include <time.h>
+    #include <arpa/inet.h>
+    #include <netinet/in.h>
+    #include <sys/socket.h>
+
+    #if !defined(MSG_NOSIGNAL)
+        #define MSG_NOSIGNAL 0
+    #endif
+#endif
 
 typedef FlagshipStreamFn StreamFn;
 
@@ -25,6 +47,9 @@ enum Error {
     E_NO_RUN_SUPPORT,  // int os_current, enum Target target
     E_FILE_MOVE,       // const char *dst, const char *src
     E_UNIMPLEMENTED,   // const char *msg
+    E_RUN_TARGETS,     // int count
+    E_CONFIG,          // const char *section, const char *field, const char *msg
+    E_SERVER,          // const char *call, int errno
 
     E_COUNT
 };
@@ -58,6 +83,10 @@ enum Target {
     T_COUNT,
     T_BEGIN   = T_NATIVE,
     T_DEFAULT = T_NATIVE,
+
+    // NOTE(alicia): only valid as a flag value, expands to every
+    // target that can be built from the current os.
+    T_ALL = T_COUNT,
 };
 const char *TARGET_NAMES[] = {
     "native",
@@ -82,17 +111,126 @@ static_assert(
 
 enum EnableOpt {
     ENABLE_WAYLAND,
+    ENABLE_SIZE,
+    ENABLE_WASM_THREADS,
+    ENABLE_WASM_SIMD,
+    ENABLE_HOT_RELOAD,
 
     ENABLE_OPT_COUNT,
     ENABLE_OPT_BEGIN = ENABLE_WAYLAND
 };
 const char *ENABLE_OPT_NAMES[] = {
-    "wayland"
+    "wayland",
+    "size",
+    "wasm-threads",
+    "wasm-simd",
+    "hot-reload"
 };
 static_assert(
     CB_ARRAY_LEN(ENABLE_OPT_NAMES) == ENABLE_OPT_COUNT,
     "number of enable options does not match number of enable option names!");
 
+enum RaylibModule {
+    RAYLIB_MODULE_RSHAPES,
+    RAYLIB_MODULE_RTEXTURES,
+    RAYLIB_MODULE_RTEXT,
+    RAYLIB_MODULE_RMODELS,
+    RAYLIB_MODULE_RAUDIO,
+
+    RAYLIB_MODULE_COUNT,
+    RAYLIB_MODULE_BEGIN = RAYLIB_MODULE_RSHAPES
+};
+const char *RAYLIB_MODULE_NAMES[] = {
+    "rshapes",
+    "rtextures",
+    "rtext",
+    "rmodels",
+    "raudio",
+};
+static_assert(
+    CB_ARRAY_LEN(RAYLIB_MODULE_NAMES) == RAYLIB_MODULE_COUNT,
+    "number of raylib modules does not match number of raylib module names!");
+const char *RAYLIB_MODULE_MACROS[] = {
+    "SUPPORT_MODULE_RSHAPES",
+    "SUPPORT_MODULE_RTEXTURES",
+    "SUPPORT_MODULE_RTEXT",
+    "SUPPORT_MODULE_RMODELS",
+    "SUPPORT_MODULE_RAUDIO",
+};
+static_assert(
+    CB_ARRAY_LEN(RAYLIB_MODULE_MACROS) == RAYLIB_MODULE_COUNT,
+    "number of raylib modules does not match number of raylib module macros!");
+
+// NOTE(alicia): mirrors extern/raylib/src/config.h,
+// must be kept in sync when raylib is updated.
+struct RaylibFeature {
+    const char *macro;
+    bool        enabled;
+} RAYLIB_FEATURES[] = {
+    // rcore
+    { "SUPPORT_CAMERA_SYSTEM",         true  },
+    { "SUPPORT_GESTURES_SYSTEM",       true  },
+    { "SUPPORT_RPRAND_GENERATOR",      true  },
+    { "SUPPORT_MOUSE_GESTURES",        true  },
+    { "SUPPORT_SSH_KEYBOARD_RPI",      true  },
+    { "SUPPORT_WINMM_HIGHRES_TIMER",   true  },
+    { "SUPPORT_PARTIALBUSY_WAIT_LOOP", true  },
+    { "SUPPORT_BUSY_WAIT_LOOP",        false },
+    { "SUPPORT_CUSTOM_FRAME_CONTROL",  false },
+    { "SUPPORT_SCREEN_CAPTURE",        true  },
+    { "SUPPORT_GIF_RECORDING",         true  },
+    { "SUPPORT_COMPRESSION_API",       true  },
+    { "SUPPORT_AUTOMATION_EVENTS",     true  },
+    { "SUPPORT_CLIPBOARD_IMAGE",       true  },
+    // rshapes
+    { "SUPPORT_QUADS_DRAW_MODE",       true  },
+    // rtextures
+    { "SUPPORT_FILEFORMAT_PNG",        true  },
+    { "SUPPORT_FILEFORMAT_BMP",        false },
+    { "SUPPORT_FILEFORMAT_TGA",        false },
+    { "SUPPORT_FILEFORMAT_JPG",        false },
+    { "SUPPORT_FILEFORMAT_GIF",        true  },
+    { "SUPPORT_FILEFORMAT_QOI",        true  },
+    { "SUPPORT_FILEFORMAT_PSD",        false },
+    { "SUPPORT_FILEFORMAT_DDS",        true  },
+    { "SUPPORT_FILEFORMAT_HDR",        false },
+    { "SUPPORT_FILEFORMAT_PIC",        false },
+    { "SUPPORT_FILEFORMAT_KTX",        false },
+    { "SUPPORT_FILEFORMAT_ASTC",       false },
+    { "SUPPORT_FILEFORMAT_PKM",        false },
+    { "SUPPORT_FILEFORMAT_PVR",        false },
+    { "SUPPORT_FILEFORMAT_SVG",        false },
+    { "SUPPORT_IMAGE_EXPORT",          true  },
+    { "SUPPORT_IMAGE_GENERATION",      true  },
+    { "SUPPORT_IMAGE_MANIPULATION",    true  },
+    // rtext
+    { "SUPPORT_DEFAULT_FONT",          true  },
+    { "SUPPORT_FILEFORMAT_TTF",        true  },
+    { "SUPPORT_FILEFORMAT_FNT",        true  },
+    { "SUPPORT_FILEFORMAT_BDF",        false },
+    { "SUPPORT_TEXT_MANIPULATION",     true  },
+    { "SUPPORT_FONT_ATLAS_WHITE_REC",  true  },
+    // rmodels
+    { "SUPPORT_FILEFORMAT_OBJ",        true  },
+    { "SUPPORT_FILEFORMAT_MTL",        true  },
+    { "SUPPORT_FILEFORMAT_IQM",        true  },
+    { "SUPPORT_FILEFORMAT_GLTF",       true  },
+    { "SUPPORT_FILEFORMAT_VOX",        true  },
+    { "SUPPORT_FILEFORMAT_M3D",        true  },
+    { "SUPPORT_MESH_GENERATION",       true  },
+    // raudio
+    { "SUPPORT_FILEFORMAT_WAV",        true  },
+    { "SUPPORT_FILEFORMAT_OGG",        true  },
+    { "SUPPORT_FILEFORMAT_MP3",        true  },
+    { "SUPPORT_FILEFORMAT_QOA",        true  },
+    { "SUPPORT_FILEFORMAT_FLAC",       false },
+    { "SUPPORT_FILEFORMAT_XM",         true  },
+    { "SUPPORT_FILEFORMAT_MOD",        true  },
+    // utils
+    { "SUPPORT_STANDARD_FILEIO",       true  },
+    { "SUPPORT_TRACELOG",              true  },
+};
+
 enum RebuildTarget {
     REBUILD_ALL,
     REBUILD_RAYLIB,
@@ -136,14 +274,17 @@ struct Option {
         } help;
         struct OptionBuild {
             enum Target target;
+            uint16_t targets;
             bool strip_symbols  : 1;
             bool optimized      : 1;
-            uint16_t enable     : (sizeof(uint16_t) * 8) - 2;
+            bool package        : 1;
+            uint16_t enable     : (sizeof(uint16_t) * 8) - 3;
             uint16_t rebuild    : sizeof(uint16_t) * 8;
         } build;
         struct OptionRun {
             struct OptionBuild build;
             CmdLine passthrough;
+            bool headless;
         } run;
         struct OptionPkg {
             struct OptionBuild build;
@@ -166,20 +307,150 @@ StringBuf STR, TMP;
 CmdBuf    CMD;
 ProcessGroup PG;
 
+// running jobs, one group each so a finished job frees its slot
+// while the others keep running. a slot is free when its group is empty.
+struct JobSlot {
+    ProcessGroup group;
+    size_t       label; // offset into TMP
+};
+struct JobSlots {
+    size_t cap;
+    size_t len;
+    struct JobSlot *ptr;
+} JOBS;
+
+size_t JOB_LIMIT = 0;
+
+// how long to wait on one job before checking the next
+#define JOB_POLL_MS 1
+
+// commands that must run in order, one chain per target
+struct ChainCmd {
+    size_t args;  // offset into CHAIN_ARGS
+    size_t argc;
+    size_t wd;    // offset into CHAIN_TEXT, 0 for current directory
+    size_t label; // offset into CHAIN_TEXT
+};
+struct Chain {
+    size_t cap;
+    size_t len;
+    struct ChainCmd *ptr;
+};
+struct ChainArgs {
+    size_t cap;
+    size_t len;
+    size_t *ptr;
+} CHAIN_ARGS;
+StringBuf CHAIN_TEXT;
+struct Chain CHAINS[T_COUNT];
+// command running for each chain
+ProcessGroup CHAIN_PG[T_COUNT];
+
 size_t PROJECT_DISPLAY_NAME = 0;
 size_t PROGRAM_NAME         = 0;
 size_t VERSION              = 0;
 size_t DEVELOPER            = 0;
-size_t BUILD_DIR            = 0;
-size_t BUILD_OBJ_DIR        = 0;
+size_t BUILD_DIR[T_COUNT]     = {0};
+size_t BUILD_OBJ_DIR[T_COUNT] = {0};
 
 size_t MINGW_C   = 0;
 size_t MINGW_CPP = 0;
 size_t MINGW_AR  = 0;
+size_t MINGW_OBJCOPY = 0;
+
+size_t FILE_PACKAGER = 0;
+
+bool SOURCES_GENERATED = false;
+
+bool RAYLIB_MODULES[RAYLIB_MODULE_COUNT] = { true, true, true, true, true };
+bool RAYLIB_CONFIG_LOADED = false;
+// NUL separated -D flags for raylib, empty when using raylib's config.h
+StringBuf RAYLIB_CONFIG;
+size_t    RAYLIB_CONFIG_COUNT = 0;
 
 bool RESOURCES_CHECKED = false;
 bool RESOURCES_EXISTS  = false;
 
+#define RESOURCES_MANIFEST_PATH "build/resources.manifest"
+// widest mtime tick of common file systems (FAT), in nanoseconds
+#define RESOURCES_MTIME_SLACK (2ll * 1000000000ll)
+
+struct ManifestEntry {
+    size_t   path;  // offset into Manifest::text
+    uint64_t size;
+    int64_t  mtime; // nanoseconds
+    uint64_t hash;
+};
+struct Manifest {
+    size_t cap;
+    size_t len;
+    struct ManifestEntry *ptr;
+
+    StringBuf text;
+};
+
+enum ManifestChange {
+    MC_ADDED,
+    MC_MODIFIED,
+    MC_REMOVED,
+};
+
+typedef void ManifestDiffFN(
+    const char *path, enum ManifestChange change, void *params);
+
+// NOTE(alicia): manifest of every file in resources/,
+// updated once per invocation by check_resources.
+struct Manifest MANIFEST;
+
+// compile command hashes of raylib objects, per target
+struct Manifest RAYLIB_STAMPS[T_COUNT];
+
+struct PkgFilesParams {
+    size_t *keep; // offsets into STR
+    size_t  keep_count;
+    // files not in keep, offsets into STR
+    struct { size_t cap; size_t len; size_t *ptr; } found;
+};
+
+// NOTE(alicia): lazily loaded wasm resources, one group per directory in resources/.
+// index 0 is the boot package: files directly in resources/ and wasm-boot-groups.
+struct AssetGroup {
+    size_t   name;   // offset into STR
+    size_t   marker; // offset into STR, a file in the group
+    uint64_t size;
+    size_t   files;
+    bool     boot;
+    bool     dirty;
+};
+struct AssetGroups {
+    size_t cap;
+    size_t len;
+    struct AssetGroup *ptr;
+};
+struct AssetGroups ASSET_GROUPS;
+
+struct SizeEntry {
+    size_t   name; // offset into SizeReport::text
+    uint64_t size;
+};
+struct SizeList {
+    size_t cap;
+    size_t len;
+    struct SizeEntry *ptr;
+};
+struct SizeReport {
+    uint64_t total;
+
+    struct SizeList sections;
+    struct SizeList objects;
+    struct SizeList symbols;
+
+    StringBuf text;
+};
+
+// NOTE(alicia): number of symbols kept in size.json
+#define SIZE_REPORT_SYMBOLS 64
+
 int error(int ec, ...);
 
 size_t file_stream(void *target, size_t n, const void *bytes);
@@ -197,6 +468,7 @@ int __makedir(const char *first, ...);
 
 int mode_build(struct OptionBuild *opt);
 int mode_run(struct OptionRun *opt);
+int http_serve(const char *root, bool headless);
 int mode_pkg(struct OptionPkg *opt);
 
 const char *project_display_name(void);
@@ -204,17 +476,79 @@ const char *program_name(enum Target target);
 const char *version(void);
 const char *developer(void);
 size_t total_memory(void);
+size_t max_memory(void);
+bool wasm_lazy_assets(void);
 const char *memory_fmt(size_t bytes);
 
 bool check_resources(void);
 
+bool manifest_load(const char *path, struct Manifest *m);
+bool manifest_write(const char *path, struct Manifest *m);
+bool manifest_add_file(struct Manifest *m, const char *name, const char *path);
+struct ManifestEntry *manifest_find(struct Manifest *m, const char *name);
+void manifest_sort(struct Manifest *m);
+void manifest_copy(struct Manifest *dst, struct Manifest *src);
+size_t manifest_diff(
+    struct Manifest *cur, struct Manifest *prev, ManifestDiffFN *fn, void *params);
+void manifest_free(struct Manifest *m);
+const char *manifest_path(struct Manifest *m, struct ManifestEntry *entry);
+
+void manifest_push(struct Manifest *m, const char *name, uint64_t hash);
+
+bool file_hash(const char *path, uint64_t *out_hash);
+uint64_t cmd_hash(CmdBuf *cmd);
+
+void size_push(struct SizeReport *r, struct SizeList *list, const char *name, size_t name_len, uint64_t size);
+uint64_t size_find(struct SizeReport *r, struct SizeList *list, const char *name, bool *out_found);
+bool size_parse(const char *path, struct SizeReport *r, bool object);
+bool size_load(const char *path, struct SizeReport *r);
+bool size_write(const char *path, const char *binary, struct SizeReport *r);
+void size_sort(struct SizeReport *r);
+void size_free(struct SizeReport *r);
+const char *size_delta_fmt(uint64_t cur, uint64_t prev);
+void size_print_changes(
+    const char *kind, struct SizeReport *cur, struct SizeList *cur_list,
+    struct SizeReport *prev, struct SizeList *prev_list);
+
+bool file_read_all(const char *path, uint8_t **out_data, size_t *out_len);
+int64_t stat_mtime_ns(const struct stat *st);
+bool path_older(const char *path, const char *than);
+uint8_t *file_read_at(FILE *f, uint64_t offset, size_t size);
+bool exe_has_debuglink(const char *path);
+const char *json_escape(const char *text);
+
+int raylib_config(void);
+void raylib_config_append(CmdBuf *cmd);
+
+bool ini_read_bool(const char *field);
+
+int job_exec(const char *wd, const char *label);
+int job_join(void);
+size_t job_limit(void);
+
+void chain_push(enum Target target, const char *wd, const char *label);
+int chain_run(bool failed[T_COUNT]);
+
+size_t str_push(const char *text);
+const char *relative_root(const char *dir);
+size_t cpu_count(void);
+
+void collect_target_flags(struct Option *opt);
 void collect_enable_flags(struct Option *opt);
 void collect_rebuild_flags(struct Option *opt);
 
 enum RebuildOpt read_rebuild(struct OptionBuild *opt, enum RebuildTarget target);
 bool read_enable(struct OptionBuild *opt, enum EnableOpt e);
 
+bool build_strips(struct OptionBuild *opt);
+const char *linker_flag(enum Target target);
+const char *optimization_flag(struct OptionBuild *opt);
+void wasm_features_append(struct OptionBuild *opt, CmdBuf *cmd);
+int wasm_shell(struct OptionBuild *opt, const char **out_shell);
+const char *objcopy(enum Target target);
+
 enum Target target_normalize(enum Target target);
+bool target_selected(struct OptionBuild *opt, enum Target target);
 const char *target_name(enum Target target);
 
 const char *compiler_c(enum Target target);
@@ -226,6 +560,14 @@ const char *build_obj_dir(enum Target target);
 
 const char *program_ext(enum Target target);
 
+const char *python(void);
+const char *file_packager(void);
+
+const char *package_compression(void);
+int package_compression_level(int fallback);
+bool package_is_stored(const char *path);
+const char *zip_tool(void);
+
 int main(int argc, char **argv) {
     CB_BUILD_INIT();
 
@@ -274,9 +616,7 @@ int main(int argc, char **argv) {
         case M_RUN:
         case M_PKG:
         case M_BUILD: {
-            if(flagship_search(fls, MODE_NAMES[opt.mode], "target", &flag_result)) {
-                opt.build.target = flag_result.t_enum;
-            }
+            collect_target_flags(&opt);
             if(flagship_search(fls, MODE_NAMES[opt.mode], "optimzed", &flag_result)) {
                 opt.build.optimized = true;
             }
@@ -286,10 +626,11 @@ int main(int argc, char **argv) {
             collect_enable_flags(&opt);
             collect_rebuild_flags(&opt);
 
-            opt.build.target = target_normalize(opt.build.target);
-
             switch(opt.mode) {
                 case M_RUN: {
+                    if(flagship_search(fls, MODE_NAMES[opt.mode], "headless", &flag_result)) {
+                        opt.run.headless = true;
+                    }
                     if(flagship_search(fls, MODE_NAMES[opt.mode], "-", &flag_result)) {
                         int end = flagship_end_position(fls);
                         end++;
@@ -299,12 +640,11 @@ int main(int argc, char **argv) {
                     }
                 } break;
                 case M_PKG: {
-                    // NOTE(alicia): setting default build options
-                    opt.build.optimized     = true;
-                    opt.build.strip_symbols = true;
-                    for(enum RebuildTarget rt = REBUILD_BEGIN + 1; rt < REBUILD_COUNT; ++rt) {
-                        opt.build.rebuild |= (REBUILD_OPT_FORCE << ((uint16_t)(rt - 1) * 2));
-                    }
+                    // NOTE(alicia): setting default build options.
+                    // symbols are kept and stripped from a copy when packaging,
+                    // so a debug build with the same options isn't rebuilt.
+                    opt.build.optimized = true;
+                    opt.build.package   = true;
 
                     // TODO(alicia): additional package flags
                 } break;
@@ -344,40 +684,61 @@ int main(int argc, char **argv) {
     return ec;
 }
 
-int mode_build_raylib(struct OptionBuild *opt) {
+void raylib_sources(enum Target target, CStringBuf *sources) {
+    sources->len = 0;
+
+    CB_BUF_PUSH(sources, "rcore");
+    for(enum RaylibModule m = RAYLIB_MODULE_BEGIN; m < RAYLIB_MODULE_COUNT; ++m) {
+        if(RAYLIB_MODULES[m]) {
+            CB_BUF_PUSH(sources, RAYLIB_MODULE_NAMES[m]);
+        }
+    }
+
+    switch(target) {
+        case T_WINDOWS:
+        case T_LINUX:
+        case T_MACOS:
+            CB_BUF_PUSH(sources, "rglfw");
+            break;
+        case T_WASM:
+            break;
+
+        case T_NATIVE:
+        case T_COUNT:
+            break;
+    }
+}
+
+// queue raylib objects into job group.
+// out_archive is set if libraylib.a must be archived once jobs finish.
+int mode_build_raylib(struct OptionBuild *opt, bool *out_archive) {
     int ec = E_NONE;
+    *out_archive = false;
 
     enum RebuildOpt rebuild = read_rebuild(opt, REBUILD_RAYLIB);
 
-    FileType ft = path_query_file_type(local_fmt("%s/libraylib.a", build_obj_dir(opt->target)));
-    switch(ft) {
+    FileType lib_ft =
+        path_query_file_type(local_fmt("%s/libraylib.a", build_obj_dir(opt->target)));
+    switch(lib_ft) {
         case FT_NULL:
         case FT_FILE:
             break;
         case FT_DIR:
         case FT_PIPE:
             return error(E_WRONG_FILE_TYPE, local_fmt("%s/libraylib.a",
-                build_obj_dir(opt->target)), FT_FILE, ft);
+                build_obj_dir(opt->target)), FT_FILE, lib_ft);
     }
 
     switch(rebuild) {
-        case REBUILD_OPT_AUTO: switch(ft) {
-            case FT_NULL:
-                break;
-            case FT_FILE:
-                return ec;
-
-            // NOTE(alicia): unreachable
-            case FT_DIR:
-            case FT_PIPE:
-                break;
-        } break;
+        case REBUILD_OPT_AUTO:
+            // NOTE(alicia): objects are checked against their last compile command below
+            break;
         case REBUILD_OPT_FORCE:
             // we rebuild anyway
             break;
         case REBUILD_OPT_SKIP:
             // only rebuild if it doesn't exist, required dependency
-            if(ft != FT_NULL) {
+            if(lib_ft != FT_NULL) {
                 return ec;
             }
             break;
@@ -385,41 +746,32 @@ int mode_build_raylib(struct OptionBuild *opt) {
             break;
     }
 
-    // TODO(alicia): check for forced rebuild
-
-    CB_INFO("building libraylib.a for %s . . .", target_name(opt->target));
+    if((ec = raylib_config())) {
+        return ec;
+    }
 
     // check for programs
     if((ec = proc_check(compiler_c(opt->target), archiver(opt->target)))) {
         return ec;
     }
 
-    // reset proc group
-    proc_group_clean(&PG);
-
     CStringBuf sources;
     memset(&sources, 0, sizeof(sources));
 
-    CB_BUF_PUSH(&sources, "rcore");
-    CB_BUF_PUSH(&sources, "rshapes");
-    CB_BUF_PUSH(&sources, "rtextures");
-    CB_BUF_PUSH(&sources, "rtext");
-    CB_BUF_PUSH(&sources, "rmodels");
-    CB_BUF_PUSH(&sources, "raudio");
+    raylib_sources(opt->target, &sources);
 
-    switch(opt->target) {
-        case T_WINDOWS:
-        case T_LINUX:
-        case T_MACOS:
-            CB_BUF_PUSH(&sources, "rglfw");
-            break;
-        case T_WASM:
-            break;
+    // NOTE(alicia): hash of the command each object was last compiled with,
+    // objects are rebuilt when build options or [raylib] config change.
+    struct Manifest prev;
+    memset(&prev, 0, sizeof(prev));
+    manifest_load(local_fmt("%s/raylib.manifest", build_obj_dir(opt->target)), &prev);
 
-        case T_NATIVE:
-        case T_COUNT:
-            break;
-    }
+    struct Manifest *cur = RAYLIB_STAMPS + opt->target;
+    cur->len      = 0;
+    cur->text.len = 0;
+
+    FileType ft;
+    size_t compiled = 0;
 
     Cmd other_args = CB_CMD("");
     switch(opt->target) {
@@ -476,18 +828,13 @@ int mode_build_raylib(struct OptionBuild *opt) {
             local_fmt("%s/%s.o", build_obj_dir(opt->target), name))
         )) {
             case FT_NULL:
-                break;
             case FT_FILE:
-                if(rebuild == REBUILD_OPT_FORCE) {
-                    break;
-                } else {
-                    continue;
-                }
+                break;
             case FT_DIR:
             case FT_PIPE:
-                CB_BUF_FREE(&sources);
-                return error(E_WRONG_FILE_TYPE, local_fmt("%s/%s.o",
+                ec = error(E_WRONG_FILE_TYPE, local_fmt("%s/%s.o",
                     build_obj_dir(opt->target), name), FT_FILE, ft);
+                goto cleanup;
         }
 
         cmd_reset(&CMD);
@@ -504,7 +851,9 @@ int mode_build_raylib(struct OptionBuild *opt) {
             case T_WINDOWS:
             case T_MACOS:
             case T_COUNT:
-                if(opt->optimized) {
+                if(read_enable(opt, ENABLE_SIZE)) {
+                    cmd_add(&CMD, "-Os");
+                } else if(opt->optimized) {
                     cmd_add(&CMD, "-O1");
                 } else {
                     cmd_add(&CMD, "-O0");
@@ -512,7 +861,13 @@ int mode_build_raylib(struct OptionBuild *opt) {
                 break;
         }
 
-        if(!opt->strip_symbols) {
+        // NOTE(alicia): lets the linker drop unused raylib functions
+        if(read_enable(opt, ENABLE_SIZE)) {
+            CB_CMD_APPEND(&CMD, "-ffunction-sections", "-fdata-sections");
+        }
+        wasm_features_append(opt, &CMD);
+
+        if(!build_strips(opt) && !opt->package) {
             cmd_add(&CMD, "-D_DEBUG");
         }
         switch(opt->target) {
@@ -523,7 +878,7 @@ int mode_build_raylib(struct OptionBuild *opt) {
             case T_WINDOWS:
             case T_MACOS:
             case T_COUNT:
-                if(!opt->strip_symbols) {
+                if(!build_strips(opt)) {
                     cmd_add(&CMD, "-g");
                 }
                 break;
@@ -535,34 +890,48 @@ int mode_build_raylib(struct OptionBuild *opt) {
         }
 
         cmd_copy(&CMD, other_args);
+        raylib_config_append(&CMD);
 
-        if(CB_EXEC(CMD.cmd, .group=&PG)) {
-            ec = error(E_EXEC_ASYNC, local_fmt("%s %s", compiler_c(opt->target), name));
+        uint64_t hash = cmd_hash(&CMD);
+        manifest_push(cur, name, hash);
+
+        struct ManifestEntry *old = manifest_find(&prev, name);
+        if(ft == FT_FILE && rebuild != REBUILD_OPT_FORCE && old && old->hash == hash) {
+            continue;
+        }
+
+        if(!compiled) {
+            CB_INFO("building libraylib.a for %s . . .", target_name(opt->target));
+        }
+        compiled++;
+
+        if((ec = job_exec(NULL, local_fmt("%s %s", compiler_c(opt->target), name)))) {
             break;
         }
     }
 
-    if(ec) {
-        goto cleanup;
-    }
+    manifest_sort(cur);
 
-    proc_group_join(&PG, CB_WAIT_INF);
+    // NOTE(alicia): modules could have been removed without compiling anything
+    *out_archive = (ec == E_NONE) &&
+        (compiled || lib_ft == FT_NULL || manifest_diff(cur, &prev, NULL, NULL));
+
+cleanup:
+    manifest_free(&prev);
+    CB_BUF_FREE(&sources);
+    return ec;
+}
 
-    for(size_t i = 0; i < PG.len; ++i) {
-        ProcessData *proc = PG.ptr + i;
+// queue archiving objects into libraylib.a, objects must be finished
+int mode_build_raylib_archive(struct OptionBuild *opt) {
+    CStringBuf sources;
+    memset(&sources, 0, sizeof(sources));
 
-        if(proc->exit_code) {
-            ec = error(E_PROC_FAIL,
-                local_fmt("%s %s", compiler_c(opt->target), sources.ptr[i]),
-                proc->exit_code);
-        }
-    }
+    raylib_sources(opt->target, &sources);
 
-    if(ec) {
-        goto cleanup;
-    }
+    // NOTE(alicia): rcs keeps objects of modules that were disabled since
+    remove(local_fmt("%s/libraylib.a", build_obj_dir(opt->target)));
 
-    // archive into libraylib.a
     cmd_reset(&CMD);
 
     CB_CMD_APPEND(&CMD, archiver(opt->target), "rcs",
@@ -572,14 +941,9 @@ int mode_build_raylib(struct OptionBuild *opt) {
         cmd_add(&CMD, local_fmt("%s/%s.o", build_obj_dir(opt->target), sources.ptr[i]));
     }
 
-    int exit_code = 0;
-    if((exit_code = CB_EXEC(CMD.cmd))) {
-        ec = error(E_PROC_FAIL, local_fmt("%s libraylib.a", archiver(opt->target)), exit_code);
-    }
-
-cleanup:
     CB_BUF_FREE(&sources);
-    return ec;
+
+    return job_exec(NULL, local_fmt("%s libraylib.a", archiver(opt->target)));
 }
 
 struct GenerateSourcesParams {
@@ -610,6 +974,11 @@ int mode_build_sources_file(struct OptionBuild *opt) {
 
     const char *path = "src/sources.cpp";
 
+    // NOTE(alicia): sources are the same for every target
+    if(SOURCES_GENERATED) {
+        return ec;
+    }
+
     FileType ft;
     switch(read_rebuild(opt, REBUILD_PROJECT)) {
         case REBUILD_OPT_AUTO:
@@ -674,139 +1043,730 @@ int mode_build_sources_file(struct OptionBuild *opt) {
     dir_walk("src", generate_sources_walk, &params);
 
     CB_INFO("sources generated at %s", path);
+    SOURCES_GENERATED = true;
     file_close(&f);
     return ec;
 }
 
-int mode_build_project(struct OptionBuild *opt) {
-    int ec = E_NONE;
+size_t buf_stream(void *target, size_t n, const void *bytes) {
+    ByteBuf *buf = (ByteBuf *)target;
+    CB_BUF_APPEND(buf, bytes, n);
+    return n;
+}
+// runtime settings in config.ini [project]
+struct RuntimeSettings {
+    int    width;
+    int    height;
+    int    framerate;
+    size_t budget;
+    int    tasks;
+};
+struct RuntimeSettings settings_read(void) {
+    struct RuntimeSettings result;
+    ini_parser_begin_section(&INI, "project");
+    result.width     = ini_parser_read_integer(&INI, "window-width");
+    result.height    = ini_parser_read_integer(&INI, "window-height");
+    result.framerate = ini_parser_read_integer(&INI, "framerate");
+    result.budget    = ini_parser_read_integer(&INI, "asset-budget");
+    result.tasks     = ini_parser_read_integer(&INI, "task-budget");
+    ini_parser_end_section(&INI);
+    return result;
+}
+// write runtime settings from config.ini to path, only touches path if they changed.
+// NOTE(alicia): fields must match LoadSettings in src/settings.cpp
+bool settings_write(const char *path) {
+    struct RuntimeSettings rs = settings_read();
+
+    struct IniParserContext settings;
+    memset(&settings, 0, sizeof(settings));
+    ini_parser_begin(&settings);
+
+    ini_parser_begin_section(&settings, "window"); {
+        ini_parser_comment(&settings,
+            "generated from config.ini on every build\n"
+            "players can override any field in their own settings.ini, see include/settings.h");
+
+        ini_parser_begin_field(&settings, "width"); {
+            ini_parser_comment(&settings, "minimum: 100");
+            ini_parser_value(&settings, "%d", rs.width);
+            ini_parser_end_field(&settings);
+        }
+        ini_parser_begin_field(&settings, "height"); {
+            ini_parser_comment(&settings, "minimum: 100");
+            ini_parser_value(&settings, "%d", rs.height);
+            ini_parser_end_field(&settings);
+        }
+        ini_parser_begin_field(&settings, "framerate"); {
+            ini_parser_comment(&settings, "minimum: 20");
+            ini_parser_value(&settings, "%d", rs.framerate);
+            ini_parser_end_field(&settings);
+        }
 
-    FileType ft;
-    switch(read_rebuild(opt, REBUILD_PROJECT)) {
-        case REBUILD_OPT_AUTO:
-        case REBUILD_OPT_FORCE:
-            break;
-        case REBUILD_OPT_SKIP: {
-            // check if project exists. if it does, exit
-            const char *path = local_fmt("%s/%s%s",
-                build_dir(opt->target), program_name(opt->target), program_ext(opt->target));
+        ini_parser_end_section(&settings);
+    }
 
-            switch((ft = path_query_file_type(path))) {
-                case FT_NULL:
-                    break;
-                case FT_FILE:
-                    return ec;
-                case FT_DIR:
-                case FT_PIPE:
-                    return error(E_WRONG_FILE_TYPE, path, FT_FILE, ft);
-            }
-        } break;
-        case REBUILD_OPT_COUNT:
-            break;
+    ini_parser_begin_section(&settings, "assets"); {
+        ini_parser_begin_field(&settings, "budget"); {
+            ini_parser_comment(&settings, "resident asset memory in bytes, 0 disables eviction");
+            ini_parser_value(&settings, "%zu", rs.budget);
+            ini_parser_end_field(&settings);
+        }
+
+        ini_parser_end_section(&settings);
     }
 
-    CB_INFO("compiling %s for %s . . .", project_display_name(), target_name(opt->target));
+    ini_parser_begin_section(&settings, "tasks"); {
+        ini_parser_begin_field(&settings, "budget"); {
+            ini_parser_comment(&settings, "milliseconds per frame for long running tasks, 0 pauses them");
+            ini_parser_value(&settings, "%d", rs.tasks);
+            ini_parser_end_field(&settings);
+        }
 
-    // check for programs
-    if((ec = proc_check(compiler_cpp(opt->target)))) {
+        ini_parser_end_section(&settings);
+    }
+
+    ByteBuf text;
+    memset(&text, 0, sizeof(text));
+    ini_parser_serialize_stream(&settings, buf_stream, &text);
+    ini_parser_end(&settings);
+
+    bool success = true;
+
+    uint8_t *prev     = NULL;
+    size_t   prev_len = 0;
+    if(!file_read_all(path, &prev, &prev_len) ||
+        prev_len != text.len || memcmp(prev, text.ptr, text.len) != 0
+    ) {
+        FILE *f = fopen(path, "wb");
+        success = f && fwrite(text.ptr, 1, text.len, f) == text.len;
+        if(f) {
+            fclose(f);
+        }
+    }
+
+    free(prev);
+    CB_BUF_FREE(&text);
+    return success;
+}
+// compile runtime settings from config.ini in as the defaults of include/settings.h
+void settings_defines_append(CmdBuf *cmd) {
+    struct RuntimeSettings rs = settings_read();
+    cmd_add(cmd, local_fmt("-DSETTINGS_WINDOW_WIDTH=%d",  rs.width));
+    cmd_add(cmd, local_fmt("-DSETTINGS_WINDOW_HEIGHT=%d", rs.height));
+    cmd_add(cmd, local_fmt("-DSETTINGS_FRAMERATE=%d",     rs.framerate));
+    cmd_add(cmd, local_fmt("-DSETTINGS_ASSET_BUDGET=%zu", rs.budget));
+    cmd_add(cmd, local_fmt("-DSETTINGS_TASK_BUDGET=%d",   rs.tasks));
+}
+// NOTE(alicia): runtime settings live next to the executable
+// so tuning them doesn't rebuild the project.
+int mode_build_settings(struct OptionBuild *opt) {
+    int ec = E_NONE;
+
+    // NOTE(alicia): wasm builds have no settings.ini to read,
+    // config.ini's settings are compiled in instead (see mode_build_project).
+    if(opt->target == T_WASM) {
         return ec;
     }
 
-    cmd_reset(&CMD);
-    CB_CMD_APPEND(&CMD,
-        compiler_cpp(opt->target),
-        "src/sources.cpp", local_fmt("%s/libraylib.a", build_obj_dir(opt->target)));
+    const char *path = local_fmt("%s/settings.ini", build_dir(opt->target));
+    if(!settings_write(path)) {
+        return error(E_FILE_CREATE, path);
+    }
+    return ec;
+}
 
-    switch(opt->target) {
-        case T_NATIVE:
-        case T_LINUX:
-        case T_WINDOWS:
-        case T_MACOS:
-        case T_COUNT:
-            CB_CMD_APPEND(&CMD, "-o", local_fmt("%s/%s%s",
-                build_dir(opt->target), program_name(opt->target), program_ext(opt->target)));
-            break;
-        case T_WASM:
-            CB_CMD_APPEND(&CMD, "-o",
-                local_fmt("%s/index.html", build_dir(opt->target)));
-            break;
+// find group of a resources path, boot group is index 0
+size_t asset_group_of(const char *path) {
+    const char *name = path + sizeof("resources/") - 1;
+    const char *end  = strchr(name, '/');
+    if(!end) {
+        return 0;
     }
 
-    CB_CMD_APPEND(&CMD,
-        "-Iextern/raylib/src", "-Iinclude", "-Iextern/cb",
-        "-Iextern/flagship", "-Iextern/ini-parser");
+    size_t len = end - name;
+    for(size_t i = 1; i < ASSET_GROUPS.len; ++i) {
+        const char *group = STR.ptr + ASSET_GROUPS.ptr[i].name;
+        if(strlen(group) == len && strncmp(group, name, len) == 0) {
+            return i;
+        }
+    }
+    return ASSET_GROUPS.len;
+}
+bool asset_group_is_boot(const char *list, const char *name) {
+    size_t name_len = strlen(name);
+    while(*list) {
+        while(*list && isspace(*list)) {
+            list++;
+        }
+        size_t len = 0;
+        while(list[len] && !isspace(list[len])) {
+            len++;
+        }
+        if(len == name_len && strncmp(list, name, len) == 0) {
+            return true;
+        }
+        list += len;
+    }
+    return false;
+}
+// fill ASSET_GROUPS from resources manifest
+void asset_groups_collect(void) {
+    ASSET_GROUPS.len = 0;
 
-    CB_CMD_APPEND(&CMD, "-Wall");
+    struct AssetGroup boot;
+    memset(&boot, 0, sizeof(boot));
+    boot.boot = true;
+    CB_BUF_PUSH(&ASSET_GROUPS, boot);
 
-    switch(opt->target) {
-        case T_LINUX:
-            if(!opt->strip_symbols) {
-                cmd_add(&CMD, "-ggdb");
-            }
-            if(opt->optimized) {
-                cmd_add(&CMD, "-O2");
-            } else {
-                cmd_add(&CMD, "-O0");
-            }
+    ini_parser_begin_section(&INI, "build");
+    const char *boot_groups = ini_parser_read_string(&INI, "wasm-boot-groups");
 
-            CB_CMD_APPEND(&CMD, "-lGL", "-lm", "-lpthread", "-ldl", "-lrt", "-lX11");
-            break;
+    for(size_t i = 0; i < MANIFEST.len; ++i) {
+        const char *path = manifest_path(&MANIFEST, MANIFEST.ptr + i);
 
-        case T_WINDOWS:
-            if(!opt->strip_symbols) {
-                if(CB_OS_CURRENT == CB_OS_WINDOWS) {
-                    CB_CMD_APPEND(&CMD,
-                        "-gcodeview", "-fuse-ld=lld",
-                        local_fmt("-Wl,-pdb:%s/%s.pdb",
-                            build_dir(opt->target), program_name(opt->target)));
-                } else {
-                    // NOTE(alicia): no .pdb on linux :( as far as I know
-                    cmd_add(&CMD, "-g");
-                }
-            }
-            if(opt->optimized) {
-                cmd_add(&CMD, "-O2");
-            } else {
-                cmd_add(&CMD, "-O0");
-            }
+        size_t g = asset_group_of(path);
+        if(g == ASSET_GROUPS.len) {
+            const char *name = path + sizeof("resources/") - 1;
 
-            CB_CMD_APPEND(&CMD,
-                "-static-libgcc", "-lgdi32", "-lwinmm", "-lshcore", "-lopengl32");
-            break;
+            struct AssetGroup group;
+            memset(&group, 0, sizeof(group));
+            group.name   = str_push(local_fmt("%.*s", (int)(strchr(name, '/') - name), name));
+            group.marker = str_push(path);
+            group.boot   = asset_group_is_boot(boot_groups, STR.ptr + group.name);
+            CB_BUF_PUSH(&ASSET_GROUPS, group);
+        }
 
-        // TODO(alicia): macos!
-        case T_MACOS:
-            if(!opt->strip_symbols) {
-                cmd_add(&CMD, "-g");
+        ASSET_GROUPS.ptr[g].size  += MANIFEST.ptr[i].size;
+        ASSET_GROUPS.ptr[g].files += 1;
+    }
+
+    ini_parser_end_section(&INI);
+}
+void asset_groups_diff(const char *path, enum ManifestChange change, void *params) {
+    (void)change, (void)params;
+    if(strcmp(path, "@layout") == 0) {
+        for(size_t i = 0; i < ASSET_GROUPS.len; ++i) {
+            ASSET_GROUPS.ptr[i].dirty = true;
+        }
+        return;
+    }
+
+    // NOTE(alicia): removed groups are not in ASSET_GROUPS
+    size_t g = asset_group_of(path);
+    if(g < ASSET_GROUPS.len) {
+        ASSET_GROUPS.ptr[g].dirty = true;
+    }
+    if(g < ASSET_GROUPS.len && ASSET_GROUPS.ptr[g].boot) {
+        ASSET_GROUPS.ptr[0].dirty = true;
+    }
+}
+// collect group-* files in build dir that don't belong to a current group
+DirWalkAction asset_groups_stale_walk(const char *path, DirWalkInfo *info, void *in_params) {
+    struct PkgFilesParams *params = (struct PkgFilesParams *)in_params;
+
+    const char *dir  = build_dir(T_WASM);
+    size_t      dlen = strlen(dir);
+    if(info->file_type != FT_FILE || strncmp(path, dir, dlen) ||
+        strncmp(path + dlen, "/group-", sizeof("/group-") - 1)
+    ) {
+        return DWA_CONTINUE;
+    }
+
+    const char *name = path + dlen + sizeof("/group-") - 1;
+    size_t len = info->path_ext_offset - (name - path);
+    if(strcmp(path + info->path_ext_offset, ".js") && strcmp(path + info->path_ext_offset, ".data")) {
+        return DWA_CONTINUE;
+    }
+
+    for(size_t i = 1; i < ASSET_GROUPS.len; ++i) {
+        const char *group = STR.ptr + ASSET_GROUPS.ptr[i].name;
+        if(!ASSET_GROUPS.ptr[i].boot && strlen(group) == len && strncmp(group, name, len) == 0) {
+            return DWA_CONTINUE;
+        }
+    }
+
+    size_t found = str_push(path);
+    CB_BUF_PUSH(&params->found, found);
+    return DWA_CONTINUE;
+}
+
+// remove packages of groups that are gone or now in boot package
+void asset_groups_clean(void) {
+    struct PkgFilesParams stale;
+    memset(&stale, 0, sizeof(stale));
+    dir_walk(build_dir(T_WASM), asset_groups_stale_walk, &stale);
+    for(size_t i = 0; i < stale.found.len; ++i) {
+        remove(STR.ptr + stale.found.ptr[i]);
+    }
+    CB_BUF_FREE(&stale.found);
+}
+
+// package resources into a boot package and one lazily loaded package per group
+int mode_build_wasm_groups(struct OptionBuild *opt, bool *out_data_js) {
+    int ec = E_NONE;
+    const char *dir = build_dir(opt->target);
+
+    asset_groups_collect();
+
+    // NOTE(alicia): layout entry repackages everything when boot groups change
+    struct Manifest cur, prev;
+    memset(&cur, 0, sizeof(cur));
+    memset(&prev, 0, sizeof(prev));
+    manifest_copy(&cur, &MANIFEST);
+
+    ini_parser_begin_section(&INI, "build");
+    cmd_reset(&CMD);
+    CB_CMD_APPEND(&CMD, ini_parser_read_string(&INI, "wasm-boot-groups"));
+    ini_parser_end_section(&INI);
+    manifest_push(&cur, "@layout", cmd_hash(&CMD));
+    manifest_sort(&cur);
+
+    if(manifest_load(local_fmt("%s/index.data.manifest", dir), &prev)) {
+        manifest_diff(&cur, &prev, asset_groups_diff, NULL);
+    } else {
+        asset_groups_diff("@layout", MC_ADDED, NULL);
+    }
+
+    for(size_t i = 0; i < ASSET_GROUPS.len && !ec; ++i) {
+        struct AssetGroup *g = ASSET_GROUPS.ptr + i;
+        if(i && g->boot) {
+            continue;
+        }
+
+        const char *name = i ? STR.ptr + g->name : NULL;
+        const char *data = i ?
+            local_fmt("%s/group-%s.data", dir, name) : local_fmt("%s/index.data", dir);
+        data = STR.ptr + str_push(data);
+        const char *js = i ?
+            local_fmt("%s/group-%s.js", dir, name) : local_fmt("%s/index.data.js", dir);
+        js = STR.ptr + str_push(js);
+
+        // boot package only exists if something is in it
+        bool empty = !i;
+        for(size_t b = 0; b < ASSET_GROUPS.len && empty; ++b) {
+            empty = !(ASSET_GROUPS.ptr[b].boot && ASSET_GROUPS.ptr[b].files);
+        }
+        if(empty) {
+            remove(data);
+            remove(js);
+            continue;
+        }
+        if(!i) {
+            *out_data_js = true;
+        }
+
+        if(!g->dirty && path_exists(data) && path_exists(js)) {
+            continue;
+        }
+
+        cmd_reset(&CMD);
+        CB_CMD_APPEND(&CMD, python(), file_packager(), data);
+        if(i) {
+            CB_CMD_APPEND(&CMD, "--preload", local_fmt("resources/%s", name));
+        } else {
+            CB_CMD_APPEND(&CMD, "--preload");
+            for(size_t f = 0; f < MANIFEST.len; ++f) {
+                const char *path = manifest_path(&MANIFEST, MANIFEST.ptr + f);
+                size_t group = asset_group_of(path);
+                if(group == 0) {
+                    cmd_add(&CMD, path);
+                }
             }
-            if(opt->optimized) {
-                cmd_add(&CMD, "-O2");
-            } else {
-                cmd_add(&CMD, "-O0");
+            for(size_t b = 1; b < ASSET_GROUPS.len; ++b) {
+                if(ASSET_GROUPS.ptr[b].boot) {
+                    cmd_add(&CMD, local_fmt("resources/%s", STR.ptr + ASSET_GROUPS.ptr[b].name));
+                }
+            }
+        }
+        cmd_add(&CMD, local_fmt("--js-output=%s", js));
+
+        CB_INFO("packaging %s . . .", data);
+        ec = job_exec(NULL, local_fmt("file_packager %s", i ? name : "boot"));
+    }
+    if(!ec) {
+        ec = job_join();
+    }
+
+    asset_groups_clean();
+
+    // group list read by src/asset_groups.cpp, same order as WASM_ASSET_GROUPS
+    const char *groups_js = local_fmt("%s/index.groups.js", dir);
+    FILE *f = ec ? NULL : fopen(groups_js, "wb");
+    if(!ec && !f) {
+        ec = error(E_FILE_CREATE, groups_js);
+    }
+    if(f) {
+        fprintf(f, "// generated by cb.c\nModule['assetGroups'] = [\n");
+        for(size_t i = 1; i < ASSET_GROUPS.len; ++i) {
+            struct AssetGroup *g = ASSET_GROUPS.ptr + i;
+            if(g->boot) {
+                continue;
+            }
+            const char *name = json_escape(STR.ptr + g->name);
+            fprintf(f,
+                "    { name: \"%s\", js: \"group-%s.js\", data: \"group-%s.data\", "
+                "size: %" PRIu64 ", marker: \"/%s\" },\n",
+                name, name, name, g->size, json_escape(STR.ptr + g->marker));
+        }
+        fprintf(f, "];\n");
+        fclose(f);
+    }
+
+    if(!ec) {
+        manifest_write(local_fmt("%s/index.data.manifest", dir), &cur);
+    }
+
+    manifest_free(&cur);
+    manifest_free(&prev);
+    return ec;
+}
+
+int mode_build_wasm_data(struct OptionBuild *opt, bool *out_data_js) {
+    int ec = E_NONE;
+    *out_data_js = false;
+
+    if(wasm_lazy_assets()) {
+        if(!file_packager()) {
+            return error(E_MISSING_PROC, "file_packager.py");
+        }
+        if((ec = proc_check(python()))) {
+            return ec;
+        }
+        return mode_build_wasm_groups(opt, out_data_js);
+    }
+
+    ASSET_GROUPS.len = 0;
+    asset_groups_clean();
+    remove(local_fmt("%s/index.groups.js", build_dir(opt->target)));
+
+    // NOTE(alicia): without file_packager, emcc packages resources
+    // itself with --preload-file on every link.
+    const char *packager = file_packager();
+    if(!packager || !proc_exists(python())) {
+        return ec;
+    }
+
+    const char *data     = local_fmt("%s/index.data", build_dir(opt->target));
+    const char *data_js  = local_fmt("%s/index.data.js", build_dir(opt->target));
+    struct Manifest prev;
+    memset(&prev, 0, sizeof(prev));
+
+    if(path_exists(data) && path_exists(data_js) &&
+        manifest_load(local_fmt("%s/index.data.manifest", build_dir(opt->target)), &prev)
+    ) {
+        if(!manifest_diff(&MANIFEST, &prev, NULL, NULL)) {
+            CB_INFO("%s is up to date", data);
+            manifest_free(&prev);
+            *out_data_js = true;
+            return ec;
+        }
+    }
+    manifest_free(&prev);
+
+    CB_INFO("packaging resources into %s . . .", data);
+
+    cmd_reset(&CMD);
+    CB_CMD_APPEND(&CMD, python(), packager, data, "--preload", "resources",
+        local_fmt("--js-output=%s", data_js));
+
+    int exit_code = 0;
+    if((exit_code = CB_EXEC(CMD.cmd))) {
+        return error(E_PROC_FAIL, "file_packager", exit_code);
+    }
+
+    manifest_write(local_fmt("%s/index.data.manifest", build_dir(opt->target)), &MANIFEST);
+
+    *out_data_js = true;
+    return ec;
+}
+
+// NOTE(alicia): SharedArrayBuffer requires cross-origin isolation.
+// most static hosts can't set COOP/COEP headers so the shell registers a
+// service worker that adds them and reloads the page once.
+const char *WASM_COI_SERVICE_WORKER =
+    "// generated by cb.c, adds cross-origin isolation headers\n"
+    "self.addEventListener('install', () => self.skipWaiting());\n"
+    "self.addEventListener('activate', (e) => e.waitUntil(self.clients.claim()));\n"
+    "self.addEventListener('fetch', (e) => {\n"
+    "    const r = e.request;\n"
+    "    if (r.cache === 'only-if-cached' && r.mode !== 'same-origin') {\n"
+    "        return;\n"
+    "    }\n"
+    "    e.respondWith(fetch(r).then((res) => {\n"
+    "        if (res.status === 0) {\n"
+    "            return res;\n"
+    "        }\n"
+    "        const headers = new Headers(res.headers);\n"
+    "        headers.set('Cross-Origin-Embedder-Policy', 'require-corp');\n"
+    "        headers.set('Cross-Origin-Opener-Policy', 'same-origin');\n"
+    "        headers.set('Cross-Origin-Resource-Policy', 'cross-origin');\n"
+    "        return new Response(res.body, {\n"
+    "            status: res.status, statusText: res.statusText, headers });\n"
+    "    }));\n"
+    "});\n";
+
+const char *WASM_COI_REGISTER =
+    "    <script>\n"
+    "        if (!window.crossOriginIsolated && window.isSecureContext && 'serviceWorker' in navigator) {\n"
+    "            navigator.serviceWorker.register('coi-serviceworker.js').then((reg) => {\n"
+    "                if (!navigator.serviceWorker.controller && !sessionStorage.getItem('coi-reload')) {\n"
+    "                    sessionStorage.setItem('coi-reload', '1');\n"
+    "                    window.location.reload();\n"
+    "                }\n"
+    "            });\n"
+    "        }\n"
+    "    </script>\n";
+
+// NOTE(alicia): arguments are title, <head> scripts, Module fields and <body> scripts
+const char *WASM_SHELL =
+    "<!doctype html>\n"
+    "<html lang=\"en-us\">\n"
+    "<head>\n"
+    "    <meta charset=\"utf-8\">\n"
+    "    <meta name=\"viewport\" content=\"width=device-width, initial-scale=1\">\n"
+    "    <title>%s</title>\n"
+    "    <style>\n"
+    "        body { margin: 0; background: black; }\n"
+    "        canvas.emscripten { display: block; margin: 0 auto; border: 0; background: black; }\n"
+    "    </style>\n"
+    "%s"
+    "</head>\n"
+    "<body>\n"
+    "    <canvas class=\"emscripten\" id=\"canvas\" oncontextmenu=\"event.preventDefault()\" tabindex=\"-1\"></canvas>\n"
+    "    <script>\n"
+    "        var Module = {\n"
+    "            canvas: document.getElementById('canvas'),\n"
+    "            print: (text) => console.log(text),\n"
+    "            printErr: (text) => console.error(text),\n"
+    "%s"
+    "        };\n"
+    "    </script>\n"
+    "%s"
+    "</body>\n"
+    "</html>\n";
+
+// NOTE(alicia): tells the local server when the first frame was drawn,
+// used by run --headless to measure load time.
+const char *WASM_READY_BEACON =
+    "            onRuntimeInitialized: () => requestAnimationFrame(() => requestAnimationFrame(() => {\n"
+    "                if (location.hostname === 'localhost') {\n"
+    "                    fetch('__ready', { method: 'POST' }).catch(() => {});\n"
+    "                }\n"
+    "            })),\n";
+
+// write build/wasm/shell.html and service worker for threaded builds
+int wasm_shell(struct OptionBuild *opt, const char **out_shell) {
+    const char *dir = build_dir(opt->target);
+    const char *sw  = local_fmt("%s/coi-serviceworker.js", dir);
+
+    bool threads = read_enable(opt, ENABLE_WASM_THREADS);
+    if(threads) {
+        FILE *f = fopen(sw, "wb");
+        if(!f) {
+            return error(E_FILE_CREATE, sw);
+        }
+        fputs(WASM_COI_SERVICE_WORKER, f);
+        fclose(f);
+    } else {
+        // NOTE(alicia): don't leave a stale service worker to be packaged
+        remove(sw);
+    }
+
+    const char *shell = STR.ptr + str_push(local_fmt("%s/shell.html", dir));
+    FILE *f = fopen(shell, "wb");
+    if(!f) {
+        return error(E_FILE_CREATE, shell);
+    }
+    fprintf(f, WASM_SHELL, project_display_name(),
+        threads ? WASM_COI_REGISTER : "", WASM_READY_BEACON, "    {{{ SCRIPT }}}\n");
+    fclose(f);
+
+    *out_shell = shell;
+    return E_NONE;
+}
+// queue project compile into job group.
+// out_queued is set if project is being built.
+int mode_build_project(struct OptionBuild *opt, bool *out_queued) {
+    int ec = E_NONE;
+    *out_queued = false;
+
+    FileType ft;
+    switch(read_rebuild(opt, REBUILD_PROJECT)) {
+        case REBUILD_OPT_AUTO:
+        case REBUILD_OPT_FORCE:
+            break;
+        case REBUILD_OPT_SKIP: {
+            // check if project exists. if it does, exit
+            const char *path = local_fmt("%s/%s%s",
+                build_dir(opt->target), program_name(opt->target), program_ext(opt->target));
+
+            switch((ft = path_query_file_type(path))) {
+                case FT_NULL:
+                    break;
+                case FT_FILE:
+                    return ec;
+                case FT_DIR:
+                case FT_PIPE:
+                    return error(E_WRONG_FILE_TYPE, path, FT_FILE, ft);
+            }
+        } break;
+        case REBUILD_OPT_COUNT:
+            break;
+    }
+
+    CB_INFO("compiling %s for %s . . .", project_display_name(), target_name(opt->target));
+
+    // check for programs
+    if((ec = proc_check(compiler_cpp(opt->target)))) {
+        return ec;
+    }
+
+    // NOTE(alicia): must happen before CMD is filled, packaging data uses it.
+    bool wasm_data_js = false;
+    if(opt->target == T_WASM && check_resources()) {
+        if((ec = mode_build_wasm_data(opt, &wasm_data_js))) {
+            return ec;
+        }
+    }
+
+    cmd_reset(&CMD);
+    CB_CMD_APPEND(&CMD,
+        compiler_cpp(opt->target),
+        "src/sources.cpp", local_fmt("%s/libraylib.a", build_obj_dir(opt->target)));
+
+    switch(opt->target) {
+        case T_NATIVE:
+        case T_LINUX:
+        case T_WINDOWS:
+        case T_MACOS:
+        case T_COUNT:
+            CB_CMD_APPEND(&CMD, "-o", local_fmt("%s/%s%s",
+                build_dir(opt->target), program_name(opt->target), program_ext(opt->target)));
+            break;
+        case T_WASM:
+            CB_CMD_APPEND(&CMD, "-o",
+                local_fmt("%s/index.html", build_dir(opt->target)));
+            break;
+    }
+
+    CB_CMD_APPEND(&CMD,
+        "-Iextern/raylib/src", "-Iinclude", "-Iextern/cb",
+        "-Iextern/flagship", "-Iextern/ini-parser");
+
+    // NOTE(alicia): coroutines in include/scripts.h
+    CB_CMD_APPEND(&CMD, "-std=c++20", "-Wall");
+
+    switch(opt->target) {
+        case T_LINUX:
+            if(!build_strips(opt)) {
+                cmd_add(&CMD, "-ggdb");
+            }
+            cmd_add(&CMD, optimization_flag(opt));
+
+            CB_CMD_APPEND(&CMD, "-lGL", "-lm", "-lpthread", "-ldl", "-lrt", "-lX11");
+
+            const char *ld = linker_flag(opt->target);
+            if(ld) {
+                cmd_add(&CMD, ld);
+            }
+            break;
+
+        case T_WINDOWS:
+            if(!build_strips(opt)) {
+                if(CB_OS_CURRENT == CB_OS_WINDOWS) {
+                    CB_CMD_APPEND(&CMD,
+                        "-gcodeview", "-fuse-ld=lld",
+                        local_fmt("-Wl,-pdb:%s/%s.pdb",
+                            build_dir(opt->target), program_name(opt->target)));
+                } else {
+                    // NOTE(alicia): no .pdb on linux :( as far as I know
+                    cmd_add(&CMD, "-g");
+                }
+            }
+            cmd_add(&CMD, optimization_flag(opt));
+
+            // NOTE(alicia): -static so std::thread doesn't need libwinpthread-1.dll
+            CB_CMD_APPEND(&CMD,
+                "-static", "-lgdi32", "-lwinmm", "-lshcore", "-lopengl32");
+            break;
+
+        // TODO(alicia): macos!
+        case T_MACOS:
+            if(!build_strips(opt)) {
+                cmd_add(&CMD, "-g");
             }
+            cmd_add(&CMD, optimization_flag(opt));
 
             break;
         case T_WASM: {
-            if(!opt->strip_symbols) {
+            if(!build_strips(opt)) {
                 CB_CMD_APPEND(&CMD, "--profiling", "-s", "ASSERTIONS=1");
             }
 
             // NOTE(alicia): always optimize for space on wasm builds
-            cmd_add(&CMD, "-Os");
+            cmd_add(&CMD, read_enable(opt, ENABLE_SIZE) ? "-Oz" : "-Os");
 
             size_t mem = total_memory();
             CB_CMD_APPEND(&CMD, "-s", local_fmt("TOTAL_MEMORY=%zu", mem));
 
+            size_t max = max_memory();
+            if(max > mem) {
+                CB_CMD_APPEND(&CMD,
+                    "-s", "ALLOW_MEMORY_GROWTH=1",
+                    "-s", local_fmt("MAXIMUM_MEMORY=%zu", max));
+            }
+
+            wasm_features_append(opt, &CMD);
+            if(read_enable(opt, ENABLE_WASM_THREADS)) {
+                // NOTE(alicia): workers are spawned up front,
+                // blocking on a new thread from the main thread would deadlock.
+                CB_CMD_APPEND(&CMD,
+                    "-s", "PTHREAD_POOL_SIZE=navigator.hardwareConcurrency",
+                    "-Wno-pthreads-mem-growth");
+            }
+
+            const char *shell;
+            if((ec = wasm_shell(opt, &shell))) {
+                return ec;
+            }
+
             CB_CMD_APPEND(&CMD,
                 local_fmt("-L%s", build_obj_dir(opt->target)),
                 "-lraylib",
                 "-s", "USE_GLFW=3",
-                "--shell-file", "extern/raylib/src/minshell.html",
+                "--shell-file", shell,
                 "-s", "FORCE_FILESYSTEM=1");
 
-            if(check_resources()) {
+            if(wasm_data_js) {
+                CB_CMD_APPEND(&CMD, "--pre-js",
+                    local_fmt("%s/index.data.js", build_dir(opt->target)));
+            } else if(check_resources() && !wasm_lazy_assets()) {
                 CB_CMD_APPEND(&CMD, "--preload-file", "resources");
             }
+
+            if(wasm_lazy_assets()) {
+                // NOTE(alicia): same order as index.groups.js
+                ByteBuf *groups = local_buf();
+                string_buf_fmt(groups, "-DWASM_ASSET_GROUPS=\"");
+                bool first = true;
+                for(size_t i = 1; i < ASSET_GROUPS.len; ++i) {
+                    if(!ASSET_GROUPS.ptr[i].boot) {
+                        string_buf_fmt(groups, "%s%s",
+                            first ? "" : " ", STR.ptr + ASSET_GROUPS.ptr[i].name);
+                        first = false;
+                    }
+                }
+                string_buf_fmt(groups, "\"");
+                CB_BUF_PUSH(groups, 0);
+
+                CB_CMD_APPEND(&CMD, "-DWASM_LAZY_ASSETS=1", groups->ptr);
+                if(check_resources()) {
+                    CB_CMD_APPEND(&CMD, "--pre-js",
+                        local_fmt("%s/index.groups.js", build_dir(opt->target)));
+                }
+            }
+
+            settings_defines_append(&CMD);
         } break;
 
         case T_NATIVE:
@@ -819,30 +1779,6 @@ int mode_build_project(struct OptionBuild *opt) {
     cmd_add(&CMD, local_fmt("-DPROJECT_DEVELOPER=\"%s\"", developer()));
     cmd_add(&CMD, local_fmt("-DPROJECT_COMPILER=\"%s\"", compiler_cpp(opt->target)));
 
-    ini_parser_begin_section(&INI, "project");
-
-    int v;
-
-    v = ini_parser_read_integer(&INI, "window-width");
-    if(v < 100) {
-        v = 100;
-    }
-    cmd_add(&CMD, local_fmt("-DWINDOW_WIDTH=%d",v));
-
-    v = ini_parser_read_integer(&INI, "window-height");
-    if(v < 100) {
-        v = 100;
-    }
-    cmd_add(&CMD, local_fmt("-DWINDOW_HEIGHT=%d", v));
-
-    v = ini_parser_read_integer(&INI, "framerate");
-    if(v < 20) {
-        v = 20;
-    }
-    cmd_add(&CMD, local_fmt("-DFRAMERATE=%d", v));
-
-    ini_parser_end_section(&INI);
-
     for(enum Target t = T_BEGIN; t < T_COUNT; ++t) {
         if(t == T_NATIVE) {
             continue;
@@ -864,537 +1800,1744 @@ int mode_build_project(struct OptionBuild *opt) {
 
     cmd_add(&CMD, local_fmt("-DPLATFORM=%i", opt->target));
 
-    int exit_code = 0;
-    if((exit_code = CB_EXEC(CMD.cmd))) {
-        ec = error(E_PROC_FAIL, local_fmt("%s %s", CMD.cmd.ptr[0], CMD.cmd.ptr[1]), exit_code);
+    // NOTE(alicia): wasm resources are packaged, nothing to watch
+    if(read_enable(opt, ENABLE_HOT_RELOAD) && opt->target != T_WASM) {
+        cmd_add(&CMD, "-DHOT_RELOAD=1");
     }
 
-    CB_INFO("built %s at %s/%s%s",
-        project_display_name(), build_dir(opt->target),
-        opt->target == T_WASM ? "index" : program_name(opt->target), program_ext(opt->target));
-
-    return ec;
-}
-
-int mode_build(struct OptionBuild *opt) {
-    int ec = E_NONE;
-
-    CB_INFO("building . . .");
-
-    // check for directories
-    if((ec = makedir("build", build_dir(opt->target), build_obj_dir(opt->target)))) {
-        return ec;
+    // NOTE(alicia): lets game code leave out what uses disabled raylib modules
+    for(enum RaylibModule m = RAYLIB_MODULE_BEGIN; m < RAYLIB_MODULE_COUNT; ++m) {
+        if(RAYLIB_MODULES[m]) {
+            cmd_add(&CMD, local_fmt("-D%s=1", RAYLIB_MODULE_MACROS[m]));
+        }
     }
 
-    // check if it's even possible to cross-compile
-    switch(CB_OS_CURRENT) {
-        case CB_OS_GNU_LINUX: switch(opt->target) {
-            case T_NATIVE:
+    if(read_enable(opt, ENABLE_SIZE)) {
+        CB_CMD_APPEND(&CMD, "-ffunction-sections", "-fdata-sections");
+        switch(opt->target) {
             case T_LINUX:
             case T_WINDOWS:
-            case T_WASM:
-            case T_COUNT:
+                cmd_add(&CMD, "-Wl,--gc-sections");
                 break;
             case T_MACOS:
-                return error(E_UNIMPLEMENTED, "cannot cross-compile to macos from linux!");
-        } break;
-        case CB_OS_WINDOWS: switch(opt->target) {
-            case T_NATIVE:
-            case T_LINUX:
-            case T_WINDOWS:
+                cmd_add(&CMD, "-Wl,-dead_strip");
+                break;
+            // NOTE(alicia): wasm-ld already removes unused sections
             case T_WASM:
+            case T_NATIVE:
             case T_COUNT:
                 break;
-            case T_MACOS:
-                return error(E_UNIMPLEMENTED, "cannot cross-compile to macos from windows!");
-        } break;
-        case CB_OS_MACOS:
-            // TODO(alicia): 
-            return error(E_UNIMPLEMENTED, "no macos support yet!");
+        }
     }
 
-    // build dependencies
-    if((ec = mode_build_raylib(opt))) {
+    if((ec = job_exec(NULL, local_fmt("%s %s", CMD.cmd.ptr[0], target_name(opt->target))))) {
         return ec;
     }
 
-    // generate sources.cpp
-    if((ec = mode_build_sources_file(opt))) {
-        return ec;
+    *out_queued = true;
+    return ec;
+}
+
+// queue moving debug info of project into a .debug file
+void mode_build_split_debug(struct OptionBuild *opt) {
+    const char *tool = objcopy(opt->target);
+    if(build_strips(opt) || !tool) {
+        return;
     }
 
-    // build project
-    if((ec = mode_build_project(opt))) {
-        return ec;
+    ini_parser_begin_section(&INI, "build");
+    bool split = ini_read_bool("split-debug");
+    ini_parser_end_section(&INI);
+
+    if(!split) {
+        return;
     }
 
-    return ec;
+    const char *exe = local_fmt("%s/%s%s",
+        build_dir(opt->target), program_name(opt->target), program_ext(opt->target));
+
+    cmd_reset(&CMD);
+    CB_CMD_APPEND(&CMD, tool, "--only-keep-debug", exe, local_fmt("%s.debug", exe));
+    chain_push(opt->target, NULL, local_fmt("%s --only-keep-debug", tool));
+
+    exe = local_fmt("%s/%s%s",
+        build_dir(opt->target), program_name(opt->target), program_ext(opt->target));
+
+    // NOTE(alicia): debuggers find the .debug file through the debuglink
+    cmd_reset(&CMD);
+    CB_CMD_APPEND(&CMD, tool, "--strip-debug",
+        local_fmt("--add-gnu-debuglink=%s.debug", exe), exe);
+    chain_push(opt->target, NULL, local_fmt("%s --strip-debug", tool));
 }
-int mode_run(struct OptionRun *opt) {
-    int ec = E_NONE;
 
-    // build
-    if((ec = mode_build(&opt->build))) {
-        return ec;
+// queue an extra wasm-opt pass over index.wasm
+void mode_build_wasm_opt(struct OptionBuild *opt) {
+    if(opt->target != T_WASM || !read_enable(opt, ENABLE_SIZE)) {
+        return;
+    }
+    if(!proc_exists("wasm-opt")) {
+        CB_INFO("wasm-opt not found, skipping wasm-opt pass");
+        return;
     }
 
-    CB_INFO("running %s . . .", project_display_name());
+    const char *wasm = local_fmt("%s/index.wasm", build_dir(opt->target));
 
     cmd_reset(&CMD);
+    CB_CMD_APPEND(&CMD, "wasm-opt", "-Oz",
+        "--enable-bulk-memory", "--enable-nontrapping-float-to-int",
+        "--enable-sign-ext", "--enable-mutable-globals",
+        wasm, "-o", wasm);
+    chain_push(opt->target, NULL, "wasm-opt -Oz");
+}
 
-    int exit_code = 0;
-    switch(CB_OS_CURRENT) {
-        case CB_OS_GNU_LINUX: switch(opt->build.target) {
-            case T_LINUX:
-                cmd_add(&CMD,
-                local_fmt("%s/%s%s",
-                    build_dir(opt->build.target), program_name(opt->build.target),
-                    program_ext(opt->build.target)));
-
-                for(size_t i = 0; i < opt->passthrough.len; ++i) {
-                    cmd_add(&CMD, opt->passthrough.ptr[i]);
-                }
+// write build/<target>/size.json and print changes since last build
+void mode_build_size_report(struct OptionBuild *opt) {
+    const char *binary = opt->target == T_WASM ?
+        local_fmt("%s/index.wasm", build_dir(opt->target)) :
+        local_fmt("%s/%s%s", build_dir(opt->target),
+            program_name(opt->target), program_ext(opt->target));
+    binary = STR.ptr + str_push(binary);
+
+    struct SizeReport cur, prev;
+    memset(&cur, 0, sizeof(cur));
+    memset(&prev, 0, sizeof(prev));
+
+    if(!size_parse(binary, &cur, false)) {
+        CB_INFO("size report: could not parse %s", binary);
+        size_free(&cur);
+        return;
+    }
 
-                if((exit_code = CB_EXEC(CMD.cmd))) {
-                    return error(E_PROC_FAIL, CMD.cmd.ptr[0], exit_code);
-                }
-                break;
-            case T_WINDOWS:
-                if((ec = proc_check("wine"))) {
-                    return ec;
-                }
-                cmd_add(&CMD, "wine");
+    CStringBuf sources;
+    memset(&sources, 0, sizeof(sources));
+    raylib_sources(opt->target, &sources);
+    for(size_t i = 0; i < sources.len; ++i) {
+        struct SizeReport obj;
+        memset(&obj, 0, sizeof(obj));
 
-                cmd_add(&CMD,
-                local_fmt("%s/%s%s",
-                    build_dir(opt->build.target), program_name(opt->build.target),
-                    program_ext(opt->build.target)));
+        const char *name = local_fmt("%s.o", sources.ptr[i]);
+        if(size_parse(local_fmt("%s/%s", build_obj_dir(opt->target), name), &obj, true)) {
+            size_push(&cur, &cur.objects, name, strlen(name), obj.total);
+        }
+        size_free(&obj);
+    }
+    CB_BUF_FREE(&sources);
 
-                for(size_t i = 0; i < opt->passthrough.len; ++i) {
-                    cmd_add(&CMD, opt->passthrough.ptr[i]);
-                }
+    size_sort(&cur);
 
-                if((exit_code = CB_EXEC(CMD.cmd))) {
-                    return error(E_PROC_FAIL, CMD.cmd.ptr[0], exit_code);
-                }
-                break;
-            case T_MACOS:
-                return error(E_NO_RUN_SUPPORT, CB_OS_CURRENT, opt->build.target);
-            case T_WASM:
-                if((ec = proc_check("python", "xdg-open"))) {
-                    return ec;
-                }
+    const char *path = STR.ptr + str_push(local_fmt("%s/size.json", build_dir(opt->target)));
 
-                dir_cwd_set(build_dir(opt->build.target));
+    if(size_load(path, &prev)) {
+        CB_INFO("size: %s %s (%s)",
+            binary, memory_fmt(cur.total), size_delta_fmt(cur.total, prev.total));
+        if(cur.total != prev.total) {
+            size_print_changes("section", &cur, &cur.sections, &prev, &prev.sections);
+            size_print_changes("object",  &cur, &cur.objects,  &prev, &prev.objects);
+        }
+    } else {
+        CB_INFO("size: %s %s", binary, memory_fmt(cur.total));
+    }
 
-                CB_INFO("launching local server");
-                CB_INFO("to close server, kill this process (Ctrl+C or some other signal)");
-                CB_CMD_APPEND(&CMD, "python", "-m", "http.server");
-                Process python_server;
-                if(CB_EXEC(CMD.cmd, .group=&PG, .proc=&python_server)) {
-                    return error(E_EXEC_ASYNC, "python local server");
-                }
+    size_write(path, binary, &cur);
 
-                // wait for python server to spin up
-                mt_sleep(30);
+    size_free(&cur);
+    size_free(&prev);
+}
 
-                cmd_reset(&CMD);
-                CB_CMD_APPEND(&CMD, "xdg-open", "localhost:8000/index.html");
+int mode_build_prepare(struct OptionBuild *opt) {
+    int ec = E_NONE;
 
-                if((exit_code = CB_EXEC(CMD.cmd))) {
-                    ec = error(E_PROC_FAIL, "xdg-open", exit_code);
-                    proc_signal(&python_server, PSIG_KILL);
-                }
+    // check for directories
+    if((ec = makedir("build", build_dir(opt->target), build_obj_dir(opt->target)))) {
+        return ec;
+    }
 
-                proc_group_join(&PG, CB_WAIT_INF);
+    // check if it's even possible to cross-compile
+    switch(CB_OS_CURRENT) {
+        case CB_OS_GNU_LINUX: switch(opt->target) {
+            case T_NATIVE:
+            case T_LINUX:
+            case T_WINDOWS:
+            case T_WASM:
+            case T_COUNT:
                 break;
-
+            case T_MACOS:
+                return error(E_UNIMPLEMENTED, "cannot cross-compile to macos from linux!");
+        } break;
+        case CB_OS_WINDOWS: switch(opt->target) {
             case T_NATIVE:
+            case T_LINUX:
+            case T_WINDOWS:
+            case T_WASM:
             case T_COUNT:
                 break;
+            case T_MACOS:
+                return error(E_UNIMPLEMENTED, "cannot cross-compile to macos from windows!");
         } break;
-        case CB_OS_WINDOWS:
         case CB_OS_MACOS:
-        default:
-            break;
+            // TODO(alicia): 
+            return error(E_UNIMPLEMENTED, "no macos support yet!");
     }
 
     return ec;
 }
-int mode_pkg(struct OptionPkg *opt) {
+
+int mode_build(struct OptionBuild *opt) {
     int ec = E_NONE;
-    if((ec = mode_build(&opt->build))) {
-        return ec;
-    }
 
-    CB_INFO("packaging project . . .");
+    CB_INFO("building . . .");
 
-    if((ec = makedir("bin"))) {
-        return ec;
+    enum Target first = opt->target;
+
+    // NOTE(alicia): every target's jobs share one process group,
+    // each stage waits for the previous stage of every target.
+    bool archive[T_COUNT];
+    bool built[T_COUNT];
+    memset(archive, 0, sizeof(archive));
+    memset(built, 0, sizeof(built));
+
+    for(enum Target t = T_BEGIN + 1; t < T_COUNT && !ec; ++t) {
+        if(target_selected(opt, t)) {
+            opt->target = t;
+            ec = mode_build_prepare(opt);
+        }
     }
 
-    int exit_code = 0;
-    cmd_reset(&CMD);
-    switch(opt->build.target) {
-        case T_LINUX: {
-            // uses tar
-            if((ec = proc_check("tar"))) {
-                return ec;
-            }
+    // build dependencies
+    for(enum Target t = T_BEGIN + 1; t < T_COUNT && !ec; ++t) {
+        if(target_selected(opt, t)) {
+            opt->target = t;
+            ec = mode_build_raylib(opt, archive + t);
+        }
+    }
+    if(!ec) {
+        ec = job_join();
+    }
+    for(enum Target t = T_BEGIN + 1; t < T_COUNT && !ec; ++t) {
+        if(archive[t]) {
+            opt->target = t;
+            ec = mode_build_raylib_archive(opt);
+        }
+    }
+    if(!ec) {
+        ec = job_join();
+    }
+    for(enum Target t = T_BEGIN + 1; t < T_COUNT && !ec; ++t) {
+        if(archive[t]) {
+            manifest_write(local_fmt("%s/raylib.manifest", build_obj_dir(t)), RAYLIB_STAMPS + t);
+        }
+    }
 
-            CB_CMD_APPEND(&CMD, "tar", "-cJf",
-                local_fmt("bin/%s-linux-x86_64.tar.xz", program_name(opt->build.target)));
+    // generate sources.cpp
+    for(enum Target t = T_BEGIN + 1; t < T_COUNT && !ec; ++t) {
+        if(target_selected(opt, t)) {
+            opt->target = t;
+            ec = mode_build_sources_file(opt);
+        }
+    }
 
-            CB_CMD_APPEND(&CMD, local_fmt("--transform=s,^,%s-linux-x86_64/,",
-                program_name(opt->build.target)));
+    // write settings.ini
+    for(enum Target t = T_BEGIN + 1; t < T_COUNT && !ec; ++t) {
+        if(target_selected(opt, t)) {
+            opt->target = t;
+            ec = mode_build_settings(opt);
+        }
+    }
 
-            CB_CMD_APPEND(&CMD, "-C",
-                build_dir(opt->build.target), program_name(opt->build.target));
+    // build project
+    for(enum Target t = T_BEGIN + 1; t < T_COUNT && !ec; ++t) {
+        if(target_selected(opt, t)) {
+            opt->target = t;
+            ec = mode_build_project(opt, built + t);
+        }
+    }
+    if(!ec) {
+        ec = job_join();
+    }
 
-            if(check_resources()) {
-                CB_CMD_APPEND(&CMD, "-C", "../../", "resources");
-            }
+    // split debug info into sidecar files and shrink wasm
+    for(enum Target t = T_BEGIN + 1; t < T_COUNT && !ec; ++t) {
+        if(built[t]) {
+            opt->target = t;
+            mode_build_split_debug(opt);
+            mode_build_wasm_opt(opt);
+        }
+    }
+    if(!ec) {
+        bool failed[T_COUNT];
+        memset(failed, 0, sizeof(failed));
+        ec = chain_run(failed);
+    }
 
-            if((exit_code = CB_EXEC(CMD.cmd))) {
-                return error(E_PROC_FAIL, "tar", exit_code);
-            }
+    for(enum Target t = T_BEGIN + 1; t < T_COUNT && !ec; ++t) {
+        if(built[t]) {
+            opt->target = t;
+            mode_build_size_report(opt);
 
-            CB_INFO("project packaged at %s",
-                local_fmt("bin/%s-linux-x86_64.tar.xz", program_name(opt->build.target)));
-        } break;
-        case T_WINDOWS: {
-            // uses zip
-            if((ec = proc_check("zip"))) {
-                return ec;
-            }
+            CB_INFO("built %s at %s/%s%s",
+                project_display_name(), build_dir(t),
+                t == T_WASM ? "index" : program_name(t), program_ext(t));
+        }
+    }
 
-            if(check_resources()) {
-                CB_CMD_APPEND(&CMD, "zip", "-r", "resources.zip", "resources");
+    if(ec) {
+        // NOTE(alicia): don't leave children running after a failure
+        job_join();
+    }
 
-                if((exit_code = CB_EXEC(CMD.cmd))) {
-                    return error(E_PROC_FAIL, "zip resources", exit_code);
-                }
+    opt->target = first;
+    return ec;
+}
+#if !defined(_WIN32)
 
-                const char *dst = local_fmt("%s/resources.zip", build_dir(opt->build.target));
-                const char *src = "resources.zip";
-                if(!file_move(dst, src, false)) {
-                    return error(E_FILE_MOVE, dst, src);
-                }
+#define HTTP_MAX_CONNECTIONS 64
+#define HTTP_REQUEST_MAX     (8 * 1024)
+#define HTTP_CHUNK           (64 * 1024)
+#define HTTP_PORT_FIRST      8000
+#define HTTP_PORT_COUNT      10
 
-                cmd_reset(&CMD);
-            }
+struct HttpMime {
+    const char *ext;
+    const char *type;
+};
+struct HttpMime HTTP_MIME[] = {
+    { ".html", "text/html; charset=utf-8" },
+    { ".js",   "text/javascript; charset=utf-8" },
+    { ".mjs",  "text/javascript; charset=utf-8" },
+    { ".json", "application/json" },
+    { ".wasm", "application/wasm" },
+    { ".data", "application/octet-stream" },
+    { ".css",  "text/css; charset=utf-8" },
+    { ".txt",  "text/plain; charset=utf-8" },
+    { ".png",  "image/png" },
+    { ".jpg",  "image/jpeg" },
+    { ".jpeg", "image/jpeg" },
+    { ".svg",  "image/svg+xml" },
+    { ".ico",  "image/x-icon" },
+    { ".ogg",  "audio/ogg" },
+    { ".mp3",  "audio/mpeg" },
+    { ".wav",  "audio/wav" },
+};
 
-            CB_CMD_APPEND(&CMD, "zip", "resources.zip",
-                local_fmt("%s%s", program_name(opt->build.target), program_ext(opt->build.target)));
+struct HttpConnection {
+    int fd;
 
-            if((exit_code = CB_EXEC(CMD.cmd, .wd=build_dir(opt->build.target)))) {
-                return error(E_PROC_FAIL, "zip resources", exit_code);
-            }
+    char   request[HTTP_REQUEST_MAX];
+    size_t request_len;
 
-            const char *dst = local_fmt("bin/%s-windows-x64.zip", program_name(opt->build.target));
-            const char *src = local_fmt("%s/resources.zip", build_dir(opt->build.target));
+    // response headers, then body streamed from file
+    char   header[1024];
+    size_t header_len;
+    size_t header_sent;
+    FILE  *body;
 
-            if(!file_move(dst, src, false)) {
-                return error(E_FILE_MOVE, dst, src);
-            }
+    bool keep_alive;
+};
 
-            CB_INFO("project packaged at %s", dst);
-        } break;
-        case T_MACOS: {
-            // uses zip
-            if((ec = proc_check("zip"))) {
-                return ec;
-            }
-            // TODO(alicia): 
-            return error(E_UNIMPLEMENTED, "package macos");
-        } break;
-        case T_WASM: {
-            // uses zip
-            if((ec = proc_check("zip"))) {
-                return ec;
-            }
+struct HttpServer {
+    int listen_fd;
+    int port;
 
-            // NOTE(alicia): we use T_LINUX in order to get actual program name, not index
-            CB_CMD_APPEND(&CMD, "zip", local_fmt("%s-wasm.zip", program_name(T_LINUX)));
+    const char *root;
+    bool headless;
 
-            CB_CMD_APPEND(&CMD, "index.js", "index.html", "index.wasm");
+    // NOTE(alicia): for reporting load time, set when index.html is requested
+    struct timespec load_start;
+    bool ready;
 
-            // check if there's a data file
-            if(path_exists(local_fmt("%s/index.data", build_dir(opt->build.target)))) {
-                cmd_add(&CMD, "index.data");
-            }
+    struct HttpConnection conn[HTTP_MAX_CONNECTIONS];
+    size_t conn_count;
+};
 
-            if((exit_code = CB_EXEC(CMD.cmd, .wd=build_dir(opt->build.target)))) {
-                return error(E_PROC_FAIL, "zip wasm", exit_code);
-            }
+volatile sig_atomic_t HTTP_STOP = 0;
 
-            // NOTE(alicia): we use T_LINUX in order to get actual program name, not index
-            const char *dst = local_fmt("bin/%s-wasm.zip", program_name(T_LINUX));
-            const char *src = local_fmt("%s/%s-wasm.zip",
-                build_dir(opt->build.target), program_name(T_LINUX));
+void http_stop_signal(int sig) {
+    (void)sig;
+    HTTP_STOP = 1;
+}
 
-            if(!file_move(dst, src, false)) {
-                return error(E_FILE_MOVE, dst, src);
+const char *http_mime(const char *path) {
+    const char *ext = strrchr(path, '.');
+    if(ext) {
+        for(size_t i = 0; i < CB_ARRAY_LEN(HTTP_MIME); ++i) {
+            if(strcmp(ext, HTTP_MIME[i].ext) == 0) {
+                return HTTP_MIME[i].type;
             }
+        }
+    }
+    return "application/octet-stream";
+}
 
-            CB_INFO("project packaged at %s", dst);
-        } break;
+// decode %XX in place, returns false for paths that escape root
+bool http_path_decode(char *path) {
+    char *src = path, *dst = path;
+    while(*src) {
+        if(src[0] == '%' && isxdigit((unsigned char)src[1]) && isxdigit((unsigned char)src[2])) {
+            char hex[3] = { src[1], src[2], 0 };
+            *dst++ = (char)strtol(hex, NULL, 16);
+            src += 3;
+        } else {
+            *dst++ = *src++;
+        }
+    }
+    *dst = 0;
 
-        case T_NATIVE:
-        case T_COUNT:
-            break;
+    return path[0] == '/' && !strstr(path, "..") && !strchr(path, '\\');
+}
+
+// find a header value in a request, value is not terminated
+const char *http_header(const char *request, const char *name, size_t *out_len) {
+    size_t name_len = strlen(name);
+    const char *line = strstr(request, "\r\n");
+    while(line && line[2] != '\r') {
+        line += 2;
+        if(strncasecmp(line, name, name_len) == 0 && line[name_len] == ':') {
+            const char *value = line + name_len + 1;
+            while(*value == ' ') {
+                value++;
+            }
+            const char *end = strstr(value, "\r\n");
+            *out_len = end ? (size_t)(end - value) : strlen(value);
+            return value;
+        }
+        line = strstr(line, "\r\n");
+    }
+    return NULL;
+}
+bool http_accepts(const char *request, const char *encoding) {
+    size_t len;
+    const char *value = http_header(request, "Accept-Encoding", &len);
+    if(!value) {
+        return false;
     }
+    const char *found = strstr(local_fmt("%.*s", (int)len, value), encoding);
+    return found != NULL;
+}
 
-    return ec;
+void http_respond(struct HttpConnection *c, int status, const char *reason,
+    const char *type, const char *encoding, long length
+) {
+    int len = snprintf(c->header, sizeof(c->header),
+        "HTTP/1.1 %d %s\r\n"
+        "Content-Type: %s\r\n"
+        "Content-Length: %ld\r\n"
+        "%s%s%s"
+        "Vary: Accept-Encoding\r\n"
+        "Cache-Control: no-cache\r\n"
+        "Cross-Origin-Opener-Policy: same-origin\r\n"
+        "Cross-Origin-Embedder-Policy: require-corp\r\n"
+        "Cross-Origin-Resource-Policy: same-origin\r\n"
+        "Connection: %s\r\n"
+        "\r\n",
+        status, reason, type, length,
+        encoding ? "Content-Encoding: " : "", encoding ? encoding : "", encoding ? "\r\n" : "",
+        c->keep_alive ? "keep-alive" : "close");
+
+    c->header_len  = len < 0 ? 0 : (size_t)len;
+    c->header_sent = 0;
+}
+void http_error(struct HttpConnection *c, int status, const char *reason) {
+    c->keep_alive = false;
+    http_respond(c, status, reason, "text/plain; charset=utf-8", NULL, 0);
 }
 
-int flagship_define(struct FlagshipContext *fls, const char *proc) {
-    int ec = E_NONE;
+// parse a complete request in c->request and prepare the response
+void http_handle(struct HttpServer *s, struct HttpConnection *c) {
+    char method[8], target[1024];
+    if(sscanf(c->request, "%7s %1023s", method, target) != 2) {
+        http_error(c, 400, "Bad Request");
+        return;
+    }
 
-    flagship_name(fls, "%s", proc);
-    flagship_description(fls, "build system for raylib project");
+    size_t len;
+    const char *connection = http_header(c->request, "Connection", &len);
+    c->keep_alive = !(connection && strncasecmp(connection, "close", len) == 0);
 
-    flagship_begin_mode(fls); {
-        flagship_name(fls, "%s", MODE_NAMES[M_HELP]);
-        flagship_description(fls, "print help and exit");
+    bool head = strcmp(method, "HEAD") == 0;
+    if(!head && strcmp(method, "GET") && strcmp(method, "POST")) {
+        http_error(c, 405, "Method Not Allowed");
+        return;
+    }
 
-        flagship_begin_flag(fls, FLAGSHIP_TYPE_ENUM); {
-            flagship_description(fls, "mode to print help for");
-            for(int m = M_BEGIN; m < M_COUNT; ++m) {
-                flagship_enum_variant(fls, "%s", MODE_NAMES[m]);
-            }
+    char *query = strchr(target, '?');
+    if(query) {
+        *query = 0;
+    }
+    if(!http_path_decode(target)) {
+        http_error(c, 400, "Bad Request");
+        return;
+    }
 
-            flagship_is_terminating(fls, true);
-            flagship_end_flag(fls);
+    // NOTE(alicia): page reports its first frame, see wasm_shell
+    if(strcmp(target, "/__ready") == 0) {
+        if(!s->ready) {
+            struct timespec now;
+            clock_gettime(CLOCK_MONOTONIC, &now);
+            double ms = (double)(now.tv_sec - s->load_start.tv_sec) * 1000.0 +
+                (double)(now.tv_nsec - s->load_start.tv_nsec) / 1000000.0;
+            CB_INFO("first frame %.1fms after index.html was requested", ms);
+            s->ready = true;
         }
-
-        flagship_end_mode(fls);
+        http_respond(c, 204, "No Content", "text/plain; charset=utf-8", NULL, 0);
+        return;
     }
 
-    flagship_begin_mode(fls); {
-        flagship_name(fls, "%s", MODE_NAMES[M_BUILD]);
-        flagship_description(fls, "build project");
+    if(strcmp(target, "/") == 0) {
+        strcpy(target, "/index.html");
+    }
+    if(strcmp(target, "/index.html") == 0) {
+        clock_gettime(CLOCK_MONOTONIC, &s->load_start);
+        s->ready = false;
+    }
 
-        flagship_begin_flag(fls, FLAGSHIP_TYPE_ENUM); {
-            flagship_name(fls, "target");
-            flagship_name(fls, "t");
+    const char *path     = local_fmt("%s%s", s->root, target);
+    const char *encoding = NULL;
 
-            flagship_description(fls, "set target platform");
+    // serve precompressed siblings when the client accepts them
+    if(http_accepts(c->request, "br") && path_exists(local_fmt("%s.br", path))) {
+        encoding = "br";
+    } else if(http_accepts(c->request, "gzip") && path_exists(local_fmt("%s.gz", path))) {
+        encoding = "gzip";
+    }
 
-            for(enum Target t = T_BEGIN; t < T_COUNT; ++t) {
-                flagship_enum_variant(fls, "%s", TARGET_NAMES[t]);
-            }
+    const char *file = encoding ?
+        local_fmt("%s%s.%s", s->root, target, strcmp(encoding, "br") == 0 ? "br" : "gz") :
+        local_fmt("%s%s", s->root, target);
 
-            flagship_default(fls, "%s", TARGET_NAMES[target_normalize(T_NATIVE)]);
+    struct stat st;
+    if(stat(file, &st) || !S_ISREG(st.st_mode)) {
+        http_error(c, 404, "Not Found");
+        return;
+    }
 
-            flagship_end_flag(fls);
+    if(!head) {
+        c->body = fopen(file, "rb");
+        if(!c->body) {
+            http_error(c, 403, "Forbidden");
+            return;
         }
+    }
 
-        flagship_begin_flag(fls, FLAGSHIP_TYPE_BOOL); {
-            flagship_name(fls, "optimized");
-            flagship_name(fls, "o");
+    http_respond(c, 200, "OK", http_mime(target), encoding, (long)st.st_size);
+}
 
-            flagship_description(fls, "build with optimizations turned on");
+void http_close(struct HttpServer *s, size_t i) {
+    struct HttpConnection *c = s->conn + i;
+    close(c->fd);
+    if(c->body) {
+        fclose(c->body);
+    }
+    s->conn[i] = s->conn[--s->conn_count];
+}
 
-            flagship_end_flag(fls);
+// returns false when the connection should be closed
+bool http_read(struct HttpServer *s, struct HttpConnection *c) {
+    ssize_t n = recv(c->fd, c->request + c->request_len,
+        sizeof(c->request) - 1 - c->request_len, 0);
+    if(n <= 0) {
+        return n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK);
+    }
+    c->request_len += (size_t)n;
+    c->request[c->request_len] = 0;
+
+    char *end = strstr(c->request, "\r\n\r\n");
+    if(!end) {
+        if(c->request_len == sizeof(c->request) - 1) {
+            http_error(c, 431, "Request Header Fields Too Large");
         }
+        return true;
+    }
 
-        flagship_begin_flag(fls, FLAGSHIP_TYPE_BOOL); {
-            flagship_name(fls, "strip-symbols");
-            flagship_name(fls, "s");
+    http_handle(s, c);
 
-            flagship_description(fls, "strip debug symbols");
+    // NOTE(alicia): bodies are ignored, only the beacon is ever posted
+    c->request_len = 0;
+    return true;
+}
+// returns false when the connection should be closed
+bool http_write(struct HttpConnection *c) {
+    if(c->header_sent < c->header_len) {
+        ssize_t n = send(c->fd, c->header + c->header_sent,
+            c->header_len - c->header_sent, MSG_NOSIGNAL);
+        if(n < 0) {
+            return errno == EAGAIN || errno == EWOULDBLOCK;
+        }
+        c->header_sent += (size_t)n;
+        return true;
+    }
 
-            flagship_end_flag(fls);
+    if(c->body) {
+        char   chunk[HTTP_CHUNK];
+        long   at   = ftell(c->body);
+        size_t read = fread(chunk, 1, sizeof(chunk), c->body);
+        if(read) {
+            ssize_t n = send(c->fd, chunk, read, MSG_NOSIGNAL);
+            if(n < 0) {
+                return errno == EAGAIN || errno == EWOULDBLOCK;
+            }
+            // rewind whatever the socket didn't take
+            fseek(c->body, at + n, SEEK_SET);
+            return true;
         }
+        fclose(c->body);
+        c->body = NULL;
+    }
 
-        flagship_begin_flag(fls, FLAGSHIP_TYPE_ENUM); {
-            flagship_name(fls, "rebuild");
-            flagship_name(fls, "r");
+    // response done
+    c->header_len = c->header_sent = 0;
+    return c->keep_alive;
+}
 
-            flagship_description(fls, "force rebuilding given target");
+int http_listen(struct HttpServer *s) {
+    s->listen_fd = socket(AF_INET, SOCK_STREAM, 0);
+    if(s->listen_fd < 0) {
+        return error(E_SERVER, "socket", errno);
+    }
 
-            for(enum RebuildTarget r = REBUILD_BEGIN; r < REBUILD_COUNT; ++r) {
-                flagship_enum_variant(fls, "%s", REBUILD_NAMES[r]);
-            }
+    int yes = 1;
+    setsockopt(s->listen_fd, SOL_SOCKET, SO_REUSEADDR, &yes, sizeof(yes));
 
-            flagship_is_repeatable(fls, true);
-            flagship_end_flag(fls);
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family      = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+    // NOTE(alicia): try the next port if another server is already running
+    for(int port = HTTP_PORT_FIRST; port < HTTP_PORT_FIRST + HTTP_PORT_COUNT; ++port) {
+        addr.sin_port = htons((uint16_t)port);
+        if(bind(s->listen_fd, (struct sockaddr *)&addr, sizeof(addr)) == 0) {
+            s->port = port;
+            break;
         }
+    }
+    if(!s->port) {
+        close(s->listen_fd);
+        return error(E_SERVER, "bind", errno);
+    }
 
-        flagship_begin_flag(fls, FLAGSHIP_TYPE_ENUM); {
-            flagship_name(fls, "skip-rebuild");
-            flagship_name(fls, "sr");
+    if(listen(s->listen_fd, 32) || fcntl(s->listen_fd, F_SETFL, O_NONBLOCK)) {
+        close(s->listen_fd);
+        return error(E_SERVER, "listen", errno);
+    }
 
-            flagship_description(fls, "skip rebuilding given target");
+    return E_NONE;
+}
 
-            for(enum RebuildTarget r = REBUILD_BEGIN; r < REBUILD_COUNT; ++r) {
-                flagship_enum_variant(fls, "%s", REBUILD_NAMES[r]);
-            }
+// serve root until interrupted, or until the page is ready when headless
+int http_serve(const char *root, bool headless) {
+    int ec = E_NONE;
 
-            flagship_is_repeatable(fls, true);
-            flagship_end_flag(fls);
+    struct HttpServer *s = (struct HttpServer *)calloc(1, sizeof(*s));
+    if(!s) {
+        return error(E_SERVER, "calloc", errno);
+    }
+    s->root     = root;
+    s->headless = headless;
+
+    if((ec = http_listen(s))) {
+        free(s);
+        return ec;
+    }
+
+    const char *url = STR.ptr + str_push(local_fmt("http://localhost:%d/index.html", s->port));
+    CB_INFO("serving %s at %s", root, url);
+
+    // NOTE(alicia): listening socket is ready before the browser starts,
+    // no need to wait for the server to spin up.
+    if(!headless) {
+        cmd_reset(&CMD);
+        CB_CMD_APPEND(&CMD, "xdg-open", url);
+        if(CB_EXEC(CMD.cmd, .group=&PG)) {
+            ec = error(E_EXEC_ASYNC, "xdg-open");
         }
+        CB_INFO("to close server, press Ctrl+C");
+    } else {
+        CB_INFO("waiting for page to report first frame . . .");
+    }
 
-        flagship_begin_flag(fls, FLAGSHIP_TYPE_ENUM); {
-            flagship_name(fls, "enable");
-            flagship_description(fls, "enable an option");
-            flagship_note(fls, "some of these options are only valid for a specific target");
+    signal(SIGINT,  http_stop_signal);
+    signal(SIGTERM, http_stop_signal);
+    signal(SIGPIPE, SIG_IGN);
+
+    struct pollfd fds[HTTP_MAX_CONNECTIONS + 1];
+    while(!ec && !HTTP_STOP && !(headless && s->ready)) {
+        fds[0].fd     = s->listen_fd;
+        fds[0].events = s->conn_count < HTTP_MAX_CONNECTIONS ? POLLIN : 0;
+        for(size_t i = 0; i < s->conn_count; ++i) {
+            struct HttpConnection *c = s->conn + i;
+            fds[i + 1].fd     = c->fd;
+            fds[i + 1].events = c->header_len ? POLLOUT : POLLIN;
+        }
 
-            for(enum EnableOpt e = ENABLE_OPT_BEGIN; e < ENABLE_OPT_COUNT; ++e) {
-                flagship_enum_variant(fls, "%s", ENABLE_OPT_NAMES[e]);
+        int count = poll(fds, s->conn_count + 1, 250);
+        if(count < 0) {
+            if(errno != EINTR) {
+                ec = error(E_SERVER, "poll", errno);
             }
-
-            flagship_is_repeatable(fls, true);
-            flagship_end_flag(fls);
+            continue;
         }
 
-        flagship_begin_flag(fls, FLAGSHIP_TYPE_ENUM); {
-            flagship_name(fls, "disable");
-            flagship_description(fls, "disable an option");
-            flagship_note(fls, "some of these options are only valid for a specific target");
+        // NOTE(alicia): iterate backwards, closing swaps the last connection in
+        size_t polled = s->conn_count;
+        for(size_t i = polled; i-- > 0;) {
+            short revents = fds[i + 1].revents;
+            if(!revents) {
+                continue;
+            }
 
-            for(enum EnableOpt e = ENABLE_OPT_BEGIN; e < ENABLE_OPT_COUNT; ++e) {
-                flagship_enum_variant(fls, "%s", ENABLE_OPT_NAMES[e]);
+            struct HttpConnection *c = s->conn + i;
+            bool open = true;
+            if(revents & (POLLERR | POLLNVAL)) {
+                open = false;
+            } else if(revents & POLLOUT) {
+                open = http_write(c);
+            } else if(revents & (POLLIN | POLLHUP)) {
+                open = http_read(s, c);
             }
 
-            flagship_is_repeatable(fls, true);
-            flagship_end_flag(fls);
+            if(!open) {
+                http_close(s, i);
+            }
         }
 
-        flagship_begin_flag(fls, FLAGSHIP_TYPE_BOOL); {
-            flagship_name(fls, "help");
-            flagship_name(fls, "h");
-
-            flagship_description(fls, "print help and exit");
+        if(fds[0].revents & POLLIN) {
+            int fd;
+            while(s->conn_count < HTTP_MAX_CONNECTIONS &&
+                (fd = accept(s->listen_fd, NULL, NULL)) >= 0
+            ) {
+                fcntl(fd, F_SETFL, O_NONBLOCK);
 
-            flagship_is_terminating(fls, true);
-            flagship_end_flag(fls);
+                struct HttpConnection *c = s->conn + s->conn_count++;
+                memset(c, 0, sizeof(*c));
+                c->fd = fd;
+            }
         }
+    }
 
-        flagship_end_mode(fls);
+    for(size_t i = s->conn_count; i-- > 0;) {
+        http_close(s, i);
     }
+    close(s->listen_fd);
+    free(s);
 
-    flagship_begin_mode(fls); {
-        flagship_name(fls, "%s", MODE_NAMES[M_RUN]);
-        flagship_description(fls, "build and run project");
+    signal(SIGINT,  SIG_DFL);
+    signal(SIGTERM, SIG_DFL);
+    signal(SIGPIPE, SIG_DFL);
 
-        flagship_copy(fls, MODE_NAMES[M_BUILD], "target");
-        flagship_copy(fls, MODE_NAMES[M_BUILD], "optimized");
-        flagship_copy(fls, MODE_NAMES[M_BUILD], "strip-symbols");
-        flagship_copy(fls, MODE_NAMES[M_BUILD], "enable");
-        flagship_copy(fls, MODE_NAMES[M_BUILD], "disable");
-        flagship_copy(fls, MODE_NAMES[M_BUILD], "rebuild");
-        flagship_copy(fls, MODE_NAMES[M_BUILD], "skip-rebuild");
+    proc_group_join(&PG, CB_WAIT_INF);
+    return ec;
+}
 
-        flagship_begin_flag(fls, FLAGSHIP_TYPE_BOOL); {
-            flagship_name(fls, "-");
-            flagship_description(fls, "pass remaining arguments to project process");
-            flagship_is_terminating(fls, true);
+#else /* _WIN32 */
 
-            flagship_end_flag(fls);
-        }
+int http_serve(const char *root, bool headless) {
+    (void)root;
+    (void)headless;
+    return error(E_UNIMPLEMENTED, "local wasm server on windows");
+}
 
-        flagship_copy(fls, MODE_NAMES[M_BUILD], "help");
+#endif /* !_WIN32 */
 
-        flagship_end_mode(fls);
+int mode_run(struct OptionRun *opt) {
+    int ec = E_NONE;
+
+    int target_count = 0;
+    for(enum Target t = T_BEGIN + 1; t < T_COUNT; ++t) {
+        target_count += target_selected(&opt->build, t) ? 1 : 0;
+    }
+    if(target_count != 1) {
+        return error(E_RUN_TARGETS, target_count);
     }
 
-    flagship_begin_mode(fls); {
-        flagship_name(fls, "%s", MODE_NAMES[M_PKG]);
-        flagship_description(fls, "build project and package for distribution");
+    // build
+    if((ec = mode_build(&opt->build))) {
+        return ec;
+    }
 
-        flagship_copy(fls, MODE_NAMES[M_BUILD], "target");
-        flagship_copy(fls, MODE_NAMES[M_BUILD], "enable");
-        flagship_copy(fls, MODE_NAMES[M_BUILD], "disable");
+    CB_INFO("running %s . . .", project_display_name());
 
-        flagship_copy(fls, MODE_NAMES[M_BUILD], "help");
+    cmd_reset(&CMD);
 
-        flagship_end_mode(fls);
-    }
+    int exit_code = 0;
+    switch(CB_OS_CURRENT) {
+        case CB_OS_GNU_LINUX: switch(opt->build.target) {
+            case T_LINUX:
+                cmd_add(&CMD,
+                local_fmt("%s/%s%s",
+                    build_dir(opt->build.target), program_name(opt->build.target),
+                    program_ext(opt->build.target)));
 
-    return ec;
-}
+                for(size_t i = 0; i < opt->passthrough.len; ++i) {
+                    cmd_add(&CMD, opt->passthrough.ptr[i]);
+                }
 
-const char *project_display_name(void) {
-    if(!PROJECT_DISPLAY_NAME) {
-        ini_parser_begin_section(&INI, "project");
-        const char *dp = ini_parser_read_string(&INI, "display-name");
-        ini_parser_end_section(&INI);
+                if((exit_code = CB_EXEC(CMD.cmd))) {
+                    return error(E_PROC_FAIL, CMD.cmd.ptr[0], exit_code);
+                }
+                break;
+            case T_WINDOWS:
+                if((ec = proc_check("wine"))) {
+                    return ec;
+                }
+                cmd_add(&CMD, "wine");
 
-        size_t dp_len = strlen(dp);
+                cmd_add(&CMD,
+                local_fmt("%s/%s%s",
+                    build_dir(opt->build.target), program_name(opt->build.target),
+                    program_ext(opt->build.target)));
 
-        PROJECT_DISPLAY_NAME = STR.len;
-        CB_BUF_RESERVE(&STR, dp_len + 1);
-        CB_BUF_APPEND(&STR, dp, dp_len + 1);
+                for(size_t i = 0; i < opt->passthrough.len; ++i) {
+                    cmd_add(&CMD, opt->passthrough.ptr[i]);
+                }
+
+                if((exit_code = CB_EXEC(CMD.cmd))) {
+                    return error(E_PROC_FAIL, CMD.cmd.ptr[0], exit_code);
+                }
+                break;
+            case T_MACOS:
+                return error(E_NO_RUN_SUPPORT, CB_OS_CURRENT, opt->build.target);
+            case T_WASM:
+                if(!opt->headless && (ec = proc_check("xdg-open"))) {
+                    return ec;
+                }
+
+                ec = http_serve(build_dir(opt->build.target), opt->headless);
+                break;
+
+            case T_NATIVE:
+            case T_COUNT:
+                break;
+        } break;
+        case CB_OS_WINDOWS:
+        case CB_OS_MACOS:
+        default:
+            break;
     }
-    return STR.ptr + PROJECT_DISPLAY_NAME;
+
+    return ec;
 }
-const char *program_name(enum Target target) {
-    if(target == T_WASM) {
-        return "index";
+struct PkgDiffParams {
+    CStringBuf add;
+    CStringBuf remove;
+};
+void pkg_diff(const char *path, enum ManifestChange change, void *in_params) {
+    struct PkgDiffParams *params = (struct PkgDiffParams *)in_params;
+    switch(change) {
+        case MC_ADDED:
+        case MC_MODIFIED:
+            CB_BUF_PUSH(&params->add, path);
+            break;
+        case MC_REMOVED:
+            CB_BUF_PUSH(&params->remove, path);
+            break;
     }
+}
+bool is_resource_path(const char *path) {
+    return strncmp(path, "resources", sizeof("resources") - 1) == 0 &&
+        (path[sizeof("resources") - 1] == '/' || path[sizeof("resources") - 1] == '\\');
+}
 
-    if(!PROGRAM_NAME) {
-        ini_parser_begin_section(&INI, "project");
-        const char *pn = ini_parser_read_string(&INI, "program-name");
-        ini_parser_end_section(&INI);
-
-        size_t pn_len = strlen(pn);
+#define ZIP_CHUNK 256
 
-        PROGRAM_NAME = STR.len;
+enum ZipOp {
+    ZIP_STORE,
+    ZIP_DEFLATE,
+    ZIP_DELETE,
+};
 
-        if(!pn_len) {
-            CB_BUF_PUSH(&STR, '_');
-        }
+// queue adding or removing paths (relative to wd) from zip archive (relative to wd)
+void zip_paths(
+    enum Target target, const char *wd, const char *archive, enum ZipOp op,
+    size_t count, const char **paths
+) {
+    const char *tool = zip_tool();
+    bool seven_zip   = strcmp(tool, "zip") != 0;
 
-        switch(*pn) {
-            case '0' ... '9':
-                CB_BUF_PUSH(&STR, '_');
-                break;
-            default:
-                break;
-        }
+    for(size_t i = 0; i < count; i += ZIP_CHUNK) {
+        cmd_reset(&CMD);
+        cmd_add(&CMD, tool);
 
-        for(size_t i = 0; i < pn_len; ++i) {
-            String str;
-            memset(&str, 0, sizeof(str));
-            switch(pn[i]) {
-                case '!':
-                    str = CB_STRING("_bang_");
-                    break;
-                case '@':
-                    str = CB_STRING("_at_");
-                    break;
-                case '#':
-                    str = CB_STRING("_hash_");
-                    break;
-                case '$':
-                    str = CB_STRING("_dollar_");
-                    break;
-                case '%':
-                    str = CB_STRING("_percent_");
-                    break;
-                case '^':
-                    str = CB_STRING("_hat_");
-                    break;
-                case '&':
-                    str = CB_STRING("_and_");
+        if(seven_zip) {
+            // NOTE(alicia): 7z deflates with one thread per core
+            switch(op) {
+                case ZIP_STORE:
+                    CB_CMD_APPEND(&CMD, "a", "-tzip", "-mx=0");
                     break;
-                case '*':
-                    str = CB_STRING("_star_");
+                case ZIP_DEFLATE:
+                    CB_CMD_APPEND(&CMD, "a", "-tzip", "-mmt=on",
+                        local_fmt("-mx=%d", package_compression_level(9)));
                     break;
-                case '(':
-                    str = CB_STRING("_paren_open_");
+                case ZIP_DELETE:
+                    CB_CMD_APPEND(&CMD, "d", "-tzip");
                     break;
-                case ')':
-                    str = CB_STRING("_parent_close_");
+            }
+            CB_CMD_APPEND(&CMD, "-bso0", "-bsp0");
+        } else {
+            cmd_add(&CMD, "-q");
+            switch(op) {
+                case ZIP_STORE:
+                    cmd_add(&CMD, "-0");
                     break;
-                case '+':
-                    str = CB_STRING("_plus_");
+                case ZIP_DEFLATE:
+                    cmd_add(&CMD, local_fmt("-%d", package_compression_level(9)));
                     break;
-                case '=':
-                    str = CB_STRING("_eq_");
+                case ZIP_DELETE:
+                    cmd_add(&CMD, "-d");
+                    break;
+            }
+        }
+        cmd_add(&CMD, archive);
+
+        for(size_t j = i; j < count && j < (i + ZIP_CHUNK); ++j) {
+            cmd_add(&CMD, paths[j]);
+        }
+
+        chain_push(target, wd, local_fmt("%s %s", tool, archive));
+    }
+}
+
+// resources are relative to project root, everything else is relative to wd.
+void zip_list(enum Target target, const char *wd, const char *archive,
+    const char *archive_from_wd, enum ZipOp op, CStringBuf *list
+) {
+    CStringBuf res, other;
+    memset(&res, 0, sizeof(res));
+    memset(&other, 0, sizeof(other));
+
+    for(size_t i = 0; i < list->len; ++i) {
+        if(is_resource_path(list->ptr[i])) {
+            CB_BUF_PUSH(&res, list->ptr[i]);
+        } else {
+            CB_BUF_PUSH(&other, list->ptr[i]);
+        }
+    }
+
+    if(res.len) {
+        zip_paths(target, NULL, archive, op, res.len, res.ptr);
+    }
+    if(other.len) {
+        zip_paths(target, wd, archive_from_wd, op, other.len, other.ptr);
+    }
+
+    CB_BUF_FREE(&res);
+    CB_BUF_FREE(&other);
+}
+
+// queue syncing zip archive with files that changed since last package.
+// returns false if archive is up to date.
+bool zip_sync(enum Target target, const char *wd, const char *archive,
+    const char *archive_from_wd, struct Manifest *cur, const char *snapshot
+) {
+    struct Manifest prev;
+    memset(&prev, 0, sizeof(prev));
+
+    if(path_exists(archive)) {
+        if(!manifest_load(snapshot, &prev)) {
+            // NOTE(alicia): don't know what's in this archive, start over.
+            remove(archive);
+        }
+    }
+
+    struct PkgDiffParams params;
+    memset(&params, 0, sizeof(params));
+
+    CStringBuf store, deflate;
+    memset(&store, 0, sizeof(store));
+    memset(&deflate, 0, sizeof(deflate));
+
+    bool changed = manifest_diff(cur, &prev, pkg_diff, &params) != 0;
+
+    // already compressed files are stored as-is
+    for(size_t i = 0; i < params.add.len; ++i) {
+        if(package_is_stored(params.add.ptr[i])) {
+            CB_BUF_PUSH(&store, params.add.ptr[i]);
+        } else {
+            CB_BUF_PUSH(&deflate, params.add.ptr[i]);
+        }
+    }
+
+    if(params.remove.len) {
+        zip_list(target, wd, archive, archive_from_wd, ZIP_DELETE, &params.remove);
+    }
+    if(store.len) {
+        zip_list(target, wd, archive, archive_from_wd, ZIP_STORE, &store);
+    }
+    if(deflate.len) {
+        zip_list(target, wd, archive, archive_from_wd, ZIP_DEFLATE, &deflate);
+    }
+
+    CB_BUF_FREE(&store);
+    CB_BUF_FREE(&deflate);
+    CB_BUF_FREE(&params.add);
+    CB_BUF_FREE(&params.remove);
+    manifest_free(&prev);
+    return changed;
+}
+
+// write stripped copy of project to build/<target>/pkg.
+// out_dir is set to offset into STR of directory containing executable to package.
+int pkg_strip(enum Target target, size_t *out_dir) {
+    int ec = E_NONE;
+
+    const char *tool = objcopy(target);
+    if(!tool) {
+        // NOTE(alicia): built without symbols, see build_strips
+        *out_dir = str_push(build_dir(target));
+        return ec;
+    }
+
+    *out_dir = str_push(local_fmt("%s/pkg", build_dir(target)));
+    if((ec = makedir(STR.ptr + *out_dir))) {
+        return ec;
+    }
+
+    const char *exe = local_fmt("%s/%s%s",
+        build_dir(target), program_name(target), program_ext(target));
+
+    // NOTE(alicia): split-debug builds are already stripped of debug info and linked
+    // to their .debug (see mode_build_split_debug), it can't be made again from them.
+    bool linked = exe_has_debuglink(exe);
+
+    int exit_code = 0;
+    if(!linked && path_older(local_fmt("%s.debug", exe), exe)) {
+        cmd_reset(&CMD);
+        CB_CMD_APPEND(&CMD, tool, "--only-keep-debug", exe, local_fmt("%s.debug", exe));
+        if((exit_code = CB_EXEC(CMD.cmd))) {
+            return error(E_PROC_FAIL, tool, exit_code);
+        }
+    }
+
+    exe = local_fmt("%s/%s%s",
+        build_dir(target), program_name(target), program_ext(target));
+
+    // NOTE(alicia): --strip-all keeps an existing debuglink
+    cmd_reset(&CMD);
+    CB_CMD_APPEND(&CMD, tool, "--strip-all");
+    if(!linked) {
+        cmd_add(&CMD, local_fmt("--add-gnu-debuglink=%s.debug", exe));
+    }
+    CB_CMD_APPEND(&CMD, exe,
+        local_fmt("%s/%s%s", STR.ptr + *out_dir, program_name(target), program_ext(target)));
+    if((exit_code = CB_EXEC(CMD.cmd))) {
+        return error(E_PROC_FAIL, tool, exit_code);
+    }
+
+    CB_INFO("debug info for %s package at %s.debug", target_name(target), exe);
+    return ec;
+}
+
+// NOTE(alicia): loads the wasm with streaming compilation, the data and wasm
+// files are preloaded so they download while index.js is parsed.
+const char *WASM_PKG_MODULE =
+    "            locateFile: (path) => FILES[path] || path,\n"
+    "            instantiateWasm: (imports, done) => {\n"
+    "                const url = FILES['index.wasm'];\n"
+    "                const fallback = () => fetch(url)\n"
+    "                    .then((res) => res.arrayBuffer())\n"
+    "                    .then((bytes) => WebAssembly.instantiate(bytes, imports));\n"
+    "                const result = WebAssembly.instantiateStreaming ?\n"
+    "                    WebAssembly.instantiateStreaming(fetch(url), imports).catch(fallback) :\n"
+    "                    fallback();\n"
+    "                result.then((r) => done(r.instance, r.module));\n"
+    "                return {};\n"
+    "            },\n";
+
+// files renamed with a content hash in wasm packages
+const char *WASM_HASHED_FILES[] = {
+    "index.js", "index.wasm", "index.data", "index.worker.js"
+};
+
+// collect files in a directory that aren't in keep
+DirWalkAction pkg_files_walk(const char *path, DirWalkInfo *info, void *in_params) {
+    struct PkgFilesParams *params = (struct PkgFilesParams *)in_params;
+
+    if(info->file_type != FT_FILE) {
+        return DWA_CONTINUE;
+    }
+
+    const char *name = strrchr(path, '/');
+    name = name ? name + 1 : path;
+
+    // precompressed files belong to the file they were made from
+    size_t len = strlen(name);
+    const char *ext = path + info->path_ext_offset;
+    if(strcmp(ext, ".br") == 0 || strcmp(ext, ".gz") == 0) {
+        len -= 3;
+    }
+
+    for(size_t i = 0; i < params->keep_count; ++i) {
+        const char *keep = STR.ptr + params->keep[i];
+        if(strlen(keep) == len && strncmp(keep, name, len) == 0) {
+            return DWA_CONTINUE;
+        }
+    }
+
+    size_t found = str_push(path);
+    CB_BUF_PUSH(&params->found, found);
+    return DWA_CONTINUE;
+}
+bool file_copy_bytes(const char *src, const char *dst) {
+    uint8_t *data = NULL;
+    size_t   len  = 0;
+    if(!file_read_all(src, &data, &len)) {
+        return false;
+    }
+
+    FILE *f = fopen(dst, "wb");
+    bool success = f && fwrite(data, 1, len, f) == len;
+    if(f) {
+        fclose(f);
+    }
+
+    free(data);
+    return success;
+}
+
+// fill build/wasm/pkg with content-hashed outputs, a loader index.html and
+// precompressed .br/.gz siblings
+int pkg_wasm(struct OptionPkg *opt, size_t *out_dir) {
+    int ec = E_NONE;
+    enum Target target = T_WASM;
+
+    *out_dir = str_push(local_fmt("%s/pkg", build_dir(target)));
+    if((ec = makedir(STR.ptr + *out_dir))) {
+        return ec;
+    }
+
+    // names of files in pkg and names of files to hash, offsets into STR
+    struct { size_t cap; size_t len; size_t *ptr; } files, names;
+    memset(&files, 0, sizeof(files));
+    memset(&names, 0, sizeof(names));
+
+    ByteBuf map, preload;
+    memset(&map, 0, sizeof(map));
+    memset(&preload, 0, sizeof(preload));
+
+    for(size_t i = 0; i < CB_ARRAY_LEN(WASM_HASHED_FILES); ++i) {
+        size_t name = str_push(WASM_HASHED_FILES[i]);
+        CB_BUF_PUSH(&names, name);
+    }
+    // NOTE(alicia): lazy asset groups are found through locateFile too
+    for(size_t i = 1; i < ASSET_GROUPS.len; ++i) {
+        if(!ASSET_GROUPS.ptr[i].boot) {
+            size_t name = str_push(local_fmt("group-%s.js", STR.ptr + ASSET_GROUPS.ptr[i].name));
+            CB_BUF_PUSH(&names, name);
+            name = str_push(local_fmt("group-%s.data", STR.ptr + ASSET_GROUPS.ptr[i].name));
+            CB_BUF_PUSH(&names, name);
+        }
+    }
+
+    size_t script = 0;
+    for(size_t i = 0; i < names.len; ++i) {
+        const char *name = STR.ptr + names.ptr[i];
+        const char *src  = local_fmt("%s/%s", build_dir(target), name);
+        if(!path_exists(src)) {
+            continue;
+        }
+
+        uint64_t hash = 0;
+        if(!file_hash(src, &hash)) {
+            ec = error(E_FILE_OPEN, src);
+            goto cleanup;
+        }
+
+        // index.wasm -> index.0123456789ab.wasm
+        const char *ext = strrchr(name, '.');
+        size_t hashed = str_push(local_fmt("%.*s.%012" PRIx64 "%s",
+            (int)(ext - name), name, hash & 0xFFFFFFFFFFFF, ext));
+        CB_BUF_PUSH(&files, hashed);
+        name = STR.ptr + names.ptr[i];
+
+        const char *dst = local_fmt("%s/%s", STR.ptr + *out_dir, STR.ptr + hashed);
+        if(!path_exists(dst)) {
+            src = local_fmt("%s/%s", build_dir(target), name);
+            if(!file_copy_bytes(src, dst)) {
+                ec = error(E_FILE_CREATE, dst);
+                goto cleanup;
+            }
+        }
+
+        string_buf_fmt(&map, "            '%s': '%s',\n", name, STR.ptr + hashed);
+
+        if(strcmp(name, "index.js") == 0) {
+            script = hashed;
+        } else if(strcmp(name, "index.wasm") == 0 || strcmp(name, "index.data") == 0) {
+            string_buf_fmt(&preload,
+                "    <link rel=\"preload\" href=\"%s\" as=\"fetch\" type=\"%s\" crossorigin>\n",
+                STR.ptr + hashed,
+                strcmp(name, "index.wasm") == 0 ? "application/wasm" : "application/octet-stream");
+        }
+    }
+    if(!script) {
+        ec = error(E_FILE_OPEN, local_fmt("%s/index.js", build_dir(target)));
+        goto cleanup;
+    }
+
+    bool threads = read_enable(&opt->build, ENABLE_WASM_THREADS);
+    if(threads) {
+        size_t sw = str_push("coi-serviceworker.js");
+        if(!file_copy_bytes(
+            local_fmt("%s/%s", build_dir(target), STR.ptr + sw),
+            local_fmt("%s/%s", STR.ptr + *out_dir, STR.ptr + sw))
+        ) {
+            ec = error(E_FILE_CREATE, local_fmt("%s/%s", STR.ptr + *out_dir, STR.ptr + sw));
+            goto cleanup;
+        }
+        CB_BUF_PUSH(&files, sw);
+    }
+
+    // index.html is the only file that isn't cached forever
+    size_t html = str_push("index.html");
+    CB_BUF_PUSH(&files, html);
+    {
+        const char *path = local_fmt("%s/index.html", STR.ptr + *out_dir);
+        FILE *f = fopen(path, "wb");
+        if(!f) {
+            ec = error(E_FILE_CREATE, path);
+            goto cleanup;
+        }
+
+        CB_BUF_PUSH(&map, 0);
+        CB_BUF_PUSH(&preload, 0);
+
+        ByteBuf *head = local_buf();
+        string_buf_fmt(head, "%s", preload.ptr);
+        if(threads) {
+            string_buf_fmt(head, "%s", WASM_COI_REGISTER);
+        }
+        string_buf_fmt(head, "    <script>\n        const FILES = {\n%s        };\n    </script>\n", map.ptr);
+        CB_BUF_PUSH(head, 0);
+
+        fprintf(f, WASM_SHELL, project_display_name(), head->ptr, WASM_PKG_MODULE,
+            local_fmt("    <script async src=\"%s\"></script>\n", STR.ptr + script));
+        fclose(f);
+    }
+
+    // remove files from older packages,
+    // NOTE(alicia): after walking, not while the directory is open
+    struct PkgFilesParams clean;
+    memset(&clean, 0, sizeof(clean));
+    clean.keep       = files.ptr;
+    clean.keep_count = files.len;
+    dir_walk(STR.ptr + *out_dir, pkg_files_walk, &clean);
+    for(size_t i = 0; i < clean.found.len; ++i) {
+        remove(STR.ptr + clean.found.ptr[i]);
+    }
+    CB_BUF_FREE(&clean.found);
+
+    // precompress, hashed files only need it once
+    const char *compressors[] = { "brotli", "gzip" };
+    const char *extensions[]  = { ".br",    ".gz" };
+    for(size_t c = 0; c < CB_ARRAY_LEN(compressors) && !ec; ++c) {
+        if(!proc_exists(compressors[c])) {
+            CB_INFO("%s not found, skipping %s files", compressors[c], extensions[c]);
+            continue;
+        }
+        for(size_t i = 0; i < files.len; ++i) {
+            const char *name = STR.ptr + files.ptr[i];
+            if(files.ptr[i] != html && path_exists(
+                local_fmt("%s/%s%s", STR.ptr + *out_dir, name, extensions[c]))
+            ) {
+                continue;
+            }
+
+            cmd_reset(&CMD);
+            if(c == 0) {
+                CB_CMD_APPEND(&CMD, "brotli", "-f", "-k", "-q", "11", name);
+            } else {
+                CB_CMD_APPEND(&CMD, "gzip", "-f", "-k", "-9", "-n", name);
+            }
+
+            if((ec = job_exec(STR.ptr + *out_dir, local_fmt("%s %s", compressors[c], name)))) {
+                break;
+            }
+        }
+    }
+    if(!ec) {
+        ec = job_join();
+    }
+
+cleanup:
+    CB_BUF_FREE(&files);
+    CB_BUF_FREE(&names);
+    CB_BUF_FREE(&map);
+    CB_BUF_FREE(&preload);
+    return ec;
+}
+
+struct PkgTarget {
+    // NOTE(alicia): everything that goes into the package,
+    // compared against a snapshot from the last package.
+    struct Manifest manifest;
+
+    size_t archive;  // offset into STR
+    size_t snapshot; // offset into STR
+    bool   queued;
+};
+
+// queue packaging commands for opt->build.target into its chain
+int mode_pkg_target(struct OptionPkg *opt, struct PkgTarget *pkg) {
+    int ec = E_NONE;
+    enum Target target = opt->build.target;
+
+    // NOTE(alicia): STR may move when pushing, always read through offsets
+    pkg->snapshot = str_push(local_fmt("%s/pkg.manifest", build_dir(target)));
+
+    cmd_reset(&CMD);
+    switch(target) {
+        case T_LINUX: {
+            // uses tar
+            if((ec = proc_check("tar"))) {
+                break;
+            }
+
+            const char *compressor = package_compression();
+            if((ec = proc_check(compressor))) {
+                break;
+            }
+
+            size_t dir = 0;
+            if((ec = pkg_strip(target, &dir))) {
+                break;
+            }
+
+            pkg->archive = str_push(local_fmt("bin/%s-linux-x86_64.tar.%s",
+                program_name(target), strcmp(compressor, "zstd") ? "xz" : "zst"));
+            const char *archive = STR.ptr + pkg->archive;
+
+            if(check_resources()) {
+                manifest_copy(&pkg->manifest, &MANIFEST);
+            }
+            manifest_add_file(&pkg->manifest, program_name(target),
+                local_fmt("%s/%s", STR.ptr + dir, program_name(target)));
+
+            const char *settings = local_fmt("%s/settings.ini", STR.ptr + dir);
+            if(!settings_write(settings)) {
+                ec = error(E_FILE_CREATE, settings);
+                break;
+            }
+            manifest_add_file(&pkg->manifest, "settings.ini", settings);
+
+            // NOTE(alicia): tar can't be updated in place, only skipped when nothing changed
+            struct Manifest prev;
+            memset(&prev, 0, sizeof(prev));
+            bool up_to_date = path_exists(archive) &&
+                manifest_load(STR.ptr + pkg->snapshot, &prev) && !manifest_diff(&pkg->manifest, &prev, NULL, NULL);
+            manifest_free(&prev);
+
+            if(up_to_date) {
+                break;
+            }
+
+            // NOTE(alicia): tar streams into the compressor in one pass,
+            // compressor uses every core with -T0
+            CB_CMD_APPEND(&CMD, "tar", "-cf", archive);
+            int level = package_compression_level(0);
+            if(level) {
+                cmd_add(&CMD,
+                    local_fmt("--use-compress-program=%s -T0 -%d", compressor, level));
+            } else {
+                cmd_add(&CMD, local_fmt("--use-compress-program=%s -T0", compressor));
+            }
+
+            CB_CMD_APPEND(&CMD, local_fmt("--transform=s,^,%s-linux-x86_64/,",
+                program_name(target)));
+
+            CB_CMD_APPEND(&CMD, "-C", STR.ptr + dir, program_name(target), "settings.ini");
+
+            // NOTE(alicia): -C is relative to the previous -C
+            if(check_resources()) {
+                CB_CMD_APPEND(&CMD, "-C", relative_root(STR.ptr + dir), "resources");
+            }
+
+            chain_push(target, NULL, "tar");
+            pkg->queued = true;
+        } break;
+        case T_WINDOWS: {
+            // uses zip or 7z
+            if((ec = proc_check(zip_tool()))) {
+                break;
+            }
+
+            size_t dir = 0;
+            if((ec = pkg_strip(target, &dir))) {
+                break;
+            }
+
+            const char *exe = local_fmt("%s%s", program_name(target), program_ext(target));
+
+            if(check_resources()) {
+                manifest_copy(&pkg->manifest, &MANIFEST);
+            }
+            manifest_add_file(&pkg->manifest, exe, local_fmt("%s/%s", STR.ptr + dir, exe));
+
+            const char *settings = local_fmt("%s/settings.ini", STR.ptr + dir);
+            if(!settings_write(settings)) {
+                ec = error(E_FILE_CREATE, settings);
+                break;
+            }
+            manifest_add_file(&pkg->manifest, "settings.ini", settings);
+
+            pkg->archive = str_push(local_fmt("bin/%s-windows-x64.zip", program_name(target)));
+            const char *archive = STR.ptr + pkg->archive;
+
+            pkg->queued = zip_sync(target, STR.ptr + dir, archive,
+                local_fmt("%s%s", relative_root(STR.ptr + dir), archive),
+                &pkg->manifest, STR.ptr + pkg->snapshot);
+        } break;
+        case T_MACOS: {
+            // uses zip
+            if((ec = proc_check("zip"))) {
+                break;
+            }
+            // TODO(alicia): 
+            ec = error(E_UNIMPLEMENTED, "package macos");
+        } break;
+        case T_WASM: {
+            // uses zip or 7z
+            if((ec = proc_check(zip_tool()))) {
+                break;
+            }
+
+            size_t dir;
+            if((ec = pkg_wasm(opt, &dir))) {
+                break;
+            }
+
+            struct PkgFilesParams files;
+            memset(&files, 0, sizeof(files));
+            dir_walk(STR.ptr + dir, pkg_files_walk, &files);
+            for(size_t i = 0; i < files.found.len; ++i) {
+                const char *path = STR.ptr + files.found.ptr[i];
+                manifest_add_file(&pkg->manifest, path + strlen(STR.ptr + dir) + 1, path);
+            }
+            CB_BUF_FREE(&files.found);
+
+            // NOTE(alicia): we use T_LINUX in order to get actual program name, not index
+            pkg->archive = str_push(local_fmt("bin/%s-wasm.zip", program_name(T_LINUX)));
+            const char *archive = STR.ptr + pkg->archive;
+
+            pkg->queued = zip_sync(target, STR.ptr + dir,
+                archive, local_fmt("%s%s", relative_root(STR.ptr + dir), archive),
+                &pkg->manifest, STR.ptr + pkg->snapshot);
+        } break;
+
+        case T_NATIVE:
+        case T_COUNT:
+            break;
+    }
+
+    return ec;
+}
+
+int mode_pkg(struct OptionPkg *opt) {
+    int ec = E_NONE;
+    if((ec = mode_build(&opt->build))) {
+        return ec;
+    }
+
+    CB_INFO("packaging project . . .");
+
+    if((ec = makedir("bin"))) {
+        return ec;
+    }
+
+    struct PkgTarget pkg[T_COUNT];
+    memset(pkg, 0, sizeof(pkg));
+
+    enum Target first = opt->build.target;
+    for(enum Target t = T_BEGIN + 1; t < T_COUNT && !ec; ++t) {
+        if(target_selected(&opt->build, t)) {
+            opt->build.target = t;
+            ec = mode_pkg_target(opt, pkg + t);
+        }
+    }
+    opt->build.target = first;
+
+    // NOTE(alicia): each target's commands run in order,
+    // different targets package concurrently.
+    bool failed[T_COUNT];
+    memset(failed, 0, sizeof(failed));
+    if(!ec) {
+        ec = chain_run(failed);
+    }
+
+    for(enum Target t = T_BEGIN + 1; t < T_COUNT; ++t) {
+        if(!target_selected(&opt->build, t) || !pkg[t].archive || failed[t]) {
+            manifest_free(&pkg[t].manifest);
+            continue;
+        }
+
+        if(pkg[t].queued) {
+            manifest_write(STR.ptr + pkg[t].snapshot, &pkg[t].manifest);
+            CB_INFO("project packaged at %s", STR.ptr + pkg[t].archive);
+        } else {
+            CB_INFO("%s is up to date", STR.ptr + pkg[t].archive);
+        }
+        manifest_free(&pkg[t].manifest);
+    }
+
+    return ec;
+}
+
+int flagship_define(struct FlagshipContext *fls, const char *proc) {
+    int ec = E_NONE;
+
+    flagship_name(fls, "%s", proc);
+    flagship_description(fls, "build system for raylib project");
+
+    flagship_begin_mode(fls); {
+        flagship_name(fls, "%s", MODE_NAMES[M_HELP]);
+        flagship_description(fls, "print help and exit");
+
+        flagship_begin_flag(fls, FLAGSHIP_TYPE_ENUM); {
+            flagship_description(fls, "mode to print help for");
+            for(int m = M_BEGIN; m < M_COUNT; ++m) {
+                flagship_enum_variant(fls, "%s", MODE_NAMES[m]);
+            }
+
+            flagship_is_terminating(fls, true);
+            flagship_end_flag(fls);
+        }
+
+        flagship_end_mode(fls);
+    }
+
+    flagship_begin_mode(fls); {
+        flagship_name(fls, "%s", MODE_NAMES[M_BUILD]);
+        flagship_description(fls, "build project");
+
+        flagship_begin_flag(fls, FLAGSHIP_TYPE_ENUM); {
+            flagship_name(fls, "target");
+            flagship_name(fls, "t");
+
+            flagship_description(fls, "set target platform");
+            flagship_note(fls, "can be repeated to build for multiple targets at once");
+
+            for(enum Target t = T_BEGIN; t < T_COUNT; ++t) {
+                flagship_enum_variant(fls, "%s", TARGET_NAMES[t]);
+            }
+            flagship_enum_variant(fls, "all");
+
+            flagship_default(fls, "%s", TARGET_NAMES[target_normalize(T_NATIVE)]);
+
+            flagship_is_repeatable(fls, true);
+            flagship_end_flag(fls);
+        }
+
+        flagship_begin_flag(fls, FLAGSHIP_TYPE_BOOL); {
+            flagship_name(fls, "optimized");
+            flagship_name(fls, "o");
+
+            flagship_description(fls, "build with optimizations turned on");
+
+            flagship_end_flag(fls);
+        }
+
+        flagship_begin_flag(fls, FLAGSHIP_TYPE_BOOL); {
+            flagship_name(fls, "strip-symbols");
+            flagship_name(fls, "s");
+
+            flagship_description(fls, "strip debug symbols");
+
+            flagship_end_flag(fls);
+        }
+
+        flagship_begin_flag(fls, FLAGSHIP_TYPE_ENUM); {
+            flagship_name(fls, "rebuild");
+            flagship_name(fls, "r");
+
+            flagship_description(fls, "force rebuilding given target");
+
+            for(enum RebuildTarget r = REBUILD_BEGIN; r < REBUILD_COUNT; ++r) {
+                flagship_enum_variant(fls, "%s", REBUILD_NAMES[r]);
+            }
+
+            flagship_is_repeatable(fls, true);
+            flagship_end_flag(fls);
+        }
+
+        flagship_begin_flag(fls, FLAGSHIP_TYPE_ENUM); {
+            flagship_name(fls, "skip-rebuild");
+            flagship_name(fls, "sr");
+
+            flagship_description(fls, "skip rebuilding given target");
+
+            for(enum RebuildTarget r = REBUILD_BEGIN; r < REBUILD_COUNT; ++r) {
+                flagship_enum_variant(fls, "%s", REBUILD_NAMES[r]);
+            }
+
+            flagship_is_repeatable(fls, true);
+            flagship_end_flag(fls);
+        }
+
+        flagship_begin_flag(fls, FLAGSHIP_TYPE_ENUM); {
+            flagship_name(fls, "enable");
+            flagship_description(fls, "enable an option");
+            flagship_note(fls, "some of these options are only valid for a specific target");
+
+            for(enum EnableOpt e = ENABLE_OPT_BEGIN; e < ENABLE_OPT_COUNT; ++e) {
+                flagship_enum_variant(fls, "%s", ENABLE_OPT_NAMES[e]);
+            }
+
+            flagship_is_repeatable(fls, true);
+            flagship_end_flag(fls);
+        }
+
+        flagship_begin_flag(fls, FLAGSHIP_TYPE_ENUM); {
+            flagship_name(fls, "disable");
+            flagship_description(fls, "disable an option");
+            flagship_note(fls, "some of these options are only valid for a specific target");
+
+            for(enum EnableOpt e = ENABLE_OPT_BEGIN; e < ENABLE_OPT_COUNT; ++e) {
+                flagship_enum_variant(fls, "%s", ENABLE_OPT_NAMES[e]);
+            }
+
+            flagship_is_repeatable(fls, true);
+            flagship_end_flag(fls);
+        }
+
+        flagship_begin_flag(fls, FLAGSHIP_TYPE_BOOL); {
+            flagship_name(fls, "help");
+            flagship_name(fls, "h");
+
+            flagship_description(fls, "print help and exit");
+
+            flagship_is_terminating(fls, true);
+            flagship_end_flag(fls);
+        }
+
+        flagship_end_mode(fls);
+    }
+
+    flagship_begin_mode(fls); {
+        flagship_name(fls, "%s", MODE_NAMES[M_RUN]);
+        flagship_description(fls, "build and run project");
+
+        flagship_copy(fls, MODE_NAMES[M_BUILD], "target");
+        flagship_copy(fls, MODE_NAMES[M_BUILD], "optimized");
+        flagship_copy(fls, MODE_NAMES[M_BUILD], "strip-symbols");
+        flagship_copy(fls, MODE_NAMES[M_BUILD], "enable");
+        flagship_copy(fls, MODE_NAMES[M_BUILD], "disable");
+        flagship_copy(fls, MODE_NAMES[M_BUILD], "rebuild");
+        flagship_copy(fls, MODE_NAMES[M_BUILD], "skip-rebuild");
+
+        flagship_begin_flag(fls, FLAGSHIP_TYPE_BOOL); {
+            flagship_name(fls, "headless");
+            flagship_description(fls, "serve wasm build without opening a browser");
+            flagship_note(fls, "exits once the page reports its first frame");
+
+            flagship_end_flag(fls);
+        }
+
+        flagship_begin_flag(fls, FLAGSHIP_TYPE_BOOL); {
+            flagship_name(fls, "-");
+            flagship_description(fls, "pass remaining arguments to project process");
+            flagship_is_terminating(fls, true);
+
+            flagship_end_flag(fls);
+        }
+
+        flagship_copy(fls, MODE_NAMES[M_BUILD], "help");
+
+        flagship_end_mode(fls);
+    }
+
+    flagship_begin_mode(fls); {
+        flagship_name(fls, "%s", MODE_NAMES[M_PKG]);
+        flagship_description(fls, "build project and package for distribution");
+
+        flagship_copy(fls, MODE_NAMES[M_BUILD], "target");
+        flagship_copy(fls, MODE_NAMES[M_BUILD], "enable");
+        flagship_copy(fls, MODE_NAMES[M_BUILD], "disable");
+
+        flagship_copy(fls, MODE_NAMES[M_BUILD], "help");
+
+        flagship_end_mode(fls);
+    }
+
+    return ec;
+}
+
+const char *project_display_name(void) {
+    if(!PROJECT_DISPLAY_NAME) {
+        ini_parser_begin_section(&INI, "project");
+        const char *dp = ini_parser_read_string(&INI, "display-name");
+        ini_parser_end_section(&INI);
+
+        size_t dp_len = strlen(dp);
+
+        PROJECT_DISPLAY_NAME = STR.len;
+        CB_BUF_RESERVE(&STR, dp_len + 1);
+        CB_BUF_APPEND(&STR, dp, dp_len + 1);
+    }
+    return STR.ptr + PROJECT_DISPLAY_NAME;
+}
+const char *program_name(enum Target target) {
+    if(target == T_WASM) {
+        return "index";
+    }
+
+    if(!PROGRAM_NAME) {
+        ini_parser_begin_section(&INI, "project");
+        const char *pn = ini_parser_read_string(&INI, "program-name");
+        ini_parser_end_section(&INI);
+
+        size_t pn_len = strlen(pn);
+
+        PROGRAM_NAME = STR.len;
+
+        if(!pn_len) {
+            CB_BUF_PUSH(&STR, '_');
+        }
+
+        switch(*pn) {
+            case '0' ... '9':
+                CB_BUF_PUSH(&STR, '_');
+                break;
+            default:
+                break;
+        }
+
+        for(size_t i = 0; i < pn_len; ++i) {
+            String str;
+            memset(&str, 0, sizeof(str));
+            switch(pn[i]) {
+                case '!':
+                    str = CB_STRING("_bang_");
+                    break;
+                case '@':
+                    str = CB_STRING("_at_");
+                    break;
+                case '#':
+                    str = CB_STRING("_hash_");
+                    break;
+                case '$':
+                    str = CB_STRING("_dollar_");
+                    break;
+                case '%':
+                    str = CB_STRING("_percent_");
+                    break;
+                case '^':
+                    str = CB_STRING("_hat_");
+                    break;
+                case '&':
+                    str = CB_STRING("_and_");
+                    break;
+                case '*':
+                    str = CB_STRING("_star_");
+                    break;
+                case '(':
+                    str = CB_STRING("_paren_open_");
+                    break;
+                case ')':
+                    str = CB_STRING("_parent_close_");
+                    break;
+                case '+':
+                    str = CB_STRING("_plus_");
+                    break;
+                case '=':
+                    str = CB_STRING("_eq_");
                     break;
                 case '[':
                     str = CB_STRING("_bracket_open_");
@@ -1447,120 +3590,1257 @@ const char *program_name(enum Target target) {
                 case '`':
                     str = CB_STRING("_backtick_");
                     break;
-                case '~':
-                    str = CB_STRING("_tilde_");
+                case '~':
+                    str = CB_STRING("_tilde_");
+                    break;
+                case '0' ... '9':
+                case 'A' ... 'Z':
+                case 'a' ... 'z':
+                    CB_BUF_PUSH(&STR, pn[i]);
+                    break;
+                case '\t':
+                case '\r':
+                case '\n':
+                case ' ':
+                default:
+                    CB_BUF_PUSH(&STR, '_');
+                    break;
+            }
+            if(str.len) {
+                CB_BUF_APPEND(&STR, str.ptr, str.len);
+            }
+        }
+
+        CB_BUF_PUSH(&STR, 0);
+    }
+    return STR.ptr + PROGRAM_NAME;
+}
+const char *version(void) {
+    if(!VERSION) {
+        ini_parser_begin_section(&INI, "project");
+        const char *v = ini_parser_read_string(&INI, "version");
+        ini_parser_end_section(&INI);
+
+        size_t v_len = strlen(v);
+
+        VERSION = STR.len;
+        CB_BUF_APPEND(&STR, v, v_len + 1);
+    }
+    return STR.ptr + VERSION;
+}
+const char *developer(void) {
+    if(!DEVELOPER) {
+        ini_parser_begin_section(&INI, "project");
+        const char *dev = ini_parser_read_string(&INI, "developer-name");
+        ini_parser_end_section(&INI);
+
+        size_t dev_len = strlen(dev);
+
+        DEVELOPER = STR.len;
+        CB_BUF_APPEND(&STR, dev, dev_len + 1);
+    }
+    return STR.ptr + DEVELOPER;
+}
+size_t total_memory(void) {
+    ini_parser_begin_section(&INI, "build");
+    size_t result = ini_parser_read_integer(&INI, "total-memory");
+    ini_parser_end_section(&INI);
+
+    if(result < TOTAL_MEMORY_MIN) {
+        result = TOTAL_MEMORY_MIN;
+    }
+
+    return result;
+}
+bool wasm_lazy_assets(void) {
+    ini_parser_begin_section(&INI, "build");
+    bool result = ini_read_bool("wasm-lazy-assets");
+    ini_parser_end_section(&INI);
+    return result;
+}
+size_t max_memory(void) {
+    ini_parser_begin_section(&INI, "build");
+    size_t result = ini_parser_read_integer(&INI, "max-memory");
+    ini_parser_end_section(&INI);
+
+    return result;
+}
+const char *memory_fmt(size_t bytes) {
+    double amount = bytes;
+    const char *units = "bytes";
+
+    if(amount >= 1024) {
+        amount /= 1024;
+        units = "KiB";
+
+        if(amount >= 1024) {
+            amount /= 1024;
+            units = "MiB";
+
+            if(amount >= 1024) {
+                amount /= 1024;
+                units = "GiB";
+
+                if(amount >= 1024) {
+                    amount /= 1024;
+                    units = "TiB";
+                }
+            }
+        }
+    }
+
+    return local_fmt("%.2f%s", amount, units);
+}
+struct CheckResourcesParams {
+    struct Manifest *prev;
+    int64_t written; // mtime of prev, 0 if there is none
+    size_t rehashed;
+    int    *ec;
+};
+DirWalkAction check_resources_walk(const char *path, DirWalkInfo *info, void *in_params) {
+    struct CheckResourcesParams *params = (struct CheckResourcesParams *)in_params;
+
+    if(info->file_type != FT_FILE) {
+        return DWA_CONTINUE;
+    }
+
+    struct stat st;
+    if(stat(path, &st)) {
+        *params->ec = error(E_FILE_OPEN, path);
+        return DWA_CONTINUE;
+    }
+
+    struct ManifestEntry entry;
+    memset(&entry, 0, sizeof(entry));
+    entry.size  = (uint64_t)st.st_size;
+    entry.mtime = stat_mtime_ns(&st);
+
+    // only hash files that are new or changed since last manifest.
+    // NOTE(alicia): some file systems only keep seconds, a file modified in the
+    // same tick the manifest was written could change without its mtime changing.
+    // Files dated well past the manifest (clock skew, extracted archives)
+    // can't be in that tick, editing them moves their mtime back to now.
+    struct ManifestEntry *old = manifest_find(params->prev, path);
+    if(old && old->size == entry.size && old->mtime == entry.mtime && (
+        entry.mtime < params->written ||
+        entry.mtime > params->written + RESOURCES_MTIME_SLACK)
+    ) {
+        entry.hash = old->hash;
+    } else {
+        if(!file_hash(path, &entry.hash)) {
+            *params->ec = error(E_FILE_OPEN, path);
+            return DWA_CONTINUE;
+        }
+        params->rehashed++;
+    }
+
+    entry.path = MANIFEST.text.len;
+    CB_BUF_APPEND(&MANIFEST.text, path, strlen(path) + 1);
+    CB_BUF_PUSH(&MANIFEST, entry);
+
+    return DWA_CONTINUE;
+}
+bool check_resources(void) {
+    if(!RESOURCES_CHECKED) {
+        int ec = E_NONE;
+
+        struct Manifest prev;
+        memset(&prev, 0, sizeof(prev));
+        manifest_load(RESOURCES_MANIFEST_PATH, &prev);
+
+        struct CheckResourcesParams params;
+        memset(&params, 0, sizeof(params));
+        params.prev = &prev;
+        params.ec   = &ec;
+
+        struct stat st;
+        if(prev.len && !stat(RESOURCES_MANIFEST_PATH, &st)) {
+            params.written = stat_mtime_ns(&st);
+        }
+
+        MANIFEST.len      = 0;
+        MANIFEST.text.len = 0;
+
+        switch(path_query_file_type("resources")) {
+            case FT_NULL:
+            case FT_FILE:
+            case FT_PIPE:
+                break;
+            case FT_DIR:
+                if(!dir_walk("resources", check_resources_walk, &params)) {
+                    ec = error(E_FILE_OPEN, "resources");
+                }
+                break;
+        }
+
+        manifest_sort(&MANIFEST);
+
+        // NOTE(alicia): rewrite when only mtimes changed too (touch, checkout),
+        // otherwise the stale ones are hashed again every build.
+        size_t changes = manifest_diff(&MANIFEST, &prev, NULL, NULL);
+        if((changes || params.rehashed) && !ec) {
+            if(makedir("build") == E_NONE) {
+                manifest_write(RESOURCES_MANIFEST_PATH, &MANIFEST);
+            }
+        }
+        if(MANIFEST.len) {
+            CB_INFO("resources: %zu files, %zu changed, %zu hashed",
+                MANIFEST.len, changes, params.rehashed);
+        }
+
+        manifest_free(&prev);
+
+        RESOURCES_EXISTS  = MANIFEST.len != 0;
+        RESOURCES_CHECKED = true;
+    }
+    return RESOURCES_EXISTS;
+}
+
+bool manifest_load(const char *path, struct Manifest *m) {
+    m->len      = 0;
+    m->text.len = 0;
+
+    FILE *f = fopen(path, "rb");
+    if(!f) {
+        return false;
+    }
+
+    char line[4096];
+    while(fgets(line, sizeof(line), f)) {
+        if(line[0] == '#') {
+            continue;
+        }
+
+        size_t line_len = strlen(line);
+        while(line_len && (line[line_len - 1] == '\n' || line[line_len - 1] == '\r')) {
+            line[--line_len] = 0;
+        }
+
+        struct ManifestEntry entry;
+        memset(&entry, 0, sizeof(entry));
+
+        int name_offset = 0;
+        if(sscanf(line, "%" SCNx64 " %" SCNu64 " %" SCNd64 " %n",
+            &entry.hash, &entry.size, &entry.mtime, &name_offset) != 3 || !name_offset
+        ) {
+            continue;
+        }
+
+        entry.path = m->text.len;
+        CB_BUF_APPEND(&m->text, line + name_offset, line_len - name_offset + 1);
+        CB_BUF_PUSH(m, entry);
+    }
+
+    fclose(f);
+
+    // NOTE(alicia): written sorted but sort anyway in case it was edited by hand
+    manifest_sort(m);
+    return true;
+}
+bool manifest_write(const char *path, struct Manifest *m) {
+    FILE *f = fopen(path, "wb");
+    if(!f) {
+        error(E_FILE_CREATE, path);
+        return false;
+    }
+
+    fprintf(f, "# generated by build system, do not edit\n");
+    fprintf(f, "# hash size mtime path\n");
+    for(size_t i = 0; i < m->len; ++i) {
+        struct ManifestEntry *e = m->ptr + i;
+        fprintf(f, "%016" PRIx64 " %" PRIu64 " %" PRId64 " %s\n",
+            e->hash, e->size, e->mtime, manifest_path(m, e));
+    }
+
+    fclose(f);
+    return true;
+}
+bool manifest_add_file(struct Manifest *m, const char *name, const char *path) {
+    struct stat st;
+    if(stat(path, &st)) {
+        return false;
+    }
+
+    struct ManifestEntry entry;
+    memset(&entry, 0, sizeof(entry));
+    entry.size  = (uint64_t)st.st_size;
+    entry.mtime = stat_mtime_ns(&st);
+
+    if(!file_hash(path, &entry.hash)) {
+        return false;
+    }
+
+    entry.path = m->text.len;
+    CB_BUF_APPEND(&m->text, name, strlen(name) + 1);
+    CB_BUF_PUSH(m, entry);
+
+    manifest_sort(m);
+    return true;
+}
+void manifest_push(struct Manifest *m, const char *name, uint64_t hash) {
+    struct ManifestEntry entry;
+    memset(&entry, 0, sizeof(entry));
+    entry.hash = hash;
+
+    entry.path = m->text.len;
+    CB_BUF_APPEND(&m->text, name, strlen(name) + 1);
+    CB_BUF_PUSH(m, entry);
+}
+struct ManifestEntry *manifest_find(struct Manifest *m, const char *name) {
+    size_t lo = 0;
+    size_t hi = m->len;
+    while(lo < hi) {
+        size_t mid = lo + ((hi - lo) / 2);
+        int cmp = strcmp(name, manifest_path(m, m->ptr + mid));
+        if(cmp == 0) {
+            return m->ptr + mid;
+        } else if(cmp < 0) {
+            hi = mid;
+        } else {
+            lo = mid + 1;
+        }
+    }
+    return NULL;
+}
+const char *MANIFEST_SORT_TEXT = NULL;
+int manifest_sort_cmp(const void *a, const void *b) {
+    const struct ManifestEntry *ea = (const struct ManifestEntry *)a;
+    const struct ManifestEntry *eb = (const struct ManifestEntry *)b;
+    return strcmp(MANIFEST_SORT_TEXT + ea->path, MANIFEST_SORT_TEXT + eb->path);
+}
+void manifest_sort(struct Manifest *m) {
+    if(m->len < 2) {
+        return;
+    }
+    MANIFEST_SORT_TEXT = m->text.ptr;
+    qsort(m->ptr, m->len, sizeof(m->ptr[0]), manifest_sort_cmp);
+}
+void manifest_copy(struct Manifest *dst, struct Manifest *src) {
+    dst->len      = 0;
+    dst->text.len = 0;
+    if(src->len) {
+        CB_BUF_APPEND(dst, src->ptr, src->len);
+    }
+    if(src->text.len) {
+        CB_BUF_APPEND(&dst->text, src->text.ptr, src->text.len);
+    }
+}
+size_t manifest_diff(
+    struct Manifest *cur, struct Manifest *prev, ManifestDiffFN *fn, void *params
+) {
+    size_t changes = 0;
+    size_t c = 0, p = 0;
+    while(c < cur->len || p < prev->len) {
+        int cmp;
+        if(c >= cur->len) {
+            cmp = 1;
+        } else if(p >= prev->len) {
+            cmp = -1;
+        } else {
+            cmp = strcmp(manifest_path(cur, cur->ptr + c), manifest_path(prev, prev->ptr + p));
+        }
+
+        if(cmp < 0) {
+            if(fn) {
+                fn(manifest_path(cur, cur->ptr + c), MC_ADDED, params);
+            }
+            changes++;
+            c++;
+        } else if(cmp > 0) {
+            if(fn) {
+                fn(manifest_path(prev, prev->ptr + p), MC_REMOVED, params);
+            }
+            changes++;
+            p++;
+        } else {
+            if(cur->ptr[c].hash != prev->ptr[p].hash || cur->ptr[c].size != prev->ptr[p].size) {
+                if(fn) {
+                    fn(manifest_path(cur, cur->ptr + c), MC_MODIFIED, params);
+                }
+                changes++;
+            }
+            c++;
+            p++;
+        }
+    }
+    return changes;
+}
+void manifest_free(struct Manifest *m) {
+    CB_BUF_FREE(m);
+    CB_BUF_FREE(&m->text);
+}
+const char *manifest_path(struct Manifest *m, struct ManifestEntry *entry) {
+    return m->text.ptr + entry->path;
+}
+void size_push(struct SizeReport *r, struct SizeList *list, const char *name, size_t name_len, uint64_t size) {
+    struct SizeEntry entry;
+    entry.name = r->text.len;
+    entry.size = size;
+
+    CB_BUF_APPEND(&r->text, name, name_len);
+    CB_BUF_PUSH(&r->text, 0);
+    CB_BUF_PUSH(list, entry);
+}
+void size_free(struct SizeReport *r) {
+    CB_BUF_FREE(&r->sections);
+    CB_BUF_FREE(&r->objects);
+    CB_BUF_FREE(&r->symbols);
+    CB_BUF_FREE(&r->text);
+}
+uint64_t size_find(struct SizeReport *r, struct SizeList *list, const char *name, bool *out_found) {
+    for(size_t i = 0; i < list->len; ++i) {
+        if(strcmp(r->text.ptr + list->ptr[i].name, name) == 0) {
+            *out_found = true;
+            return list->ptr[i].size;
+        }
+    }
+    *out_found = false;
+    return 0;
+}
+int size_entry_cmp(const void *a, const void *b) {
+    const struct SizeEntry *ea = (const struct SizeEntry *)a;
+    const struct SizeEntry *eb = (const struct SizeEntry *)b;
+    return (ea->size < eb->size) - (ea->size > eb->size);
+}
+
+// sort largest first and keep only the top symbols
+void size_sort(struct SizeReport *r) {
+    qsort(r->sections.ptr, r->sections.len, sizeof(r->sections.ptr[0]), size_entry_cmp);
+    qsort(r->objects.ptr,  r->objects.len,  sizeof(r->objects.ptr[0]),  size_entry_cmp);
+    qsort(r->symbols.ptr,  r->symbols.len,  sizeof(r->symbols.ptr[0]),  size_entry_cmp);
+    if(r->symbols.len > SIZE_REPORT_SYMBOLS) {
+        r->symbols.len = SIZE_REPORT_SYMBOLS;
+    }
+}
+bool file_read_all(const char *path, uint8_t **out_data, size_t *out_len) {
+    FILE *f = fopen(path, "rb");
+    if(!f) {
+        return false;
+    }
+
+    fseek(f, 0, SEEK_END);
+    long len = ftell(f);
+    fseek(f, 0, SEEK_SET);
+
+    if(len < 0) {
+        fclose(f);
+        return false;
+    }
+
+    uint8_t *data = (uint8_t *)malloc(len ? len : 1);
+    bool success  = data && fread(data, 1, len, f) == (size_t)len;
+    fclose(f);
+
+    if(!success) {
+        free(data);
+        return false;
+    }
+
+    *out_data = data;
+    *out_len  = len;
+    return true;
+}
+
+// little-endian readers, return 0 when out of bounds
+uint64_t read_le(const uint8_t *data, size_t len, size_t at, size_t size) {
+    if(at > len || size > len - at) {
+        return 0;
+    }
+    uint64_t result = 0;
+    for(size_t i = 0; i < size; ++i) {
+        result |= (uint64_t)data[at + i] << (i * 8);
+    }
+    return result;
+}
+bool read_leb(const uint8_t *data, size_t len, size_t *at, uint64_t *out) {
+    uint64_t result = 0;
+    unsigned shift  = 0;
+    while(*at < len && shift < 64) {
+        uint8_t byte = data[(*at)++];
+        result |= (uint64_t)(byte & 0x7F) << shift;
+        if(!(byte & 0x80)) {
+            *out = result;
+            return true;
+        }
+        shift += 7;
+    }
+    return false;
+}
+
+// NOTE(alicia): object files only report bytes that end up in the output.
+// executables report sections and, when symbols are present, sized symbols.
+bool size_parse_elf(const uint8_t *data, size_t len, struct SizeReport *r, bool object) {
+    // 64-bit little-endian only
+    if(len < 64 || data[4] != 2 || data[5] != 1) {
+        return false;
+    }
+
+    uint64_t shoff     = read_le(data, len, 0x28, 8);
+    uint64_t shentsize = read_le(data, len, 0x3A, 2);
+    uint64_t shnum     = read_le(data, len, 0x3C, 2);
+    uint64_t shstrndx  = read_le(data, len, 0x3E, 2);
+
+    if(shentsize < 64 || shstrndx >= shnum) {
+        return false;
+    }
+
+    #define SH(i, offset, size) read_le(data, len, shoff + ((i) * shentsize) + (offset), size)
+
+    uint64_t shstr = SH(shstrndx, 24, 8);
+
+    for(uint64_t i = 1; i < shnum; ++i) {
+        uint64_t name  = SH(i, 0, 4);
+        uint64_t type  = SH(i, 4, 4);
+        uint64_t flags = SH(i, 8, 8);
+        uint64_t size  = SH(i, 32, 8);
+
+        if(!size) {
+            continue;
+        }
+
+        if(object) {
+            // SHF_ALLOC and not SHT_NOBITS
+            if((flags & 0x2) && type != 8) {
+                r->total += size;
+            }
+            continue;
+        }
+
+        if(shstr + name < len) {
+            const char *sname = (const char *)data + shstr + name;
+            size_push(r, &r->sections, sname, strnlen(sname, len - (shstr + name)), size);
+        }
+
+        // SHT_SYMTAB
+        if(type == 2) {
+            uint64_t offset  = SH(i, 24, 8);
+            uint64_t link    = SH(i, 40, 4);
+            uint64_t entsize = SH(i, 56, 8);
+            uint64_t strtab  = SH(link, 24, 8);
+
+            if(entsize < 24 || link >= shnum) {
+                continue;
+            }
+
+            for(uint64_t s = 0; s < size / entsize; ++s) {
+                uint64_t at    = offset + (s * entsize);
+                uint64_t sym_name = read_le(data, len, at, 4);
+                uint64_t info     = read_le(data, len, at + 4, 1);
+                uint64_t sym_size = read_le(data, len, at + 16, 8);
+
+                // STT_OBJECT or STT_FUNC
+                if(!sym_size || ((info & 0xF) != 1 && (info & 0xF) != 2)) {
+                    continue;
+                }
+                if(strtab + sym_name >= len) {
+                    continue;
+                }
+
+                const char *sym = (const char *)data + strtab + sym_name;
+                size_push(r, &r->symbols, sym, strnlen(sym, len - (strtab + sym_name)), sym_size);
+            }
+        }
+    }
+
+    #undef SH
+
+    return true;
+}
+bool size_parse_coff(const uint8_t *data, size_t len, size_t coff, struct SizeReport *r, bool object) {
+    uint64_t nsections  = read_le(data, len, coff + 2, 2);
+    uint64_t symtab     = read_le(data, len, coff + 8, 4);
+    uint64_t nsymbols   = read_le(data, len, coff + 12, 4);
+    uint64_t opt_header = read_le(data, len, coff + 16, 2);
+
+    uint64_t strtab   = symtab + (nsymbols * 18);
+    uint64_t sections = coff + 20 + opt_header;
+
+    for(uint64_t i = 0; i < nsections; ++i) {
+        uint64_t at   = sections + (i * 40);
+        uint64_t size = read_le(data, len, at + 16, 4);
+        if(at + 40 > len || !size) {
+            continue;
+        }
+
+        if(object) {
+            r->total += size;
+            continue;
+        }
+
+        const char *name = (const char *)data + at;
+        size_t name_len  = strnlen(name, 8);
+
+        // NOTE(alicia): long names are "/offset" into the string table
+        if(name[0] == '/' && symtab) {
+            uint64_t offset = strtoull(local_fmt("%.*s", (int)(name_len - 1), name + 1), NULL, 10);
+            if(strtab + offset < len) {
+                name     = (const char *)data + strtab + offset;
+                name_len = strnlen(name, len - (strtab + offset));
+            }
+        }
+
+        size_push(r, &r->sections, name, name_len, size);
+    }
+
+    // TODO(alicia): coff symbols have no size, symbols are only reported for elf and wasm
+
+    return true;
+}
+bool size_parse_wasm(const uint8_t *data, size_t len, struct SizeReport *r, bool object) {
+    const char *SECTION_NAMES[] = {
+        "custom", "type", "import", "function", "table", "memory", "global",
+        "export", "start", "element", "code", "data", "datacount", "tag"
+    };
+
+    uint64_t imported_functions = 0;
+
+    // function body sizes by index into the code section
+    struct { size_t cap; size_t len; uint64_t *ptr; } bodies;
+    memset(&bodies, 0, sizeof(bodies));
+
+    size_t at = 8;
+    while(at < len) {
+        uint8_t id = data[at++];
+        uint64_t size;
+        if(!read_leb(data, len, &at, &size) || size > len - at) {
+            break;
+        }
+
+        size_t start = at;
+        size_t end   = at + size;
+        at = end;
+
+        if(object) {
+            // code and data
+            if(id == 10 || id == 11) {
+                r->total += size;
+            }
+            continue;
+        }
+
+        if(id == 0) {
+            size_t c = start;
+            uint64_t name_len;
+            if(!read_leb(data, end, &c, &name_len) || name_len > end - c) {
+                continue;
+            }
+            const char *name = (const char *)data + c;
+            size_push(r, &r->sections, name, name_len, size);
+
+            c += name_len;
+            if(name_len != 4 || memcmp(name, "name", 4)) {
+                continue;
+            }
+
+            // function names subsection
+            while(c < end) {
+                uint8_t  sub_id = data[c++];
+                uint64_t sub_size;
+                if(!read_leb(data, end, &c, &sub_size) || sub_size > end - c) {
+                    break;
+                }
+                size_t sub_end = c + sub_size;
+                if(sub_id != 1) {
+                    c = sub_end;
+                    continue;
+                }
+
+                uint64_t count;
+                if(!read_leb(data, sub_end, &c, &count)) {
                     break;
-                case '0' ... '9':
-                case 'A' ... 'Z':
-                case 'a' ... 'z':
-                    CB_BUF_PUSH(&STR, pn[i]);
+                }
+                for(uint64_t i = 0; i < count && c < sub_end; ++i) {
+                    uint64_t index, fn_len;
+                    if(!read_leb(data, sub_end, &c, &index) ||
+                        !read_leb(data, sub_end, &c, &fn_len) || fn_len > sub_end - c
+                    ) {
+                        break;
+                    }
+                    if(index >= imported_functions && index - imported_functions < bodies.len) {
+                        size_push(r, &r->symbols, (const char *)data + c, fn_len,
+                            bodies.ptr[index - imported_functions]);
+                    }
+                    c += fn_len;
+                }
+                c = sub_end;
+            }
+            continue;
+        }
+
+        if(id < CB_ARRAY_LEN(SECTION_NAMES)) {
+            size_push(r, &r->sections, SECTION_NAMES[id], strlen(SECTION_NAMES[id]), size);
+        }
+
+        if(id == 2) {
+            // count imported functions, they come first in the function index space
+            size_t c = start;
+            uint64_t count, n, kind, dummy;
+            if(!read_leb(data, end, &c, &count)) {
+                continue;
+            }
+            for(uint64_t i = 0; i < count && c < end; ++i) {
+                // module and field names
+                for(int s = 0; s < 2; ++s) {
+                    if(!read_leb(data, end, &c, &n)) {
+                        break;
+                    }
+                    c += n;
+                }
+                if(c >= end) {
                     break;
-                case '\t':
-                case '\r':
-                case '\n':
-                case ' ':
-                default:
-                    CB_BUF_PUSH(&STR, '_');
+                }
+                kind = data[c++];
+                switch(kind) {
+                    case 0: // function: type index
+                        imported_functions++;
+                        read_leb(data, end, &c, &dummy);
+                        break;
+                    case 1: // table: reftype, limits
+                        c++;
+                        /* fallthrough */
+                    case 2: { // memory: limits
+                        if(c >= end) {
+                            break;
+                        }
+                        uint8_t flags = data[c++];
+                        read_leb(data, end, &c, &dummy);
+                        if(flags & 0x1) {
+                            read_leb(data, end, &c, &dummy);
+                        }
+                    } break;
+                    case 3: // global: valtype, mutability
+                        c += 2;
+                        break;
+                    case 4: // tag: attribute, type index
+                        c++;
+                        read_leb(data, end, &c, &dummy);
+                        break;
+                    default:
+                        c = end;
+                        break;
+                }
+            }
+        } else if(id == 10) {
+            size_t c = start;
+            uint64_t count, body;
+            if(!read_leb(data, end, &c, &count)) {
+                continue;
+            }
+            for(uint64_t i = 0; i < count && c < end; ++i) {
+                if(!read_leb(data, end, &c, &body)) {
                     break;
+                }
+                CB_BUF_PUSH(&bodies, body);
+                c += body;
             }
-            if(str.len) {
-                CB_BUF_APPEND(&STR, str.ptr, str.len);
+        }
+    }
+
+    CB_BUF_FREE(&bodies);
+    return true;
+}
+bool size_parse(const char *path, struct SizeReport *r, bool object) {
+    uint8_t *data = NULL;
+    size_t   len  = 0;
+    if(!file_read_all(path, &data, &len)) {
+        return false;
+    }
+
+    if(!object) {
+        r->total = len;
+    }
+
+    bool success = false;
+    if(len >= 4 && memcmp(data, "\x7F" "ELF", 4) == 0) {
+        success = size_parse_elf(data, len, r, object);
+    } else if(len >= 8 && memcmp(data, "\0asm", 4) == 0) {
+        success = size_parse_wasm(data, len, r, object);
+    } else if(len >= 0x40 && data[0] == 'M' && data[1] == 'Z') {
+        uint64_t pe = read_le(data, len, 0x3C, 4);
+        if(pe + 24 <= len && memcmp(data + pe, "PE\0\0", 4) == 0) {
+            success = size_parse_coff(data, len, pe + 4, r, object);
+        }
+    } else if(len >= 20 && read_le(data, len, 0, 2) == 0x8664) {
+        // x86_64 coff object
+        success = size_parse_coff(data, len, 0, r, object);
+    }
+
+    free(data);
+    return success;
+}
+// NOTE(alicia): only reads size.json files written by size_write
+bool size_load(const char *path, struct SizeReport *r) {
+    FILE *f = fopen(path, "rb");
+    if(!f) {
+        return false;
+    }
+
+    struct SizeList *list = NULL;
+
+    char line[4096];
+    while(fgets(line, sizeof(line), f)) {
+        unsigned long long value = 0;
+        const char *at;
+
+        if(strstr(line, "\"sections\"")) {
+            list = &r->sections;
+        } else if(strstr(line, "\"objects\"")) {
+            list = &r->objects;
+        } else if(strstr(line, "\"symbols\"")) {
+            list = &r->symbols;
+        } else if(!list && (at = strstr(line, "\"total\":"))) {
+            sscanf(at, "\"total\": %llu", &value);
+            r->total = value;
+        } else if(list && (at = strstr(line, "{\"name\": \""))) {
+            at += sizeof("{\"name\": \"") - 1;
+            const char *end = strstr(at, "\", \"size\": ");
+            if(!end) {
+                continue;
             }
+            sscanf(end, "\", \"size\": %llu", &value);
+            // NOTE(alicia): names are compared escaped
+            size_push(r, list, at, end - at, value);
         }
+    }
 
-        CB_BUF_PUSH(&STR, 0);
+    fclose(f);
+    return true;
+}
+const char *json_escape(const char *text) {
+    ByteBuf *buf = local_buf();
+    for(const char *c = text; *c; ++c) {
+        switch(*c) {
+            case '"':
+            case '\\':
+                CB_BUF_PUSH(buf, '\\');
+                CB_BUF_PUSH(buf, *c);
+                break;
+            default:
+                if((uint8_t)*c < 0x20) {
+                    string_buf_fmt(buf, "\\u%04x", (uint8_t)*c);
+                } else {
+                    CB_BUF_PUSH(buf, *c);
+                }
+                break;
+        }
     }
-    return STR.ptr + PROGRAM_NAME;
+    CB_BUF_PUSH(buf, 0);
+    return buf->ptr;
 }
-const char *version(void) {
-    if(!VERSION) {
-        ini_parser_begin_section(&INI, "project");
-        const char *v = ini_parser_read_string(&INI, "version");
-        ini_parser_end_section(&INI);
+bool size_write(const char *path, const char *binary, struct SizeReport *r) {
+    FILE *f = fopen(path, "wb");
+    if(!f) {
+        error(E_FILE_CREATE, path);
+        return false;
+    }
 
-        size_t v_len = strlen(v);
+    fprintf(f, "{\n");
+    fprintf(f, "    \"file\": \"%s\",\n", json_escape(binary));
+    fprintf(f, "    \"total\": %" PRIu64 ",\n", r->total);
+
+    struct SizeList *lists[] = { &r->sections, &r->objects, &r->symbols };
+    const char *names[]      = { "sections", "objects", "symbols" };
+    for(size_t l = 0; l < CB_ARRAY_LEN(lists); ++l) {
+        fprintf(f, "    \"%s\": [\n", names[l]);
+        for(size_t i = 0; i < lists[l]->len; ++i) {
+            struct SizeEntry *e = lists[l]->ptr + i;
+            fprintf(f, "        {\"name\": \"%s\", \"size\": %" PRIu64 "}%s\n",
+                json_escape(r->text.ptr + e->name), e->size, i + 1 < lists[l]->len ? "," : "");
+        }
+        fprintf(f, "    ]%s\n", l + 1 < CB_ARRAY_LEN(lists) ? "," : "");
+    }
+    fprintf(f, "}\n");
 
-        VERSION = STR.len;
-        CB_BUF_APPEND(&STR, v, v_len + 1);
+    fclose(f);
+    return true;
+}
+const char *size_delta_fmt(uint64_t cur, uint64_t prev) {
+    if(cur >= prev) {
+        return local_fmt("+%s", memory_fmt(cur - prev));
+    } else {
+        return local_fmt("-%s", memory_fmt(prev - cur));
     }
-    return STR.ptr + VERSION;
 }
-const char *developer(void) {
-    if(!DEVELOPER) {
-        ini_parser_begin_section(&INI, "project");
-        const char *dev = ini_parser_read_string(&INI, "developer-name");
+void size_print_changes(
+    const char *kind, struct SizeReport *cur, struct SizeList *cur_list,
+    struct SizeReport *prev, struct SizeList *prev_list
+) {
+    for(size_t i = 0; i < cur_list->len; ++i) {
+        const char *name = cur->text.ptr + cur_list->ptr[i].name;
+        bool found;
+        uint64_t old = size_find(prev, prev_list, json_escape(name), &found);
+        if(!found) {
+            CB_INFO("    %s %s: %s (new)", kind, name, memory_fmt(cur_list->ptr[i].size));
+        } else if(old != cur_list->ptr[i].size) {
+            CB_INFO("    %s %s: %s (%s)", kind, name,
+                memory_fmt(cur_list->ptr[i].size), size_delta_fmt(cur_list->ptr[i].size, old));
+        }
+    }
+}
+bool file_hash(const char *path, uint64_t *out_hash) {
+    FILE *f = fopen(path, "rb");
+    if(!f) {
+        return false;
+    }
+
+    // FNV-1a
+    static uint8_t buf[64 * 1024];
+    uint64_t hash = 0xcbf29ce484222325ull;
+
+    size_t n;
+    while((n = fread(buf, 1, sizeof(buf), f))) {
+        for(size_t i = 0; i < n; ++i) {
+            hash ^= buf[i];
+            hash *= 0x100000001b3ull;
+        }
+    }
+
+    bool success = !ferror(f);
+    fclose(f);
+
+    *out_hash = hash;
+    return success;
+}
+// free slot of a finished job, fails if it did
+int job_reap(struct JobSlot *job) {
+    int ec = E_NONE;
+    for(size_t i = 0; i < job->group.len; ++i) {
+        ProcessData *proc = job->group.ptr + i;
+
+        if(proc->exit_code) {
+            ec = error(E_PROC_FAIL, TMP.ptr + job->label, proc->exit_code);
+        }
+    }
+    proc_group_clean(&job->group);
+    return ec;
+}
+int job_exec(const char *wd, const char *label) {
+    int ec = E_NONE;
+
+    struct JobSlot *job = NULL;
+    for(size_t i = 0; i < JOBS.len && !job; ++i) {
+        if(!JOBS.ptr[i].group.len) {
+            job = JOBS.ptr + i;
+        }
+    }
+    if(!job && JOBS.len < job_limit()) {
+        struct JobSlot slot;
+        memset(&slot, 0, sizeof(slot));
+        CB_BUF_PUSH(&JOBS, slot);
+        job = JOBS.ptr + JOBS.len - 1;
+    }
+
+    // NOTE(alicia): at the limit, start as soon as any job finishes
+    while(!job) {
+        for(size_t i = 0; i < JOBS.len && !job; ++i) {
+            if(proc_group_join(&JOBS.ptr[i].group, JOB_POLL_MS)) {
+                job = JOBS.ptr + i;
+            }
+        }
+    }
+    if((ec = job_reap(job))) {
+        return ec;
+    }
+
+    job->label = TMP.len;
+    CB_BUF_APPEND(&TMP, label, strlen(label) + 1);
+
+    if(CB_EXEC(CMD.cmd, .group=&job->group, .wd=wd)) {
+        TMP.len = job->label;
+        return error(E_EXEC_ASYNC, label);
+    }
+
+    return ec;
+}
+int job_join(void) {
+    int ec = E_NONE;
+
+    for(size_t i = 0; i < JOBS.len; ++i) {
+        struct JobSlot *job = JOBS.ptr + i;
+        if(job->group.len) {
+            proc_group_join(&job->group, CB_WAIT_INF);
+
+            int job_ec = job_reap(job);
+            if(job_ec) {
+                ec = job_ec;
+            }
+        }
+    }
+
+    TMP.len = 0;
+    return ec;
+}
+size_t job_limit(void) {
+    if(!JOB_LIMIT) {
+        ini_parser_begin_section(&INI, "build");
+        int jobs = ini_parser_read_integer(&INI, "jobs");
         ini_parser_end_section(&INI);
 
-        size_t dev_len = strlen(dev);
+        if(jobs > 0) {
+            JOB_LIMIT = jobs;
+        } else {
+            JOB_LIMIT = cpu_count();
+        }
+    }
+    return JOB_LIMIT;
+}
 
-        DEVELOPER = STR.len;
-        CB_BUF_APPEND(&STR, dev, dev_len + 1);
+void chain_push(enum Target target, const char *wd, const char *label) {
+    struct ChainCmd cmd;
+    memset(&cmd, 0, sizeof(cmd));
+
+    if(!CHAIN_TEXT.len) {
+        // NOTE(alicia): offset 0 means no working directory
+        CB_BUF_PUSH(&CHAIN_TEXT, 0);
+    }
+
+    cmd.args = CHAIN_ARGS.len;
+    cmd.argc = CMD.cmd.len;
+    for(size_t i = 0; i < CMD.cmd.len; ++i) {
+        CB_BUF_PUSH(&CHAIN_ARGS, CHAIN_TEXT.len);
+        CB_BUF_APPEND(&CHAIN_TEXT, CMD.cmd.ptr[i], strlen(CMD.cmd.ptr[i]) + 1);
+    }
+
+    if(wd) {
+        cmd.wd = CHAIN_TEXT.len;
+        CB_BUF_APPEND(&CHAIN_TEXT, wd, strlen(wd) + 1);
+    }
+
+    cmd.label = CHAIN_TEXT.len;
+    CB_BUF_APPEND(&CHAIN_TEXT, label, strlen(label) + 1);
+
+    CB_BUF_PUSH(CHAINS + target, cmd);
+}
+int chain_run(bool failed[T_COUNT]) {
+    int ec = E_NONE;
+
+    size_t next[T_COUNT];
+    memset(next, 0, sizeof(next));
+
+    // NOTE(alicia): each chain starts its next command as soon as
+    // its last one finishes, without waiting for the other chains.
+    size_t running = 0;
+    for(;;) {
+        // start next command of every idle chain
+        for(enum Target t = T_BEGIN; t < T_COUNT && running < job_limit(); ++t) {
+            struct Chain *chain = CHAINS + t;
+            if(CHAIN_PG[t].len || failed[t] || next[t] >= chain->len) {
+                continue;
+            }
+
+            struct ChainCmd *c = chain->ptr + next[t];
+            next[t]++;
+
+            cmd_reset(&CMD);
+            for(size_t i = 0; i < c->argc; ++i) {
+                cmd_add(&CMD, CHAIN_TEXT.ptr + CHAIN_ARGS.ptr[c->args + i]);
+            }
+
+            const char *wd = c->wd ? CHAIN_TEXT.ptr + c->wd : NULL;
+            if(CB_EXEC(CMD.cmd, .group=CHAIN_PG + t, .wd=wd)) {
+                ec = error(E_EXEC_ASYNC, CHAIN_TEXT.ptr + c->label);
+                failed[t] = true;
+                continue;
+            }
+
+            running++;
+        }
+
+        if(!running) {
+            break;
+        }
+
+        // wait for any chain's command to finish
+        for(bool finished = false; !finished;) {
+            for(enum Target t = T_BEGIN; t < T_COUNT; ++t) {
+                ProcessGroup *pg = CHAIN_PG + t;
+                if(!pg->len || !proc_group_join(pg, JOB_POLL_MS)) {
+                    continue;
+                }
+
+                for(size_t i = 0; i < pg->len; ++i) {
+                    if(pg->ptr[i].exit_code) {
+                        struct ChainCmd *c = CHAINS[t].ptr + next[t] - 1;
+                        ec = error(E_PROC_FAIL, CHAIN_TEXT.ptr + c->label, pg->ptr[i].exit_code);
+                        failed[t] = true;
+                    }
+                }
+
+                proc_group_clean(pg);
+                running--;
+                finished = true;
+            }
+        }
+    }
+
+    for(enum Target t = T_BEGIN; t < T_COUNT; ++t) {
+        CHAINS[t].len = 0;
+    }
+    CHAIN_ARGS.len = 0;
+    CHAIN_TEXT.len = 0;
+
+    return ec;
+}
+
+uint64_t cmd_hash(CmdBuf *cmd) {
+    // FNV-1a, NUL between arguments
+    uint64_t hash = 0xcbf29ce484222325ull;
+    for(size_t i = 0; i < cmd->cmd.len; ++i) {
+        const char *arg = cmd->cmd.ptr[i];
+        do {
+            hash ^= (uint8_t)*arg;
+            hash *= 0x100000001b3ull;
+        } while(*arg++);
     }
-    return STR.ptr + DEVELOPER;
+    return hash;
 }
-size_t total_memory(void) {
-    ini_parser_begin_section(&INI, "build");
-    size_t result = ini_parser_read_integer(&INI, "total-memory");
-    ini_parser_end_section(&INI);
 
-    if(result < TOTAL_MEMORY_MIN) {
-        result = TOTAL_MEMORY_MIN;
+int raylib_config(void) {
+    if(RAYLIB_CONFIG_LOADED) {
+        return E_NONE;
     }
+    RAYLIB_CONFIG_LOADED = true;
 
-    return result;
-}
-const char *memory_fmt(size_t bytes) {
-    double amount = bytes;
-    const char *units = "bytes";
+    ini_parser_begin_section(&INI, "raylib");
 
-    if(amount >= 1024) {
-        amount /= 1024;
-        units = "KiB";
+    for(enum RaylibModule m = RAYLIB_MODULE_BEGIN; m < RAYLIB_MODULE_COUNT; ++m) {
+        RAYLIB_MODULES[m] = ini_read_bool(RAYLIB_MODULE_NAMES[m]);
+    }
 
-        if(amount >= 1024) {
-            amount /= 1024;
-            units = "MiB";
+    bool features[CB_ARRAY_LEN(RAYLIB_FEATURES)];
+    bool is_default = true;
+    for(size_t i = 0; i < CB_ARRAY_LEN(RAYLIB_FEATURES); ++i) {
+        features[i] = RAYLIB_FEATURES[i].enabled;
+    }
 
-            if(amount >= 1024) {
-                amount /= 1024;
-                units = "GiB";
+    const char *fields[] = { "enable", "disable" };
+    for(size_t f = 0; f < CB_ARRAY_LEN(fields); ++f) {
+        const char *list = ini_parser_read_string(&INI, fields[f]);
 
-                if(amount >= 1024) {
-                    amount /= 1024;
-                    units = "TiB";
+        while(*list) {
+            while(*list && isspace(*list)) {
+                list++;
+            }
+            size_t len = 0;
+            while(list[len] && !isspace(list[len])) {
+                len++;
+            }
+            if(!len) {
+                break;
+            }
+
+            size_t i = 0;
+            for(; i < CB_ARRAY_LEN(RAYLIB_FEATURES); ++i) {
+                const char *macro = RAYLIB_FEATURES[i].macro;
+                if(strlen(macro) == len && strncmp(macro, list, len) == 0) {
+                    break;
                 }
             }
+            if(i == CB_ARRAY_LEN(RAYLIB_FEATURES)) {
+                ini_parser_end_section(&INI);
+                return error(E_CONFIG, "raylib", fields[f],
+                    local_fmt("unknown feature %.*s", (int)len, list));
+            }
+
+            features[i] = f == 0;
+            list += len;
         }
     }
 
-    return local_fmt("%.2f%s", amount, units);
+    ini_parser_end_section(&INI);
+
+    // NOTE(alicia): rtext and rmodels upload textures
+    if(!RAYLIB_MODULES[RAYLIB_MODULE_RTEXTURES]) {
+        if(RAYLIB_MODULES[RAYLIB_MODULE_RTEXT]) {
+            return error(E_CONFIG, "raylib", "rtext", "rtext requires rtextures");
+        }
+        if(RAYLIB_MODULES[RAYLIB_MODULE_RMODELS]) {
+            return error(E_CONFIG, "raylib", "rmodels", "rmodels requires rtextures");
+        }
+    }
+
+    for(enum RaylibModule m = RAYLIB_MODULE_BEGIN; m < RAYLIB_MODULE_COUNT; ++m) {
+        is_default = is_default && RAYLIB_MODULES[m];
+    }
+    for(size_t i = 0; i < CB_ARRAY_LEN(RAYLIB_FEATURES); ++i) {
+        is_default = is_default && (features[i] == RAYLIB_FEATURES[i].enabled);
+    }
+
+    // NOTE(alicia): config.h defines its flags unconditionally,
+    // replacing it is the only way to turn them off.
+    RAYLIB_CONFIG.len   = 0;
+    RAYLIB_CONFIG_COUNT = 0;
+    if(is_default) {
+        return E_NONE;
+    }
+
+    const char *define = "-DEXTERNAL_CONFIG_FLAGS";
+    CB_BUF_APPEND(&RAYLIB_CONFIG, define, strlen(define) + 1);
+    RAYLIB_CONFIG_COUNT++;
+
+    for(enum RaylibModule m = RAYLIB_MODULE_BEGIN; m < RAYLIB_MODULE_COUNT; ++m) {
+        if(RAYLIB_MODULES[m]) {
+            define = local_fmt("-D%s=1", RAYLIB_MODULE_MACROS[m]);
+            CB_BUF_APPEND(&RAYLIB_CONFIG, define, strlen(define) + 1);
+            RAYLIB_CONFIG_COUNT++;
+        }
+    }
+    for(size_t i = 0; i < CB_ARRAY_LEN(RAYLIB_FEATURES); ++i) {
+        if(features[i]) {
+            define = local_fmt("-D%s=1", RAYLIB_FEATURES[i].macro);
+            CB_BUF_APPEND(&RAYLIB_CONFIG, define, strlen(define) + 1);
+            RAYLIB_CONFIG_COUNT++;
+        }
+    }
+
+    return E_NONE;
 }
-DirWalkAction check_resources_walk(const char *path, DirWalkInfo *info, void *params) {
-    int *counter = (int *)params;
-    *counter += info->file_type == FT_FILE ? 1 : 0;
-    return DWA_CONTINUE;
+void raylib_config_append(CmdBuf *cmd) {
+    const char *at = RAYLIB_CONFIG.ptr;
+    for(size_t i = 0; i < RAYLIB_CONFIG_COUNT; ++i) {
+        cmd_add(cmd, at);
+        at += strlen(at) + 1;
+    }
 }
-bool check_resources(void) {
-    if(!RESOURCES_CHECKED) {
-        int counter = 0;
-        switch(path_query_file_type("resources")) {
-            case FT_NULL:
-            case FT_FILE:
-            case FT_PIPE:
-                RESOURCES_EXISTS = false;
-                break;
-            case FT_DIR:
-                if(dir_walk("resources", check_resources_walk, &counter)) {
-                    RESOURCES_EXISTS = counter != 0;
-                } else {
-                    RESOURCES_EXISTS = false;
+bool ini_read_bool(const char *field) {
+    const char *value = ini_parser_read_string(&INI, field);
+    return !(
+        strcmp(value, "false") == 0 || strcmp(value, "no")  == 0 ||
+        strcmp(value, "off")   == 0 || strcmp(value, "0")   == 0);
+}
+
+void collect_target_flags(struct Option *opt) {
+    unsigned int count = 0;
+    struct FlagshipResult *ptr = NULL;
+
+    opt->build.targets = 0;
+    if(flagship_search_repeatable(&FLS, MODE_NAMES[opt->mode], "target", &count, &ptr)) {
+        for(unsigned int i = 0; i < count; ++i) {
+            if(ptr[i].t_enum == T_ALL) {
+                for(enum Target t = T_BEGIN + 1; t < T_COUNT; ++t) {
+                    // NOTE(alicia): macos can only be built on macos
+                    if(t == T_MACOS && CB_OS_CURRENT != CB_OS_MACOS) {
+                        continue;
+                    }
+                    opt->build.targets |= (1 << t);
                 }
-                break;
+            } else {
+                opt->build.targets |= (1 << target_normalize(ptr[i].t_enum));
+            }
         }
+    }
 
-        RESOURCES_CHECKED = true;
+    if(!opt->build.targets) {
+        opt->build.targets = (1 << target_normalize(T_NATIVE));
+    }
+
+    // first selected target
+    for(enum Target t = T_BEGIN + 1; t < T_COUNT; ++t) {
+        if(target_selected(&opt->build, t)) {
+            opt->build.target = t;
+            break;
+        }
     }
-    return RESOURCES_EXISTS;
 }
 void collect_enable_flags(struct Option *opt) {
     FRB.len = 0;
@@ -1674,6 +4954,9 @@ enum Target target_normalize(enum Target target) {
             return T_LINUX;
     }
 }
+bool target_selected(struct OptionBuild *opt, enum Target target) {
+    return (opt->targets & (1 << target)) == (1 << target);
+}
 const char *target_name(enum Target target) {
     return TARGET_NAMES[target];
 }
@@ -1737,6 +5020,21 @@ const char *archiver_linux_mingw(void) {
     }
     return STR.ptr + MINGW_AR;
 }
+const char *objcopy_linux_mingw(void) {
+    if(!MINGW_OBJCOPY) {
+        attempt(MINGW_OBJCOPY, "x86_64-w64-mingw32-objcopy");
+
+        const char *query = env_query("MINGW_OBJCOPY");
+        if(query) {
+            MINGW_OBJCOPY = STR.len;
+            size_t len = strlen(query);
+            CB_BUF_APPEND(&STR, query, len + 1);
+        } else {
+            return NULL;
+        }
+    }
+    return STR.ptr + MINGW_OBJCOPY;
+}
 #undef attempt
 
 const char *compiler_c(enum Target target) {
@@ -1892,27 +5190,343 @@ const char *archiver(enum Target target) {
     return result;
 }
 
+bool build_strips(struct OptionBuild *opt) {
+    if(opt->strip_symbols) {
+        return true;
+    }
+    // NOTE(alicia): packages that can't strip a copy are built without symbols
+    return opt->package && !objcopy(opt->target);
+}
+void wasm_features_append(struct OptionBuild *opt, CmdBuf *cmd) {
+    if(opt->target != T_WASM) {
+        return;
+    }
+    if(read_enable(opt, ENABLE_WASM_THREADS)) {
+        CB_CMD_APPEND(cmd, "-pthread", "-DWASM_THREADS=1");
+    }
+    if(read_enable(opt, ENABLE_WASM_SIMD)) {
+        CB_CMD_APPEND(cmd, "-msimd128", "-DWASM_SIMD=1");
+    }
+}
+const char *optimization_flag(struct OptionBuild *opt) {
+    if(read_enable(opt, ENABLE_SIZE)) {
+        return "-Os";
+    }
+    return opt->optimized ? "-O2" : "-O0";
+}
+const char *linker_flag(enum Target target) {
+    ini_parser_begin_section(&INI, "build");
+    const char *linker = ini_parser_read_string(&INI, "linker");
+    ini_parser_end_section(&INI);
+
+    // NOTE(alicia): mold and lld only link elf here,
+    // windows builds on windows already use lld.
+    if(target != T_LINUX || CB_OS_CURRENT != CB_OS_GNU_LINUX) {
+        return NULL;
+    }
+
+    if(strcmp(linker, "mold") == 0) {
+        return "-fuse-ld=mold";
+    }
+    if(strcmp(linker, "lld") == 0) {
+        return "-fuse-ld=lld";
+    }
+    if(strcmp(linker, "default") == 0) {
+        return NULL;
+    }
+
+    if(proc_exists("mold")) {
+        return "-fuse-ld=mold";
+    }
+    if(proc_exists("ld.lld")) {
+        return "-fuse-ld=lld";
+    }
+    return NULL;
+}
+const char *objcopy(enum Target target) {
+    switch(CB_OS_CURRENT) {
+        case CB_OS_GNU_LINUX: switch(target) {
+            case T_LINUX:
+                return proc_exists("objcopy") ? "objcopy" : NULL;
+            case T_WINDOWS:
+                return objcopy_linux_mingw();
+
+            case T_NATIVE:
+            case T_MACOS:
+            case T_WASM:
+            case T_COUNT:
+                break;
+        } break;
+        // NOTE(alicia): windows builds write .pdb files, already split
+        case CB_OS_WINDOWS:
+        case CB_OS_MACOS:
+        default:
+            break;
+    }
+    return NULL;
+}
 const char *build_dir(enum Target target) {
-    if(!BUILD_DIR) {
+    if(!BUILD_DIR[target]) {
         const char *text = local_fmt("build/%s", TARGET_NAMES[target]);
         size_t text_len  = strlen(text);
 
-        BUILD_DIR = STR.len;
+        BUILD_DIR[target] = STR.len;
         CB_BUF_APPEND(&STR, text, text_len + 1);
     }
-    return STR.ptr + BUILD_DIR;
+    return STR.ptr + BUILD_DIR[target];
 }
 const char *build_obj_dir(enum Target target) {
-    if(!BUILD_OBJ_DIR) {
+    if(!BUILD_OBJ_DIR[target]) {
         const char *text = local_fmt("build/%s/obj", TARGET_NAMES[target]);
         size_t text_len  = strlen(text);
 
-        BUILD_OBJ_DIR = STR.len;
+        BUILD_OBJ_DIR[target] = STR.len;
         CB_BUF_APPEND(&STR, text, text_len + 1);
     }
-    return STR.ptr + BUILD_OBJ_DIR;
+    return STR.ptr + BUILD_OBJ_DIR[target];
+}
+
+// path from dir back to project root, with trailing slash
+const char *relative_root(const char *dir) {
+    ByteBuf *buf = local_buf();
+    for(const char *c = dir; *c; ++c) {
+        if(c == dir || c[-1] == '/' || c[-1] == '\\') {
+            if(*c != '/' && *c != '\\') {
+                string_buf_fmt(buf, "../");
+            }
+        }
+    }
+    CB_BUF_PUSH(buf, 0);
+    return buf->ptr;
+}
+size_t str_push(const char *text) {
+    size_t offset = STR.len;
+    CB_BUF_APPEND(&STR, text, strlen(text) + 1);
+    return offset;
+}
+// modification time in nanoseconds
+int64_t stat_mtime_ns(const struct stat *st) {
+#if defined(_WIN32)
+    // NOTE(alicia): msvcrt stat only has seconds
+    return (int64_t)st->st_mtime * 1000000000;
+#elif defined(__APPLE__)
+    return (int64_t)st->st_mtimespec.tv_sec * 1000000000 + st->st_mtimespec.tv_nsec;
+#else
+    return (int64_t)st->st_mtim.tv_sec * 1000000000 + st->st_mtim.tv_nsec;
+#endif
+}
+// true if path doesn't exist or was modified before than
+bool path_older(const char *path, const char *than) {
+    struct stat st, than_st;
+    if(stat(path, &st)) {
+        return true;
+    }
+    if(stat(than, &than_st)) {
+        return false;
+    }
+    return stat_mtime_ns(&st) < stat_mtime_ns(&than_st);
+}
+// read size bytes at offset of f, NULL if f is too short
+uint8_t *file_read_at(FILE *f, uint64_t offset, size_t size) {
+    if(offset > LONG_MAX || fseek(f, (long)offset, SEEK_SET)) {
+        return NULL;
+    }
+    uint8_t *data = (uint8_t *)malloc(size ? size : 1);
+    if(data && fread(data, 1, size, f) != size) {
+        free(data);
+        data = NULL;
+    }
+    return data;
+}
+// true if executable at path has a .gnu_debuglink section.
+// NOTE(alicia): only headers and section names are read, same layouts as size_parse_elf
+// and size_parse_coff (mingw stores long names in the string table).
+bool exe_has_debuglink(const char *path) {
+    const char *want     = ".gnu_debuglink";
+    size_t      want_len = strlen(want) + 1;
+
+    FILE *f = fopen(path, "rb");
+    if(!f) {
+        return false;
+    }
+
+    bool    found = false;
+    uint8_t head[64];
+    if(fread(head, 1, sizeof(head), f) != sizeof(head)) {
+        fclose(f);
+        return false;
+    }
+
+    if(memcmp(head, "\x7F" "ELF", 4) == 0 && head[4] == 2 && head[5] == 1) {
+        uint64_t shoff     = read_le(head, sizeof(head), 0x28, 8);
+        uint64_t shentsize = read_le(head, sizeof(head), 0x3A, 2);
+        uint64_t shnum     = read_le(head, sizeof(head), 0x3C, 2);
+        uint64_t shstrndx  = read_le(head, sizeof(head), 0x3E, 2);
+
+        size_t   sh_len = shnum * shentsize;
+        uint8_t *sh     = NULL;
+        if(shentsize >= 64 && shstrndx < shnum) {
+            sh = file_read_at(f, shoff, sh_len);
+        }
+        if(sh) {
+            uint64_t str_at  = read_le(sh, sh_len, (shstrndx * shentsize) + 24, 8);
+            uint64_t str_len = read_le(sh, sh_len, (shstrndx * shentsize) + 32, 8);
+            uint8_t *str     = NULL;
+            if(str_len <= CB_MEBIBYTES(16)) {
+                str = file_read_at(f, str_at, str_len);
+            }
+            for(uint64_t i = 1; str && !found && i < shnum; ++i) {
+                uint64_t name = read_le(sh, sh_len, i * shentsize, 4);
+                found = name < str_len && str_len - name >= want_len &&
+                    memcmp(str + name, want, want_len) == 0;
+            }
+            free(str);
+            free(sh);
+        }
+    } else if(head[0] == 'M' && head[1] == 'Z') {
+        uint64_t pe   = read_le(head, sizeof(head), 0x3C, 4);
+        uint8_t *coff = file_read_at(f, pe, 24);
+        if(coff && memcmp(coff, "PE\0\0", 4) == 0) {
+            uint64_t nsections  = read_le(coff, 24, 4 + 2, 2);
+            uint64_t symtab     = read_le(coff, 24, 4 + 8, 4);
+            uint64_t nsymbols   = read_le(coff, 24, 4 + 12, 4);
+            uint64_t opt_header = read_le(coff, 24, 4 + 16, 2);
+            uint64_t strtab     = symtab + (nsymbols * 18);
+
+            size_t   sections_len = nsections * 40;
+            uint8_t *sections     = file_read_at(f, pe + 24 + opt_header, sections_len);
+            for(uint64_t i = 0; sections && !found && i < nsections; ++i) {
+                const char *name = (const char *)sections + (i * 40);
+                size_t name_len  = strnlen(name, 8);
+                if(name[0] == '/' && symtab) {
+                    uint64_t offset = strtoull(
+                        local_fmt("%.*s", (int)(name_len - 1), name + 1), NULL, 10);
+                    uint8_t *long_name = file_read_at(f, strtab + offset, want_len);
+                    found = long_name && memcmp(long_name, want, want_len) == 0;
+                    free(long_name);
+                } else {
+                    found = name_len + 1 == want_len && memcmp(name, want, name_len) == 0;
+                }
+            }
+            free(sections);
+        }
+        free(coff);
+    }
+
+    fclose(f);
+    return found;
+}
+size_t cpu_count(void) {
+#if defined(_WIN32)
+    const char *query = env_query("NUMBER_OF_PROCESSORS");
+    int count = query ? atoi(query) : 1;
+#else
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+    if(count < 1) {
+        return 1;
+    }
+    return (size_t)count;
+}
+const char *python(void) {
+    if(proc_exists("python3")) {
+        return "python3";
+    }
+    return "python";
+}
+const char *file_packager(void) {
+    if(!FILE_PACKAGER) {
+        const char *path = NULL;
+
+        const char *query = env_query("EMSCRIPTEN");
+        if(query) {
+            path = local_fmt("%s/tools/file_packager.py", query);
+        } else if((query = env_query("EMSDK"))) {
+            path = local_fmt("%s/upstream/emscripten/tools/file_packager.py", query);
+        }
+
+        if(!path || !path_exists(path)) {
+            return NULL;
+        }
+
+        FILE_PACKAGER = STR.len;
+        CB_BUF_APPEND(&STR, path, strlen(path) + 1);
+    }
+    return STR.ptr + FILE_PACKAGER;
+}
+const char *package_compression(void) {
+    ini_parser_begin_section(&INI, "package");
+    const char *compression = ini_parser_read_string(&INI, "compression");
+    ini_parser_end_section(&INI);
+
+    if(strcmp(compression, "xz") == 0) {
+        return "xz";
+    }
+    if(strcmp(compression, "zstd") && strlen(compression)) {
+        CB_INFO("unknown compression '%s', using zstd", compression);
+    }
+
+    // NOTE(alicia): zstd is not installed everywhere, xz is
+    if(!proc_exists("zstd")) {
+        return "xz";
+    }
+    return "zstd";
+}
+int package_compression_level(int fallback) {
+    ini_parser_begin_section(&INI, "package");
+    int level = ini_parser_read_integer(&INI, "compression-level");
+    ini_parser_end_section(&INI);
+
+    if(level <= 0) {
+        return fallback;
+    }
+    return level;
 }
+bool package_is_stored(const char *path) {
+    const char *ext = strrchr(path, '.');
+    if(!ext || strchr(ext, '/') || strchr(ext, '\\')) {
+        return false;
+    }
+    size_t ext_len = strlen(ext);
+
+    ini_parser_begin_section(&INI, "package");
+    const char *list = ini_parser_read_string(&INI, "store-extensions");
+    ini_parser_end_section(&INI);
 
+    while(*list) {
+        while(*list && isspace(*list)) {
+            list++;
+        }
+        size_t len = 0;
+        while(list[len] && !isspace(list[len])) {
+            len++;
+        }
+
+        if(len == ext_len) {
+            size_t i = 0;
+            for(; i < len; ++i) {
+                if(tolower(list[i]) != tolower(ext[i])) {
+                    break;
+                }
+            }
+            if(i == len) {
+                return true;
+            }
+        }
+
+        list += len;
+    }
+    return false;
+}
+const char *zip_tool(void) {
+    if(proc_exists("7z")) {
+        return "7z";
+    }
+    if(proc_exists("7za")) {
+        return "7za";
+    }
+    return "zip";
+}
 const char *program_ext(enum Target target) {
     switch(target) {
         case T_WINDOWS:
@@ -1961,7 +5575,10 @@ int ini_define(struct IniParserContext *ini) {
         }
 
         ini_parser_begin_field(ini, "window-width"); {
-            ini_parser_comment(ini, "initial width of window, minimum: 100");
+            ini_parser_comment(ini,
+                "initial width of window, minimum: 100\n"
+                "this and the fields below are written to settings.ini next to\n"
+                "the executable, editing them doesn't rebuild the project");
             ini_parser_value(ini, "800");
             ini_parser_end_field(ini);
         }
@@ -1978,6 +5595,23 @@ int ini_define(struct IniParserContext *ini) {
             ini_parser_end_field(ini);
         }
 
+        ini_parser_begin_field(ini, "asset-budget"); {
+            ini_parser_comment(ini,
+                "memory assets loaded through include/assets.h may hold before\n"
+                "least recently used ones are evicted, in bytes\n"
+                "0 disables eviction");
+            ini_parser_value(ini, "0");
+            ini_parser_end_field(ini);
+        }
+
+        ini_parser_begin_field(ini, "task-budget"); {
+            ini_parser_comment(ini,
+                "milliseconds per frame for tasks started through include/tasks.h\n"
+                "0 pauses them");
+            ini_parser_value(ini, "2");
+            ini_parser_end_field(ini);
+        }
+
         ini_parser_end_section(ini);
     }
 
@@ -1992,6 +5626,113 @@ int ini_define(struct IniParserContext *ini) {
             ini_parser_end_field(ini);
         }
 
+        ini_parser_begin_field(ini, "max-memory"); {
+            ini_parser_comment(ini,
+                "maximum memory wasm build can grow to, in bytes\n"
+                "0 or a value not above total-memory disables memory growth");
+            ini_parser_value(ini, "0");
+            ini_parser_end_field(ini);
+        }
+
+        ini_parser_begin_field(ini, "wasm-lazy-assets"); {
+            ini_parser_comment(ini,
+                "package each directory in resources/ separately for wasm builds,\n"
+                "only files directly in resources/ and wasm-boot-groups load before main\n"
+                "the rest are fetched in the background, see include/asset_groups.h");
+            ini_parser_value(ini, "false");
+            ini_parser_end_field(ini);
+        }
+
+        ini_parser_begin_field(ini, "wasm-boot-groups"); {
+            ini_parser_comment(ini,
+                "space separated directories in resources/ that load before main");
+            ini_parser_value(ini, "%s", "");
+            ini_parser_end_field(ini);
+        }
+
+        ini_parser_begin_field(ini, "linker"); {
+            ini_parser_comment(ini,
+                "linker for linux builds: auto, mold, lld or default\n"
+                "auto picks mold, then lld, then the compiler's default linker");
+            ini_parser_value(ini, "auto");
+            ini_parser_end_field(ini);
+        }
+
+        ini_parser_begin_field(ini, "split-debug"); {
+            ini_parser_comment(ini,
+                "move debug info out of executables into a .debug file next to them");
+            ini_parser_value(ini, "true");
+            ini_parser_end_field(ini);
+        }
+
+        ini_parser_begin_field(ini, "jobs"); {
+            ini_parser_comment(ini,
+                "maximum number of compilers/packagers running at once\n"
+                "0 uses the number of cpu cores");
+            ini_parser_value(ini, "0");
+            ini_parser_end_field(ini);
+        }
+
+        ini_parser_end_section(ini);
+    }
+
+    ini_parser_begin_section(ini, "raylib"); {
+        ini_parser_comment(ini,
+            "raylib modules and features\n"
+            "disabling unused modules and features makes builds faster and smaller");
+
+        for(enum RaylibModule m = RAYLIB_MODULE_BEGIN; m < RAYLIB_MODULE_COUNT; ++m) {
+            ini_parser_begin_field(ini, RAYLIB_MODULE_NAMES[m]); {
+                ini_parser_comment(ini, "compile %s module, true or false", RAYLIB_MODULE_NAMES[m]);
+                ini_parser_value(ini, "true");
+                ini_parser_end_field(ini);
+            }
+        }
+
+        ini_parser_begin_field(ini, "enable"); {
+            ini_parser_comment(ini,
+                "space separated SUPPORT_* flags from extern/raylib/src/config.h to turn on\n"
+                "example: SUPPORT_FILEFORMAT_JPG SUPPORT_FILEFORMAT_FLAC");
+            ini_parser_value(ini, "%s", "");
+            ini_parser_end_field(ini);
+        }
+
+        ini_parser_begin_field(ini, "disable"); {
+            ini_parser_comment(ini,
+                "space separated SUPPORT_* flags from extern/raylib/src/config.h to turn off\n"
+                "example: SUPPORT_GIF_RECORDING SUPPORT_SCREEN_CAPTURE SUPPORT_IMAGE_GENERATION");
+            ini_parser_value(ini, "%s", "");
+            ini_parser_end_field(ini);
+        }
+
+        ini_parser_end_section(ini);
+    }
+
+    ini_parser_begin_section(ini, "package"); {
+        ini_parser_comment(ini, "package settings");
+
+        ini_parser_begin_field(ini, "compression"); {
+            ini_parser_comment(ini,
+                "compressor for tar packages: zstd or xz\n"
+                "falls back to xz if zstd is not installed");
+            ini_parser_value(ini, "zstd");
+            ini_parser_end_field(ini);
+        }
+
+        ini_parser_begin_field(ini, "compression-level"); {
+            ini_parser_comment(ini, "compression level, 0 uses the compressor's default");
+            ini_parser_value(ini, "0");
+            ini_parser_end_field(ini);
+        }
+
+        ini_parser_begin_field(ini, "store-extensions"); {
+            ini_parser_comment(ini,
+                "files with these extensions are already compressed,\n"
+                "zip packages store them without recompressing");
+            ini_parser_value(ini, ".png .jpg .jpeg .qoi .ogg .mp3 .qoa .flac .zip .gz .br .xz .zst");
+            ini_parser_end_field(ini);
+        }
+
         ini_parser_end_section(ini);
     }
 
@@ -2077,6 +5818,21 @@ int error(int ec, ...) {
             const char *msg = va_arg(va, const char *);
             CB_ERROR("feature unimplemented: %s", msg);
         } break;
+        case E_RUN_TARGETS: {
+            int count = va_arg(va, int);
+            CB_ERROR("run takes exactly one target but %i were given!", count);
+        } break;
+        case E_CONFIG: {
+            const char *section = va_arg(va, const char *);
+            const char *field   = va_arg(va, const char *);
+            const char *msg     = va_arg(va, const char *);
+            CB_ERROR("config.ini [%s] %s: %s", section, field, msg);
+        } break;
+        case E_SERVER: {
+            const char *call = va_arg(va, const char *);
+            int         err  = va_arg(va, int);
+            CB_ERROR("local server: %s failed: %s", call, strerror(err));
+        } break;
 
         case E_NONE:
         case E_COUNT:
@@ -0,0 +1,51 @@
+#if !defined(ASSET_GROUPS_H)
+#define ASSET_GROUPS_H
+/**
+ * @file   include/asset_groups.h
+ * @brief  Lazily loaded asset groups for WASM builds.
+ * @author Alicia D. Amarilla (smushyaa@gmail.com)
+ * @date   October 18, 2026
+ *
+ * With config.ini [build] wasm-lazy-assets, every directory in resources/
+ * is packaged on its own and fetched in the background after main starts.
+ * Files directly in resources/ and directories in wasm-boot-groups load
+ * before main like before.
+ *
+ * Groups are named after their directory, "levels" for resources/levels/.
+ * On other platforms and without wasm-lazy-assets every group is always ready.
+*/
+
+enum AssetGroupState {
+    ASSET_GROUP_UNLOADED,
+    ASSET_GROUP_LOADING,
+    ASSET_GROUP_READY,
+    ASSET_GROUP_FAILED,
+};
+
+/// Called when a group's download progress or state changes.
+/// Progress is 0 to 1.
+typedef void AssetGroupCallback(
+    const char *group, enum AssetGroupState state, float progress, void *user);
+
+/// Start fetching groups in the background, one at a time.
+void InitAssetGroups(void);
+/// Poll downloads and report progress. Call once per frame.
+void UpdateAssetGroups(void);
+
+/// Fetch group now instead of waiting for its turn in the background.
+/// Returns false if there is no group with that name.
+bool RequestAssetGroup(const char *group);
+
+enum AssetGroupState GetAssetGroupState(const char *group);
+/// Download progress of group, 0 to 1.
+float GetAssetGroupProgress(const char *group);
+bool IsAssetGroupReady(const char *group);
+
+/// Number of lazily loaded groups, 0 on other platforms.
+int GetAssetGroupCount(void);
+/// Name of lazily loaded group at index.
+const char *GetAssetGroupName(int index);
+
+void SetAssetGroupCallback(AssetGroupCallback *callback, void *user);
+
+#endif /* header guard */
@@ -0,0 +1,136 @@
+#if !defined(ASSETS_H)
+#define ASSETS_H
+/**
+ * @file   include/assets.h
+ * @brief  Asynchronous asset loading.
+ * @author Alicia D. Amarilla (smushyaa@gmail.com)
+ * @date   October 18, 2026
+ *
+ * Files are read and decoded by jobs (see jobs.h), GPU and audio uploads
+ * happen on the main thread in UpdateAssets within a per-frame budget.
+ *
+ * Loading the same path twice returns the same handle,
+ * assets are unloaded once every handle to them is unloaded.
+ *
+ * Reloaded assets keep their handle, the old object is used
+ * until the new one is uploaded by UpdateAssets.
+ *
+ * When resident memory goes over budget, assets that weren't used last frame
+ * are evicted least recently used first. Evicted assets keep their handle and
+ * load again the next time they're used.
+*/
+#include "raylib.h"
+#include <stdint.h>
+#include <stddef.h>
+
+/// Default milliseconds per frame spent uploading decoded assets.
+#define ASSET_UPLOAD_BUDGET_MS 2.0
+
+/// Maximum number of assets loaded at once.
+#define ASSET_CAPACITY 1024
+
+/// Size fonts are rasterized at.
+#define ASSET_FONT_SIZE 32
+
+enum AssetType {
+    ASSET_TYPE_TEXTURE,
+    ASSET_TYPE_SOUND,
+    ASSET_TYPE_FONT,
+    ASSET_TYPE_SHADER,
+    ASSET_TYPE_MUSIC,
+    ASSET_TYPE_MODEL,
+
+    ASSET_TYPE_COUNT
+};
+
+enum AssetState {
+    ASSET_STATE_NONE,     // handle is invalid or unloaded
+    ASSET_STATE_LOADING,  // reading and decoding on a worker
+    ASSET_STATE_DECODED,  // waiting for upload on main thread
+    ASSET_STATE_READY,
+    ASSET_STATE_FAILED,
+    ASSET_STATE_EVICTED,  // unloaded to stay within budget, loads again when used
+};
+
+/// Handle to an asset, stays valid until unloaded.
+/// Handles with id 0 are invalid.
+typedef struct AssetHandle {
+    uint32_t id;
+} AssetHandle;
+
+/// Bytes of memory held by assets.
+typedef struct AssetMemory {
+    size_t cpu;
+    size_t gpu;
+} AssetMemory;
+
+void InitAssets(void);
+/// Upload decoded assets. Call once per frame on the main thread.
+void UpdateAssets(void);
+/// Unload every asset, waits for jobs still decoding.
+void ShutdownAssets(void);
+
+/// Milliseconds per frame UpdateAssets may spend on uploads.
+/// At least one asset is uploaded per frame regardless.
+void SetAssetUploadBudget(double budget_ms);
+/// Resident bytes (cpu + gpu) before assets are evicted, 0 (default) for no budget.
+void SetAssetBudget(size_t bytes);
+size_t GetAssetBudget(void);
+
+AssetHandle LoadTextureAsync(const char *path);
+/// Sounds fail to load when raudio is disabled in config.ini.
+AssetHandle LoadSoundAsync(const char *path);
+AssetHandle LoadFontAsync(const char *path);
+/// Either path may be NULL to use raylib's default shader stage.
+AssetHandle LoadShaderAsync(const char *vs_path, const char *fs_path);
+/// Music is streamed from disk, only the stream is created on upload.
+/// Fails to load when raudio is disabled.
+AssetHandle LoadMusicAsync(const char *path);
+/// Models are parsed and uploaded together on the main thread.
+/// Fails to load when rmodels is disabled.
+AssetHandle LoadModelAsync(const char *path);
+/// Release handle. Asset is unloaded when no handles to it remain.
+void UnloadAsset(AssetHandle handle);
+/// Pinned assets are never evicted.
+void SetAssetPinned(AssetHandle handle, bool pinned);
+
+enum AssetState GetAssetState(AssetHandle handle);
+bool IsAssetReady(AssetHandle handle);
+enum AssetType GetAssetType(AssetHandle handle);
+/// Path of asset, the fragment shader path for shaders.
+const char *GetAssetPath(AssetHandle handle);
+
+// NOTE(alicia): getters below count as a use of the asset for eviction,
+// evicted assets start loading again when one is called.
+
+/// Texture of handle, an empty texture until ready.
+Texture2D GetTexture(AssetHandle handle);
+/// Sound of handle, an empty sound until ready.
+Sound GetSound(AssetHandle handle);
+/// Font of handle, raylib's default font until ready.
+Font GetFont(AssetHandle handle);
+/// Shader of handle, raylib's default shader until ready.
+Shader GetShader(AssetHandle handle);
+/// Music of handle, an empty music stream until ready.
+Music GetMusic(AssetHandle handle);
+/// Model of handle, an empty model until ready.
+Model GetModel(AssetHandle handle);
+
+/// Resident memory of every asset of type.
+AssetMemory GetAssetMemory(enum AssetType type);
+/// Resident memory of every asset.
+AssetMemory GetAssetMemoryTotal(void);
+/// Resident memory of asset.
+AssetMemory GetAssetMemoryOf(AssetHandle handle);
+
+/// Reload every asset that uses the file at path.
+/// Returns number of assets reloading.
+int ReloadAssetFile(const char *path);
+/// Reload every asset whose files were modified since they were loaded.
+/// Returns number of assets reloading.
+int ReloadModifiedAssets(void);
+
+/// Number of assets still loading or waiting for upload.
+int GetAssetsLoadingCount(void);
+
+#endif /* header guard */
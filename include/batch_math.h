@@ -0,0 +1,68 @@
+#if !defined(BATCH_MATH_H)
+#define BATCH_MATH_H
+/**
+ * @file   include/batch_math.h
+ * @brief  Math on arrays of floats, vectorized.
+ * @author Alicia D. Amarilla (smushyaa@gmail.com)
+ * @date   October 18, 2026
+ *
+ * Batch functions take one array per component (x, y, z, ...)
+ * instead of arrays of Vector3, so several elements fit a SIMD register.
+ * Outputs may alias inputs of the same component.
+ *
+ * InitBatchMath picks the widest path the cpu supports:
+ * AVX2 or SSE2 on x86, SIMD128 on WASM built with --enable wasm-simd,
+ * scalar everywhere else. Every path does the same operations in the same
+ * order without fused multiply-add, so results are identical on every path
+ * and replays (see input.h) don't depend on the cpu they run on.
+*/
+#include "raylib.h"
+#include "spatial.h"
+#include <stdint.h>
+
+enum BatchMathPath {
+    BATCH_MATH_PATH_SCALAR,
+    BATCH_MATH_PATH_SSE2,
+    BATCH_MATH_PATH_AVX2,
+    BATCH_MATH_PATH_WASM_SIMD128,
+
+    BATCH_MATH_PATH_COUNT
+};
+
+/// Select fastest supported path.
+void InitBatchMath(void);
+/// Force path, for comparing paths in benchmarks.
+/// Returns false if path isn't supported by this build or cpu.
+bool SetBatchMathPath(enum BatchMathPath path);
+enum BatchMathPath GetBatchMathPath(void);
+const char *GetBatchMathPathName(enum BatchMathPath path);
+
+/// out = matrix * (x, y, z, 1), without dividing by w.
+void BatchTransformPoints(
+    Matrix matrix, const float *x, const float *y, const float *z,
+    float *out_x, float *out_y, float *out_z, int count);
+
+/// Semi-implicit Euler along one axis:
+///     velocity = (velocity + acceleration * dt) * damping
+///     position = position + velocity * dt
+void BatchIntegrate(
+    float *position, float *velocity, float acceleration, float damping, float dt, int count);
+
+/// out_hits[i] is 1 if rectangle i overlaps area, 0 otherwise.
+/// Returns number of overlapping rectangles.
+int BatchOverlapRects(
+    const float *x, const float *y, const float *width, const float *height,
+    Rectangle area, uint8_t *out_hits, int count);
+/// out_hits[i] is 1 if box i overlaps area, 0 otherwise.
+/// Returns number of overlapping boxes.
+int BatchOverlapBoxes(
+    const float *min_x, const float *min_y, const float *min_z,
+    const float *max_x, const float *max_y, const float *max_z,
+    BoundingBox area, uint8_t *out_hits, int count);
+/// out_hits[i] is 1 if sphere i is at least partly inside frustum, 0 otherwise.
+/// Returns number of visible spheres.
+int BatchCullSpheres(
+    const Frustum *frustum, const float *x, const float *y, const float *z, const float *radius,
+    uint8_t *out_hits, int count);
+
+#endif /* header guard */
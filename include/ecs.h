@@ -0,0 +1,96 @@
+#if !defined(ECS_H)
+#define ECS_H
+/**
+ * @file   include/ecs.h
+ * @brief  Entities, components and systems.
+ * @author Alicia D. Amarilla (smushyaa@gmail.com)
+ * @date   October 18, 2026
+ *
+ * Each component type is a sparse set: a dense array of component values,
+ * a parallel dense array of the entities that own them and a sparse array
+ * from entity index to dense index.
+ *
+ * QueryEntities packs the entities that have every queried component
+ * to the front of each component's dense arrays, in the same order,
+ * so a system walks plain contiguous arrays. Packing is incremental,
+ * a query that ran last frame with no structural changes swaps nothing.
+ * Two queries over the same component fight over its order,
+ * prefer one query per component set.
+ *
+ * Creating, destroying and adding or removing components is only safe
+ * from the thread running systems (see pipeline.h) and invalidates views.
+ * Parallel systems may only write to the components of entities
+ * in their own range.
+*/
+#include <stdint.h>
+#include <stddef.h>
+
+/// Entities alive at once when InitEcs is given 0.
+#define ECS_ENTITY_CAPACITY (1 << 17)
+/// Component types, every entity's components fit in a 64-bit mask.
+#define ECS_COMPONENT_MAX   64
+#define ECS_SYSTEM_MAX      64
+/// Components per query.
+#define ECS_QUERY_MAX       8
+/// Entities per job when a parallel system fans out.
+#define ECS_CHUNK_SIZE      4096
+
+/// Handle to an entity, stale once the entity is destroyed.
+/// Entities with id 0 are invalid.
+typedef struct Entity {
+    uint32_t id;
+} Entity;
+
+/// Matching entities of a query, components[i] is the dense array
+/// of the i-th queried component and components[i][n] belongs to entities[n].
+/// Valid until the next structural change or query.
+typedef struct EcsView {
+    int count;
+    const Entity *entities;
+    void *components[ECS_QUERY_MAX];
+} EcsView;
+
+/// Run on entities [begin, end) of view.
+typedef void SystemFN(const EcsView *view, int begin, int end, float dt, void *user);
+
+/// Allocate storage for entity_capacity entities, 0 for ECS_ENTITY_CAPACITY.
+void InitEcs(int entity_capacity);
+/// Free every entity, component and system.
+void ShutdownEcs(void);
+
+/// Returns invalid entity when every entity is in use.
+Entity CreateEntity(void);
+void DestroyEntity(Entity entity);
+bool IsEntityAlive(Entity entity);
+int GetEntityCount(void);
+
+/// Register a component type of size bytes, size may be 0 for tags.
+/// Returns component id or -1 if ECS_COMPONENT_MAX are registered.
+int RegisterComponent(const char *name, size_t size);
+#define REGISTER_COMPONENT(type) RegisterComponent(#type, sizeof(type))
+
+/// Returns zeroed component, or existing component if entity already has it.
+/// Returns NULL if entity is not alive.
+void *AddComponent(Entity entity, int component);
+void RemoveComponent(Entity entity, int component);
+bool HasComponent(Entity entity, int component);
+/// Returns NULL if entity doesn't have component.
+void *GetComponent(Entity entity, int component);
+/// Number of entities with component.
+int GetComponentCount(int component);
+
+/// Pack entities with every one of components and fill out_view.
+/// Returns false if components are invalid.
+bool QueryEntities(const int *components, int component_count, EcsView *out_view);
+
+/// Register fn to run on entities with every one of components.
+/// Parallel systems are split into ECS_CHUNK_SIZE ranges and run on job workers,
+/// RunSystems waits for them to finish before the next system.
+/// Returns system id or -1 if ECS_SYSTEM_MAX are registered.
+int RegisterSystem(
+    const char *name, SystemFN *fn,
+    const int *components, int component_count, bool parallel, void *user);
+/// Run systems in the order they were registered.
+void RunSystems(float dt);
+
+#endif /* header guard */
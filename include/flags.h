@@ -0,0 +1,65 @@
+#if !defined(FLAGS_H)
+#define FLAGS_H
+/**
+ * @file   include/flags.h
+ * @brief  Command-line flags for benchmark and profiling runs.
+ * @author Alicia D. Amarilla (smushyaa@gmail.com)
+ * @date   October 18, 2026
+ *
+ * Passed through the build system with:
+ *     ./build.bin run -- --frames 600 --profile-out frames.csv
+ * Flags override settings.ini (see settings.h).
+*/
+#include <stdint.h>
+
+/// Longest path or name accepted by string flags.
+#define FLAGS_STRING_MAX 256
+
+typedef struct Flags {
+    /// --frames N: exit after N frames, 0 runs until the window is closed.
+    int frames;
+    /// --fps-cap N: target framerate, 0 for uncapped, -1 when not given.
+    int fps_cap;
+    /// --vsync: wait for vertical sync.
+    bool vsync;
+    /// --headless: keep the window hidden.
+    bool headless;
+    /// --profile-out PATH: write frame times to PATH as csv, empty when not given.
+    char profile_out[FLAGS_STRING_MAX];
+    /// --seed N: seed for GetRandomValue, has_seed is false when not given.
+    /// Applied by InitInput, InitWindow reseeds raylib's generator.
+    uint64_t seed;
+    bool     has_seed;
+    /// --bench-scene NAME: scene to benchmark, empty when not given.
+    char bench_scene[FLAGS_STRING_MAX];
+    /// --log-level LEVEL: raylib TraceLogLevel.
+    int log_level;
+    /// --record PATH: record input to PATH, empty when not given.
+    char record[FLAGS_STRING_MAX];
+    /// --replay PATH: replay input from PATH, empty when not given.
+    char replay[FLAGS_STRING_MAX];
+    /// --replay-fps N: replay with a fixed frame time of 1/N seconds,
+    /// 0 for the recorded frame times.
+    int replay_fps;
+    /// --pipeline: simulate next frame while drawing this one (see pipeline.h).
+    bool pipeline;
+    /// --log-out PATH: write log to PATH instead of stdout, empty when not given.
+    char log_out[FLAGS_STRING_MAX];
+} Flags;
+
+typedef enum ParseFlagsResult {
+    PARSE_FLAGS_RUN,
+    /// --help was printed.
+    PARSE_FLAGS_EXIT,
+    /// Unknown or malformed flag.
+    PARSE_FLAGS_ERROR
+} ParseFlagsResult;
+
+/// Parse command-line flags and apply log level.
+/// Call first thing in main, before LoadSettings.
+/// Exit unless PARSE_FLAGS_RUN is returned, with a nonzero code on PARSE_FLAGS_ERROR.
+ParseFlagsResult ParseFlags(int argc, char **argv);
+/// Flags parsed by ParseFlags, defaults before that.
+const Flags *GetFlags(void);
+
+#endif /* header guard */
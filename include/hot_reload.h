@@ -0,0 +1,24 @@
+#if !defined(HOT_RELOAD_H)
+#define HOT_RELOAD_H
+/**
+ * @file   include/hot_reload.h
+ * @brief  Reload assets when their files change.
+ * @author Alicia D. Amarilla (smushyaa@gmail.com)
+ * @date   October 18, 2026
+ *
+ * Only active in builds with --enable hot-reload, otherwise every function does nothing.
+ * Linux watches files with inotify, other platforms poll modification times.
+ * Changed assets are decoded in the background and swapped in by UpdateAssets (see assets.h).
+*/
+
+/// Seconds between checks on platforms without inotify.
+#define HOT_RELOAD_POLL_SECONDS 0.5
+
+/// Start watching dir and its subdirectories.
+/// Returns false if hot reload is disabled or dir can't be watched.
+bool InitHotReload(const char *dir);
+/// Queue reloads for changed files. Call once per frame, before UpdateAssets.
+void UpdateHotReload(void);
+void ShutdownHotReload(void);
+
+#endif /* header guard */
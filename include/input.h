@@ -0,0 +1,82 @@
+#if !defined(INPUT_H)
+#define INPUT_H
+/**
+ * @file   include/input.h
+ * @brief  Input snapshots with deterministic record and replay.
+ * @author Alicia D. Amarilla (smushyaa@gmail.com)
+ * @date   October 18, 2026
+ *
+ * Game code reads input through these functions instead of raylib's,
+ * so a replay can stand in for live polling.
+ *
+ * UpdateInput takes one snapshot per frame of keyboard, mouse, gamepads,
+ * window events and frame delta. When recording, the change from the previous
+ * snapshot is appended to a log; when replaying, snapshots come from that log
+ * and the frame delta is the recorded one, so the same frames run the same code.
+ * SetReplayFrameTime replaces recorded deltas with a fixed timestep instead,
+ * for runs compared across machines.
+ * The random seed is stored in the log and restored on replay.
+*/
+#include "raylib.h"
+#include <stdint.h>
+
+/// Number of keys tracked, every raylib KeyboardKey is below this.
+#define INPUT_KEY_COUNT     512
+#define INPUT_GAMEPAD_COUNT 4
+/// Gamepad axes tracked, raylib's GamepadAxis.
+#define INPUT_AXIS_COUNT    6
+/// Characters of text input kept per frame.
+#define INPUT_CHAR_MAX      16
+
+enum InputMode {
+    INPUT_MODE_LIVE,
+    INPUT_MODE_RECORD,
+    INPUT_MODE_REPLAY,
+};
+
+/// Start reading input. path is the log to write or read, ignored for INPUT_MODE_LIVE.
+/// Seeds raylib's random generator with seed, or the log's seed on replay.
+/// Returns false and falls back to live input if the log can't be opened.
+bool InitInput(enum InputMode mode, const char *path, uint64_t seed);
+/// Take this frame's snapshot. Call once at the start of every frame.
+void UpdateInput(void);
+/// Finish writing the log.
+void ShutdownInput(void);
+/// Replay with dt seconds per frame instead of the recorded deltas, 0 to use them.
+/// Call after InitInput.
+void SetReplayFrameTime(float dt);
+
+enum InputMode GetInputMode(void);
+/// True once a replay has fed every recorded frame.
+bool IsReplayFinished(void);
+/// Frames taken since InitInput.
+uint64_t GetInputFrame(void);
+
+bool IsInputKeyDown(int key);
+bool IsInputKeyPressed(int key);
+bool IsInputKeyReleased(int key);
+/// Next character of text input this frame, 0 when there are none left.
+int GetInputCharPressed(void);
+
+Vector2 GetInputMousePosition(void);
+Vector2 GetInputMouseWheelMove(void);
+bool IsInputMouseButtonDown(int button);
+bool IsInputMouseButtonPressed(int button);
+bool IsInputMouseButtonReleased(int button);
+
+bool IsInputGamepadAvailable(int gamepad);
+bool IsInputGamepadButtonDown(int gamepad, int button);
+bool IsInputGamepadButtonPressed(int gamepad, int button);
+float GetInputGamepadAxisMovement(int gamepad, int axis);
+
+bool IsInputWindowResized(void);
+bool IsInputWindowFocused(void);
+int GetInputScreenWidth(void);
+int GetInputScreenHeight(void);
+
+/// Seconds since last frame, the recorded or fixed delta on replay.
+float GetInputFrameTime(void);
+/// Sum of frame times since InitInput, use instead of GetTime for game logic.
+double GetInputTime(void);
+
+#endif /* header guard */
@@ -0,0 +1,38 @@
+#if !defined(JOBS_H)
+#define JOBS_H
+/**
+ * @file   include/jobs.h
+ * @brief  Worker threads for running jobs off the main thread.
+ * @author Alicia D. Amarilla (smushyaa@gmail.com)
+ * @date   October 18, 2026
+ *
+ * Jobs are run in the order they are submitted by a pool of worker threads.
+ * WASM builds without --enable wasm-threads have no workers,
+ * their jobs are run on the main thread by RunPendingJobs.
+*/
+
+/// Maximum number of jobs waiting to run.
+#define JOB_QUEUE_CAPACITY 1024
+
+typedef void JobFN(void *params);
+
+/// Start worker threads. 0 uses one worker per cpu core, minus the main thread.
+void InitJobs(int worker_count);
+/// Wait for running jobs and stop workers, jobs still queued are dropped.
+void ShutdownJobs(void);
+
+/// Queue fn to run on a worker.
+/// Returns false if the queue is full.
+bool SubmitJob(JobFN *fn, void *params);
+
+/// Run queued jobs on the calling thread until the queue is empty
+/// or budget_ms is spent. Returns number of jobs run.
+/// Only needed when GetJobWorkerCount() is 0.
+int RunPendingJobs(double budget_ms);
+
+/// Number of worker threads, 0 when jobs run on the main thread.
+int GetJobWorkerCount(void);
+/// Number of jobs waiting to run.
+int GetPendingJobCount(void);
+
+#endif /* header guard */
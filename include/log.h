@@ -0,0 +1,51 @@
+#if !defined(LOG_H)
+#define LOG_H
+/**
+ * @file   include/log.h
+ * @brief  TraceLog output off the frame thread.
+ * @author Alicia D. Amarilla (smushyaa@gmail.com)
+ * @date   October 18, 2026
+ *
+ * InitLog installs a TraceLog callback that formats messages into
+ * a ring buffer shared by every thread, a background thread writes them
+ * to stdout or a file. Logging doesn't wait on I/O, when the ring is full
+ * messages are dropped and counted, the writer notes how many it missed.
+ * Errors that find the ring full are written right away instead.
+ *
+ * Messages below the TraceLog level (--log-level) are filtered by raylib
+ * before they're formatted. When logging to a file, messages at or above
+ * the echo level are written to stdout too.
+ *
+ * LOG_FATAL messages are written right away with everything queued before
+ * them, then the program exits the same as raylib does without a callback.
+ *
+ * WASM builds write every message synchronously.
+ *
+ * Game code logs through TraceLog rather than printf to get the same path.
+*/
+#include <stdint.h>
+
+/// Messages queued at once, power of two.
+#define LOG_RING_CAPACITY 1024
+/// Longest message in bytes, including level prefix, longer ones are cut.
+#define LOG_MESSAGE_MAX   512
+/// Longest the writer sleeps before writing what's queued.
+#define LOG_FLUSH_MS      50
+
+typedef struct LogStats {
+    uint64_t written;
+    uint64_t dropped;
+} LogStats;
+
+/// Log to path, or stdout when path is NULL or empty.
+/// echo_level is the lowest TraceLogLevel also written to stdout
+/// when logging to a file, LOG_NONE for none.
+void InitLog(const char *path, int echo_level);
+/// Write what's queued, stop the writer and restore raylib's logging.
+void ShutdownLog(void);
+
+/// Wait until every message logged so far is written.
+void FlushLog(void);
+LogStats GetLogStats(void);
+
+#endif /* header guard */
@@ -0,0 +1,43 @@
+#if !defined(PIPELINE_H)
+#define PIPELINE_H
+/**
+ * @file   include/pipeline.h
+ * @brief  Simulating the next frame while drawing the current one.
+ * @author Alicia D. Amarilla (smushyaa@gmail.com)
+ * @date   October 18, 2026
+ *
+ * The simulate function updates the game and records draws
+ * with the render queue (see render_queue.h).
+ *
+ * Single-threaded, BeginPipelineFrame runs simulate and its draws
+ * are flushed the same frame.
+ *
+ * Threaded, simulate runs on its own thread: BeginPipelineFrame starts
+ * frame N + 1 while the main thread flushes the draws of frame N,
+ * then EndPipelineFrame waits for it. Draws show up one frame later.
+ * The GL context, window and event polling stay on the main thread,
+ * raylib polls events in EndDrawing.
+ *
+ * While simulate runs, the main thread only draws. Everything it does
+ * before BeginPipelineFrame (input, asset uploads) is visible to simulate,
+ * simulate must not call raylib's drawing or window functions.
+ *
+ * WASM builds are always single-threaded, the browser can't block the main thread.
+*/
+
+typedef void SimulateFN(float dt, void *user);
+
+/// Threaded is ignored on WASM.
+void InitPipeline(SimulateFN *simulate, void *user, bool threaded);
+/// Wait for the running frame and stop the simulation thread.
+void ShutdownPipeline(void);
+
+/// Start simulating a frame of dt seconds.
+/// Call after main thread updates and before FlushRenderQueue.
+void BeginPipelineFrame(float dt);
+/// Wait for the frame started by BeginPipelineFrame. Call after EndDrawing.
+void EndPipelineFrame(void);
+
+bool IsPipelineThreaded(void);
+
+#endif /* header guard */
@@ -0,0 +1,23 @@
+#if !defined(PROFILE_H)
+#define PROFILE_H
+/**
+ * @file   include/profile.h
+ * @brief  Per-frame timing for --profile-out.
+ * @author Alicia D. Amarilla (smushyaa@gmail.com)
+ * @date   October 18, 2026
+ *
+ * Frame time is measured between calls to BeginFrameProfile,
+ * work time from BeginFrameProfile to EndFrameProfile (before EndDrawing waits).
+*/
+
+/// Start recording frame times, written to path by ShutdownFrameProfile.
+/// Does nothing if path is NULL or empty.
+void InitFrameProfile(const char *path);
+/// Call at the start of every frame.
+void BeginFrameProfile(void);
+/// Call before EndDrawing.
+void EndFrameProfile(void);
+/// Write recorded frames as csv and log a summary.
+void ShutdownFrameProfile(void);
+
+#endif /* header guard */
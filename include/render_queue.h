@@ -0,0 +1,75 @@
+#if !defined(RENDER_QUEUE_H)
+#define RENDER_QUEUE_H
+/**
+ * @file   include/render_queue.h
+ * @brief  Sorted 2D draw commands.
+ * @author Alicia D. Amarilla (smushyaa@gmail.com)
+ * @date   October 18, 2026
+ *
+ * Sprites, rectangles and text are queued during the frame and drawn
+ * by FlushRenderQueue, sorted by layer, shader, texture then depth,
+ * so commands sharing a texture end up in the same rlgl draw call.
+ *
+ * Layers order overlapping draws, depth only orders draws
+ * that share layer, shader and texture. Commands with equal keys
+ * are drawn in the order they were queued.
+ *
+ * Queued commands are drawn on top of anything drawn directly that frame.
+ *
+ * Recording and drawing can be on different threads (see pipeline.h).
+ * SubmitRenderQueue hands the recorded list to the drawing side,
+ * FlushRenderQueue draws the latest submitted list, or the previous one
+ * again if nothing new was submitted.
+ *
+ * With a view set, sprites and rectangles off screen aren't queued at all:
+ *     SetRenderQueueView(GetCameraView2D(camera, width, height));
+*/
+#include "raylib.h"
+
+/// Layers are 0 to RENDER_LAYER_COUNT - 1, drawn lowest first.
+#define RENDER_LAYER_COUNT 256
+
+/// Draw calls of the last FlushRenderQueue.
+typedef struct RenderQueueStats {
+    int commands;
+    /// Runs of commands sharing shader and texture.
+    int batches;
+    /// Sprites and rectangles dropped outside the view.
+    int culled;
+} RenderQueueStats;
+
+void InitRenderQueue(void);
+/// Free queued commands.
+void ShutdownRenderQueue(void);
+
+/// Finish recording, the list is drawn by the next FlushRenderQueue.
+void SubmitRenderQueue(void);
+
+/// Commands queued until EndQueueShader are drawn with shader.
+void BeginQueueShader(Shader shader);
+void EndQueueShader(void);
+
+/// Sprites and rectangles queued until ClearRenderQueueView are dropped
+/// when they miss view, in the space they're drawn in (see GetCameraView2D).
+/// Rotated ones are kept if their pivot is close enough to reach it.
+/// Text is never dropped.
+void SetRenderQueueView(Rectangle view);
+void ClearRenderQueueView(void);
+
+/// Same as DrawTexturePro.
+void QueueTexture(
+    Texture2D texture, Rectangle source, Rectangle dest,
+    Vector2 origin, float rotation, Color tint, int layer, float depth);
+/// Same as DrawRectanglePro.
+void QueueRectangle(
+    Rectangle rec, Vector2 origin, float rotation, Color color, int layer, float depth);
+/// Same as DrawTextEx, text is copied.
+void QueueText(
+    Font font, const char *text, Vector2 position,
+    float font_size, float spacing, Color tint, int layer, float depth);
+
+/// Sort and draw the latest submitted list. Call between BeginDrawing and EndDrawing.
+void FlushRenderQueue(void);
+RenderQueueStats GetRenderQueueStats(void);
+
+#endif /* header guard */
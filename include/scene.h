@@ -0,0 +1,105 @@
+#if !defined(SCENE_H)
+#define SCENE_H
+/**
+ * @file   include/scene.h
+ * @brief  Hierarchy of transforms.
+ * @author Alicia D. Amarilla (smushyaa@gmail.com)
+ * @date   October 18, 2026
+ *
+ * Every node has a local transform relative to its parent and a world
+ * transform, world = MatrixMultiply(local, parent world) like raylib's
+ * own transforms (see DrawModelEx).
+ *
+ * Local and world matrices are kept in separate arrays sorted by depth,
+ * parents before children. Changing a node marks it dirty, UpdateScene
+ * recomputes dirty nodes and their descendants only, depth by depth,
+ * starting at the shallowest dirty node. A frame where nothing moved
+ * costs nothing. Depths with many nodes can be split across job workers.
+ *
+ * World transforms are the ones computed by the last UpdateScene.
+ *
+ * Nodes given bounds are kept in a SpatialTree (see spatial.h) by their
+ * world box, UpdateScene moves the ones it recomputed. Drawing only
+ * what a camera sees:
+ *     Frustum frustum = GetCameraFrustum(camera, aspect);
+ *     int count = CullScene(&frustum, visible, max);
+ * then DrawSceneModel for each visible node.
+ *
+ * Nodes are changed, updated and drawn from one thread. Simulate runs on
+ * its own thread with --pipeline (see pipeline.h), keep 3D scenes on the
+ * main thread there and call UpdateScene before BeginPipelineFrame.
+*/
+#include "raylib.h"
+#include "spatial.h"
+#include <stdint.h>
+
+/// Nodes alive at once when InitScene is given 0.
+#define SCENE_NODE_CAPACITY (1 << 16)
+/// Nodes per job when a depth is split across job workers.
+#define SCENE_CHUNK_SIZE    2048
+/// World boxes of nodes with bounds are grown by this much in the culling tree.
+#define SCENE_CULL_MARGIN   0.5f
+
+/// Handle to a node, stale once the node is destroyed.
+/// Nodes with id 0 are invalid.
+typedef struct SceneNode {
+    uint32_t id;
+} SceneNode;
+
+/// Last UpdateScene.
+typedef struct SceneStats {
+    int nodes;
+    /// World transforms recomputed.
+    int updated;
+    /// Deepest node, roots are depth 0.
+    int depth;
+    /// Nodes with bounds that moved in the culling tree.
+    int moved;
+} SceneStats;
+
+/// Allocate storage for node_capacity nodes, 0 for SCENE_NODE_CAPACITY.
+void InitScene(int node_capacity);
+/// Free every node.
+void ShutdownScene(void);
+
+/// Create node with identity local transform, invalid parent makes a root.
+/// Returns invalid node when every node is in use.
+SceneNode CreateSceneNode(SceneNode parent);
+/// Destroy node and all of its descendants.
+void DestroySceneNode(SceneNode node);
+bool IsSceneNodeAlive(SceneNode node);
+int GetSceneNodeCount(void);
+
+/// Move node and its descendants under parent, invalid parent makes it a root.
+/// Local transform is kept. Returns false if parent is node or one of its descendants.
+bool SetSceneNodeParent(SceneNode node, SceneNode parent);
+/// Returns invalid node for roots.
+SceneNode GetSceneNodeParent(SceneNode node);
+
+void SetSceneNodeLocal(SceneNode node, Matrix local);
+/// Same as SetSceneNodeLocal with scale, then rotation, then translation.
+void SetSceneNodeTransform(SceneNode node, Transform transform);
+Matrix GetSceneNodeLocal(SceneNode node);
+/// World transform as of the last UpdateScene.
+Matrix GetSceneNodeWorld(SceneNode node);
+
+/// Recompute world transforms of dirty nodes and their descendants.
+/// parallel splits large depths across job workers.
+void UpdateScene(bool parallel);
+SceneStats GetSceneStats(void);
+
+/// Box around node in its local space, nodes without one are never culled in.
+void SetSceneNodeBounds(SceneNode node, BoundingBox bounds);
+void ClearSceneNodeBounds(SceneNode node);
+/// Nodes with bounds at least partly inside frustum, as of the last UpdateScene.
+/// Writes up to max_nodes to out_nodes, returns number of nodes found which can be more.
+int CullScene(const Frustum *frustum, SceneNode *out_nodes, int max_nodes);
+
+#if defined(SUPPORT_MODULE_RMODELS)
+/// DrawModel with model.transform applied before node's world transform.
+void DrawSceneModel(SceneNode node, Model model, Color tint);
+/// DrawMesh with node's world transform.
+void DrawSceneMesh(SceneNode node, Mesh mesh, Material material);
+#endif /* SUPPORT_MODULE_RMODELS */
+
+#endif /* header guard */
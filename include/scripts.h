@@ -0,0 +1,184 @@
+#if !defined(SCRIPTS_H)
+#define SCRIPTS_H
+/**
+ * @file   include/scripts.h
+ * @brief  Gameplay sequences written as coroutines.
+ * @author Alicia D. Amarilla (smushyaa@gmail.com)
+ * @date   October 18, 2026
+ *
+ * A script is a function returning Script that waits with co_await:
+ *
+ *     Script Intro(Entity door) {
+ *         AssetHandle music = LoadMusicAsync("resources/intro.ogg");
+ *         co_await AssetReady(music);
+ *         co_await Seconds(2.0f);
+ *         while(!DoorOpened(door)) {
+ *             co_await NextFrame();
+ *         }
+ *     }
+ *
+ *     StartScript(Intro(door));
+ *
+ * RunScripts resumes every script whose wait is over in one pass
+ * over a packed array of wait states, a waiting script's frame
+ * isn't touched until it resumes.
+ *
+ * Coroutine frames come from pooled blocks of SCRIPT_FRAME_MIN
+ * up to SCRIPT_FRAME_MAX bytes, larger frames fall back to the heap.
+ * Once the pool has grown to the number of live scripts,
+ * starting and finishing scripts doesn't allocate.
+ *
+ * Scripts are created, started and run on the thread running systems
+ * (see pipeline.h), the pool isn't thread safe.
+*/
+#include "assets.h"
+#include <stdint.h>
+#include <stddef.h>
+#include <coroutine>
+#include <exception>
+
+/// Scripts running at once when InitScripts is given 0.
+#define SCRIPT_CAPACITY  (1 << 14)
+/// Smallest and largest pooled coroutine frame in bytes.
+#define SCRIPT_FRAME_MIN 128
+#define SCRIPT_FRAME_MAX 4096
+
+/// Handle to a running script, stale once the script returns or is stopped.
+/// Scripts with id 0 are invalid.
+typedef struct ScriptHandle {
+    uint32_t id;
+} ScriptHandle;
+
+enum ScriptWaitKind {
+    SCRIPT_WAIT_FRAME,
+    SCRIPT_WAIT_SECONDS,
+    SCRIPT_WAIT_ASSET,
+    SCRIPT_WAIT_SCRIPT,
+    SCRIPT_WAIT_DONE,
+};
+
+/// What a suspended script waits for.
+typedef struct ScriptWait {
+    enum ScriptWaitKind kind;
+    float    seconds;
+    uint32_t id;
+} ScriptWait;
+
+/// Last RunScripts.
+typedef struct ScriptStats {
+    int    running;
+    int    resumed;
+    /// Bytes reserved for pooled coroutine frames.
+    size_t pool;
+} ScriptStats;
+
+struct ScriptPromise;
+
+/// Coroutine returned by a script function, pass it to StartScript.
+/// Destroys the coroutine if it's never started.
+struct Script {
+    using promise_type = ScriptPromise;
+
+    std::coroutine_handle<ScriptPromise> handle;
+
+    Script() : handle() {}
+    explicit Script(std::coroutine_handle<ScriptPromise> handle) : handle(handle) {}
+    Script(Script &&other) : handle(other.handle) {
+        other.handle = nullptr;
+    }
+    Script &operator=(Script &&other) {
+        if(this != &other) {
+            if(handle) {
+                handle.destroy();
+            }
+            handle       = other.handle;
+            other.handle = nullptr;
+        }
+        return *this;
+    }
+    Script(const Script &) = delete;
+    Script &operator=(const Script &) = delete;
+    ~Script() {
+        if(handle) {
+            handle.destroy();
+        }
+    }
+};
+
+void *AllocScriptFrame(size_t size);
+void FreeScriptFrame(void *frame, size_t size);
+
+struct ScriptPromise {
+    // NOTE(alicia): slot of the script, set by StartScript
+    uint32_t slot;
+
+    static void *operator new(size_t size) noexcept {
+        return AllocScriptFrame(size);
+    }
+    static void operator delete(void *frame, size_t size) {
+        FreeScriptFrame(frame, size);
+    }
+    static Script get_return_object_on_allocation_failure() {
+        return Script();
+    }
+
+    Script get_return_object() {
+        return Script(std::coroutine_handle<ScriptPromise>::from_promise(*this));
+    }
+    std::suspend_always initial_suspend() noexcept {
+        return {};
+    }
+    std::suspend_always final_suspend() noexcept {
+        return {};
+    }
+    void return_void() {}
+    void unhandled_exception() {
+        std::terminate();
+    }
+};
+
+bool IsScriptWaitDone(const ScriptWait *wait);
+void SetScriptWait(uint32_t slot, const ScriptWait *wait);
+
+/// Returned by NextFrame, Seconds, AssetReady and ScriptDone.
+struct ScriptAwaiter {
+    ScriptWait wait;
+
+    bool await_ready() const noexcept {
+        return IsScriptWaitDone(&wait);
+    }
+    void await_suspend(std::coroutine_handle<ScriptPromise> handle) const noexcept {
+        SetScriptWait(handle.promise().slot, &wait);
+    }
+    void await_resume() const noexcept {}
+};
+
+/// Allocate storage for capacity scripts, 0 for SCRIPT_CAPACITY.
+void InitScripts(int capacity);
+/// Destroy every script and free the frame pool.
+/// Script objects that were never started must be gone by then.
+void ShutdownScripts(void);
+
+/// Run script until its first co_await and keep resuming it in RunScripts.
+/// Returns invalid handle if script failed to allocate or SCRIPT_CAPACITY are running.
+ScriptHandle StartScript(Script script);
+/// Script is not resumed again and its frame is destroyed by the next RunScripts.
+/// A script stopping itself keeps going until its next co_await.
+void StopScript(ScriptHandle script);
+bool IsScriptRunning(ScriptHandle script);
+int GetScriptCount(void);
+
+/// Resume scripts whose wait is over. Call once per frame.
+void RunScripts(float dt);
+ScriptStats GetScriptStats(void);
+
+/// Resume next RunScripts.
+ScriptAwaiter NextFrame(void);
+/// Resume once seconds of RunScripts dt have passed.
+ScriptAwaiter Seconds(float seconds);
+/// Resume once asset is done loading, ready or failed.
+ScriptAwaiter AssetReady(AssetHandle asset);
+/// Resume once script returns or is stopped.
+ScriptAwaiter ScriptDone(ScriptHandle script);
+
+#endif /* header guard */
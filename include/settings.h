@@ -0,0 +1,60 @@
+#if !defined(SETTINGS_H)
+#define SETTINGS_H
+/**
+ * @file   include/settings.h
+ * @brief  Runtime settings.
+ * @author Alicia D. Amarilla (smushyaa@gmail.com)
+ * @date   October 18, 2026
+ *
+ * Settings start at the compiled defaults below, then are read from
+ * settings.ini next to the executable (written by the build system from config.ini),
+ * then from the player's own settings.ini (see GetUserSettingsPath).
+ * Each file only needs the fields it changes.
+ *
+ * WASM builds have no settings.ini, the build system compiles
+ * config.ini's settings in as the defaults instead.
+*/
+#include <stddef.h>
+
+#if !defined(SETTINGS_WINDOW_WIDTH)
+    #define SETTINGS_WINDOW_WIDTH  800
+#endif
+#if !defined(SETTINGS_WINDOW_HEIGHT)
+    #define SETTINGS_WINDOW_HEIGHT 600
+#endif
+#if !defined(SETTINGS_FRAMERATE)
+    #define SETTINGS_FRAMERATE     60
+#endif
+#if !defined(SETTINGS_ASSET_BUDGET)
+    #define SETTINGS_ASSET_BUDGET  0
+#endif
+#if !defined(SETTINGS_TASK_BUDGET)
+    #define SETTINGS_TASK_BUDGET   2
+#endif
+
+typedef struct Settings {
+    // [window]
+    int window_width;
+    int window_height;
+    int framerate;
+
+    // [assets]
+    size_t asset_budget;
+
+    // [tasks]
+    /// Milliseconds per frame for tasks.h.
+    int task_budget;
+} Settings;
+
+/// Load settings. Call once, before InitWindow.
+void LoadSettings(void);
+/// Settings loaded by LoadSettings, compiled defaults before that.
+const Settings *GetSettings(void);
+
+/// Path of the player's settings.ini, NULL on platforms without one.
+/// Linux:   $XDG_CONFIG_HOME/<project>/settings.ini
+/// Windows: %APPDATA%\<project>\settings.ini
+/// macOS:   ~/Library/Application Support/<project>/settings.ini
+const char *GetUserSettingsPath(void);
+
+#endif /* header guard */
@@ -0,0 +1,89 @@
+#if !defined(SPATIAL_H)
+#define SPATIAL_H
+/**
+ * @file   include/spatial.h
+ * @brief  Spatial indices for culling and proximity queries.
+ * @author Alicia D. Amarilla (smushyaa@gmail.com)
+ * @date   October 18, 2026
+ *
+ * SpatialGrid is a hashed uniform grid for 2D rectangles,
+ * items are listed in every cell they overlap. Cell size should be
+ * around the size of a typical item.
+ *
+ * SpatialTree is a bounding volume hierarchy for 3D boxes.
+ * Leaves hold boxes grown by a margin, so items moving less than
+ * the margin don't touch the tree. Insertions keep it balanced.
+ * Tree queries test grown boxes, so they can report items up to margin away.
+ *
+ * Items are identified by the id returned when inserted.
+ * Queries write up to max_items ids to out_items and return the number
+ * of items found, which can be more than max_items.
+ *
+ * Culling a frame:
+ *     int count = QueryGridRect(grid, GetCameraView2D(camera, w, h), visible, max);
+ * then queue only visible items, SetRenderQueueView drops the rest of
+ * what's queued (see render_queue.h). Scene nodes with bounds are kept
+ * in a tree, CullScene gives the ones inside GetCameraFrustum (see scene.h).
+*/
+#include "raylib.h"
+
+typedef struct SpatialGrid SpatialGrid;
+typedef struct SpatialTree SpatialTree;
+
+/// Planes facing into a camera's view volume, see GetCameraFrustum.
+typedef struct Frustum {
+    /// x, y, z normal and w distance.
+    Vector4 planes[6];
+} Frustum;
+
+/// Called once for every pair of overlapping items.
+typedef void GridPairFN(int a, int b, void *user);
+
+/// Returns NULL if out of memory.
+SpatialGrid *CreateSpatialGrid(float cell_size);
+void DestroySpatialGrid(SpatialGrid *grid);
+
+/// Returns item id or -1 if out of memory.
+int InsertGridItem(SpatialGrid *grid, Rectangle bounds);
+void RemoveGridItem(SpatialGrid *grid, int id);
+/// Cell lists only change when item moves into different cells.
+void MoveGridItem(SpatialGrid *grid, int id, Rectangle bounds);
+Rectangle GetGridItemBounds(const SpatialGrid *grid, int id);
+int GetGridItemCount(const SpatialGrid *grid);
+
+int QueryGridRect(SpatialGrid *grid, Rectangle area, int *out_items, int max_items);
+int QueryGridCircle(SpatialGrid *grid, Vector2 center, float radius, int *out_items, int max_items);
+/// Items hit by the segment from origin along direction for distance.
+int QueryGridRay(
+    SpatialGrid *grid, Vector2 origin, Vector2 direction, float distance,
+    int *out_items, int max_items);
+/// Call fn for every pair of items whose bounds overlap.
+void QueryGridPairs(SpatialGrid *grid, GridPairFN *fn, void *user);
+
+/// Leaves are grown by margin on every side.
+/// Returns NULL if out of memory.
+SpatialTree *CreateSpatialTree(float margin);
+void DestroySpatialTree(SpatialTree *tree);
+
+/// Returns item id or -1 if out of memory.
+int InsertTreeItem(SpatialTree *tree, BoundingBox bounds);
+void RemoveTreeItem(SpatialTree *tree, int id);
+/// Returns true if item left its grown box and was reinserted.
+bool MoveTreeItem(SpatialTree *tree, int id, BoundingBox bounds);
+/// Grown box of item.
+BoundingBox GetTreeItemBounds(const SpatialTree *tree, int id);
+int GetTreeItemCount(const SpatialTree *tree);
+
+int QueryTreeBox(SpatialTree *tree, BoundingBox area, int *out_items, int max_items);
+int QueryTreeSphere(SpatialTree *tree, Vector3 center, float radius, int *out_items, int max_items);
+/// Items hit by ray within distance, distance is in lengths of ray.direction.
+int QueryTreeRay(SpatialTree *tree, Ray ray, float distance, int *out_items, int max_items);
+int QueryTreeFrustum(SpatialTree *tree, const Frustum *frustum, int *out_items, int max_items);
+
+/// World space rectangle visible through camera on a width by height screen.
+Rectangle GetCameraView2D(Camera2D camera, int width, int height);
+/// View volume of camera, aspect is screen width over height.
+/// Uses rlgl's near and far cull distances, same as BeginMode3D.
+Frustum GetCameraFrustum(Camera3D camera, float aspect);
+
+#endif /* header guard */
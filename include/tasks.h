@@ -0,0 +1,82 @@
+#if !defined(TASKS_H)
+#define TASKS_H
+/**
+ * @file   include/tasks.h
+ * @brief  Long running work spread across frames.
+ * @author Alicia D. Amarilla (smushyaa@gmail.com)
+ * @date   October 18, 2026
+ *
+ * A task is a function called once or more per frame until it reports
+ * it's done, each call should do about budget_ms of work and return.
+ * Pathfinding batches, planning, generation and save serialization
+ * fit here, work that would spike the frame if done all at once.
+ *
+ * RunTasks spends at most the task budget per frame, less when the frame
+ * is close to missing its target frame time, but never less than
+ * TASK_MIN_SLICE_MS (or the budget if smaller) so work doesn't stall
+ * while frames run long.
+ * Tasks past their deadline run first, then higher priority,
+ * then earliest deadline, then in the order they were started.
+ * A task keeps running while it has the best order and time is left.
+ *
+ * Tasks run on the thread calling RunTasks, start and cancel them
+ * from the same thread. A task may start others but must not cancel
+ * itself, it returns true instead.
+*/
+#include <stdint.h>
+
+/// Tasks waiting or running at once.
+#define TASK_CAPACITY 256
+/// Time left for drawing and presenting, RunTasks stops this close to the frame target.
+#define TASK_FRAME_RESERVE_MS 2.0
+/// Least RunTasks spends when tasks are pending, even on a frame past its target.
+#define TASK_MIN_SLICE_MS 0.5
+
+typedef enum TaskPriority {
+    TASK_PRIORITY_LOW,
+    TASK_PRIORITY_NORMAL,
+    TASK_PRIORITY_HIGH,
+
+    TASK_PRIORITY_COUNT
+} TaskPriority;
+
+/// Do up to budget_ms of work, return true when finished.
+/// Cancelled tasks are called one last time with budget_ms 0 to free their state.
+typedef bool TaskFN(void *user, double budget_ms);
+
+/// Handle to a task, stale once the task finishes or is cancelled.
+/// Tasks with id 0 are invalid.
+typedef struct Task {
+    uint32_t id;
+} Task;
+
+/// Last RunTasks.
+typedef struct TaskStats {
+    int    pending;
+    int    calls;
+    int    finished;
+    /// Tasks left running past their deadline.
+    int    late;
+    double ms;
+} TaskStats;
+
+/// budget_ms per frame, target_fps is the frame target RunTasks yields for, 0 when uncapped.
+void InitTasks(double budget_ms, int target_fps);
+/// Cancel every task.
+void ShutdownTasks(void);
+
+/// Start running fn in slices, deadline is seconds from now, 0 for none.
+/// name is not copied. Returns invalid task if TASK_CAPACITY are running.
+Task StartTask(const char *name, TaskFN *fn, void *user, TaskPriority priority, double deadline);
+/// Cancel task if it's still running.
+void CancelTask(Task task);
+bool IsTaskRunning(Task task);
+int GetTaskCount(void);
+
+/// Run tasks until the budget is spent, frame_start is GetTime() at the start of the frame.
+void RunTasks(double frame_start);
+TaskStats GetTaskStats(void);
+
+const char *GetTaskPriorityName(TaskPriority priority);
+
+#endif /* header guard */
@@ -0,0 +1,227 @@
+/**
+ * @file   src/asset_groups.cpp
+ * @brief  Lazily loaded asset groups for WASM builds.
+ * @author Alicia D. Amarilla (smushyaa@gmail.com)
+ * @date   October 18, 2026
+*/
+#include "raylib.h"
+#include "asset_groups.h"
+#include <string.h>
+
+#if PLATFORM == PLATFORM_WASM && defined(WASM_LAZY_ASSETS)
+
+#include <emscripten/emscripten.h>
+
+#define ASSET_GROUP_MAX      64
+#define ASSET_GROUP_NAME_MAX 64
+
+struct AssetGroup {
+    char name[ASSET_GROUP_NAME_MAX];
+    enum AssetGroupState state;
+    float progress;
+};
+
+static struct {
+    struct AssetGroup groups[ASSET_GROUP_MAX];
+    int count;
+
+    AssetGroupCallback *callback;
+    void *user;
+} ASSET_GROUPS;
+
+// NOTE(alicia): Module.assetGroups is written by cb.c into index.groups.js,
+// in the same order as WASM_ASSET_GROUPS.
+
+// packages are loaded by adding their script, file_packager does the rest
+EM_JS(void, JsAssetGroupLoad, (int index), {
+    var group  = Module['assetGroups'][index];
+    var url    = Module['locateFile'] ? Module['locateFile'](group.js, '') : group.js;
+    var script = document.createElement('script');
+    script.src     = url;
+    script.onerror = () => { group.failed = true; };
+    document.body.appendChild(script);
+});
+EM_JS(double, JsAssetGroupProgress, (int index), {
+    var group = Module['assetGroups'][index];
+    var url   = Module['locateFile'] ? Module['locateFile'](group.data, '') : group.data;
+    var download = Module['dataFileDownloads'] && Module['dataFileDownloads'][url];
+    if (!download) {
+        return 0;
+    }
+    var total = download.total || group.size;
+    return total ? Math.min(download.loaded / total, 1) : 0;
+});
+// 0: loading, 1: ready, 2: failed
+EM_JS(int, JsAssetGroupStatus, (int index), {
+    var group = Module['assetGroups'][index];
+    if (group.failed) {
+        return 2;
+    }
+    // NOTE(alicia): file_packager creates every file of a package at once
+    return FS.analyzePath(group.marker).exists ? 1 : 0;
+});
+
+static int FindAssetGroup(const char *group) {
+    for(int i = 0; i < ASSET_GROUPS.count; ++i) {
+        if(strcmp(ASSET_GROUPS.groups[i].name, group) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+static void NotifyAssetGroup(int index) {
+    struct AssetGroup *group = ASSET_GROUPS.groups + index;
+    if(ASSET_GROUPS.callback) {
+        ASSET_GROUPS.callback(group->name, group->state, group->progress, ASSET_GROUPS.user);
+    }
+}
+static void LoadAssetGroup(int index) {
+    struct AssetGroup *group = ASSET_GROUPS.groups + index;
+    if(group->state != ASSET_GROUP_UNLOADED) {
+        return;
+    }
+
+    TraceLog(LOG_INFO, "ASSETS: Fetching group %s", group->name);
+    group->state = ASSET_GROUP_LOADING;
+    JsAssetGroupLoad(index);
+    NotifyAssetGroup(index);
+}
+
+void InitAssetGroups(void) {
+    memset(&ASSET_GROUPS, 0, sizeof(ASSET_GROUPS));
+
+    const char *list = WASM_ASSET_GROUPS;
+    while(*list && ASSET_GROUPS.count < ASSET_GROUP_MAX) {
+        while(*list == ' ') {
+            list++;
+        }
+        size_t len = 0;
+        while(list[len] && list[len] != ' ') {
+            len++;
+        }
+        if(!len) {
+            break;
+        }
+
+        struct AssetGroup *group = ASSET_GROUPS.groups + ASSET_GROUPS.count++;
+        if(len >= ASSET_GROUP_NAME_MAX) {
+            TraceLog(LOG_WARNING, "ASSETS: Group name %.*s is too long", (int)len, list);
+            len = ASSET_GROUP_NAME_MAX - 1;
+        }
+        memcpy(group->name, list, len);
+        group->name[len] = 0;
+
+        list += len;
+    }
+
+    UpdateAssetGroups();
+}
+void UpdateAssetGroups(void) {
+    bool loading = false;
+    for(int i = 0; i < ASSET_GROUPS.count; ++i) {
+        struct AssetGroup *group = ASSET_GROUPS.groups + i;
+        if(group->state != ASSET_GROUP_LOADING) {
+            continue;
+        }
+
+        float progress = (float)JsAssetGroupProgress(i);
+        switch(JsAssetGroupStatus(i)) {
+            case 1:
+                TraceLog(LOG_INFO, "ASSETS: Group %s is ready", group->name);
+                group->state    = ASSET_GROUP_READY;
+                group->progress = 1.0f;
+                NotifyAssetGroup(i);
+                break;
+            case 2:
+                TraceLog(LOG_WARNING, "ASSETS: Failed to fetch group %s", group->name);
+                group->state = ASSET_GROUP_FAILED;
+                NotifyAssetGroup(i);
+                break;
+            default:
+                loading = true;
+                if(progress != group->progress) {
+                    group->progress = progress;
+                    NotifyAssetGroup(i);
+                }
+                break;
+        }
+    }
+
+    // NOTE(alicia): background fetches go one at a time so
+    // requested groups don't compete for bandwidth with all of them.
+    if(!loading) {
+        for(int i = 0; i < ASSET_GROUPS.count; ++i) {
+            if(ASSET_GROUPS.groups[i].state == ASSET_GROUP_UNLOADED) {
+                LoadAssetGroup(i);
+                break;
+            }
+        }
+    }
+}
+bool RequestAssetGroup(const char *group) {
+    int index = FindAssetGroup(group);
+    if(index < 0) {
+        TraceLog(LOG_WARNING, "ASSETS: No group named %s", group);
+        return false;
+    }
+
+    LoadAssetGroup(index);
+    return true;
+}
+enum AssetGroupState GetAssetGroupState(const char *group) {
+    int index = FindAssetGroup(group);
+    // NOTE(alicia): groups that aren't lazily loaded are in the boot package
+    return index < 0 ? ASSET_GROUP_READY : ASSET_GROUPS.groups[index].state;
+}
+float GetAssetGroupProgress(const char *group) {
+    int index = FindAssetGroup(group);
+    return index < 0 ? 1.0f : ASSET_GROUPS.groups[index].progress;
+}
+int GetAssetGroupCount(void) {
+    return ASSET_GROUPS.count;
+}
+const char *GetAssetGroupName(int index) {
+    if(index < 0 || index >= ASSET_GROUPS.count) {
+        return NULL;
+    }
+    return ASSET_GROUPS.groups[index].name;
+}
+void SetAssetGroupCallback(AssetGroupCallback *callback, void *user) {
+    ASSET_GROUPS.callback = callback;
+    ASSET_GROUPS.user     = user;
+}
+
+#else /* PLATFORM == PLATFORM_WASM && WASM_LAZY_ASSETS */
+
+// NOTE(alicia): everything is on disk or in the boot package
+
+void InitAssetGroups(void) {}
+void UpdateAssetGroups(void) {}
+bool RequestAssetGroup(const char *group) {
+    (void)group;
+    return true;
+}
+enum AssetGroupState GetAssetGroupState(const char *group) {
+    (void)group;
+    return ASSET_GROUP_READY;
+}
+float GetAssetGroupProgress(const char *group) {
+    (void)group;
+    return 1.0f;
+}
+int GetAssetGroupCount(void) {
+    return 0;
+}
+const char *GetAssetGroupName(int index) {
+    (void)index;
+    return NULL;
+}
+void SetAssetGroupCallback(AssetGroupCallback *callback, void *user) {
+    (void)callback, (void)user;
+}
+
+#endif /* PLATFORM == PLATFORM_WASM && WASM_LAZY_ASSETS */
+
+bool IsAssetGroupReady(const char *group) {
+    return GetAssetGroupState(group) == ASSET_GROUP_READY;
+}
@@ -0,0 +1,882 @@
+/**
+ * @file   src/assets.cpp
+ * @brief  Asynchronous asset loading.
+ * @author Alicia D. Amarilla (smushyaa@gmail.com)
+ * @date   October 18, 2026
+*/
+#include "raylib.h"
+#include "rlgl.h"
+#include "assets.h"
+#include "jobs.h"
+
+#include <string.h>
+#include <atomic>
+#include <mutex>
+#include <thread>
+
+#define ASSET_PATH_MAX   256
+#define ASSET_INDEX_BITS 16
+#define ASSET_INDEX_MASK ((1u << ASSET_INDEX_BITS) - 1)
+
+// NOTE(alicia): raylib doesn't expose a stream's buffer size,
+// this is its default of two buffers of 4096 frames.
+#define ASSET_MUSIC_STREAM_FRAMES (4096 * 2)
+
+static_assert(ASSET_CAPACITY < ASSET_INDEX_MASK, "asset capacity does not fit in handle!");
+
+// GPU/audio side of an asset, only touched on main thread
+struct AssetObject {
+    Texture2D texture;
+    Sound     sound;
+    Font      font;
+    Shader    shader;
+    Music     music;
+    Model     model;
+};
+
+struct Asset {
+    enum AssetType type;
+    // enum AssetState, written by workers while loading
+    std::atomic<int> state;
+    // NOTE(alicia): set by workers, checked on main thread when uploading
+    bool decode_failed;
+    long mod_time;
+
+    // NOTE(alicia): main thread only.
+    // a reloading asset stays READY (or FAILED) with its old object.
+    bool reloading;
+    bool reload_again;
+
+    uint16_t generation;
+    int      refs;
+    bool     pinned;
+    uint64_t last_used;
+    AssetMemory memory;
+    char     path[ASSET_PATH_MAX];
+    char     vs_path[ASSET_PATH_MAX];
+
+    // decoded on worker
+    Image image;
+    Wave  wave;
+    unsigned char *file_data;
+    int            file_size;
+    char *vs_text;
+    char *fs_text;
+
+    // uploaded on main thread
+    struct AssetObject object;
+};
+
+static struct {
+    struct Asset slots[ASSET_CAPACITY];
+    uint16_t free[ASSET_CAPACITY];
+    int      free_count;
+
+    // NOTE(alicia): every job ends up here, even failed ones,
+    // so only the main thread ever releases a slot.
+    std::mutex upload_lock;
+    uint16_t   upload[ASSET_CAPACITY];
+    int        upload_head;
+    int        upload_count;
+
+    std::atomic<int> jobs;
+    double budget_ms;
+
+    uint64_t    frame;
+    size_t      budget;
+    AssetMemory resident[ASSET_TYPE_COUNT];
+    bool        over_budget;
+} ASSETS;
+
+static struct Asset *AssetFromHandle(AssetHandle handle) {
+    uint32_t index = (handle.id & ASSET_INDEX_MASK);
+    if(!index || index > ASSET_CAPACITY) {
+        return NULL;
+    }
+
+    struct Asset *asset = ASSETS.slots + (index - 1);
+    if(asset->generation != (handle.id >> ASSET_INDEX_BITS) || !asset->refs) {
+        return NULL;
+    }
+    return asset;
+}
+static AssetHandle HandleFromAsset(struct Asset *asset) {
+    AssetHandle handle;
+    handle.id = ((uint32_t)asset->generation << ASSET_INDEX_BITS) |
+        (uint32_t)((asset - ASSETS.slots) + 1);
+    return handle;
+}
+
+// compare paths, ignoring leading ./
+static bool PathMatch(const char *a, const char *b) {
+    while(a[0] == '.' && (a[1] == '/' || a[1] == '\\')) {
+        a += 2;
+    }
+    while(b[0] == '.' && (b[1] == '/' || b[1] == '\\')) {
+        b += 2;
+    }
+    return *a && strcmp(a, b) == 0;
+}
+
+static void PushUpload(struct Asset *asset) {
+    std::lock_guard<std::mutex> guard(ASSETS.upload_lock);
+    int tail = (ASSETS.upload_head + ASSETS.upload_count) % ASSET_CAPACITY;
+    ASSETS.upload[tail] = (uint16_t)(asset - ASSETS.slots);
+    ASSETS.upload_count++;
+}
+static struct Asset *PopUpload(void) {
+    std::lock_guard<std::mutex> guard(ASSETS.upload_lock);
+    if(!ASSETS.upload_count) {
+        return NULL;
+    }
+    struct Asset *asset = ASSETS.slots + ASSETS.upload[ASSETS.upload_head];
+    ASSETS.upload_head  = (ASSETS.upload_head + 1) % ASSET_CAPACITY;
+    ASSETS.upload_count--;
+    return asset;
+}
+
+// runs on a worker, reads and decodes asset files
+static void DecodeAssetJob(void *params) {
+    struct Asset *asset = (struct Asset *)params;
+
+    asset->decode_failed = true;
+    asset->mod_time      = 0;
+
+    if(asset->type == ASSET_TYPE_MUSIC || asset->type == ASSET_TYPE_MODEL) {
+        // NOTE(alicia): raylib reads these itself on upload
+        asset->decode_failed = !FileExists(asset->path);
+        asset->mod_time      = GetFileModTime(asset->path);
+    } else if(asset->type == ASSET_TYPE_SHADER) {
+        // NOTE(alicia): shaders are compiled on upload, only read sources here
+        bool failed = false;
+        if(asset->vs_path[0]) {
+            asset->vs_text = LoadFileText(asset->vs_path);
+            failed |= asset->vs_text == NULL;
+            asset->mod_time = GetFileModTime(asset->vs_path);
+        }
+        if(asset->path[0]) {
+            asset->fs_text = LoadFileText(asset->path);
+            failed |= asset->fs_text == NULL;
+            long mod_time = GetFileModTime(asset->path);
+            if(mod_time > asset->mod_time) {
+                asset->mod_time = mod_time;
+            }
+        }
+        asset->decode_failed = failed;
+    } else {
+        int size = 0;
+        unsigned char *data = LoadFileData(asset->path, &size);
+        const char *ext = GetFileExtension(asset->path);
+        asset->mod_time = GetFileModTime(asset->path);
+
+        if(data && ext) {
+            switch(asset->type) {
+                case ASSET_TYPE_TEXTURE:
+                    asset->image = LoadImageFromMemory(ext, data, size);
+                    asset->decode_failed = asset->image.data == NULL;
+                    break;
+                case ASSET_TYPE_SOUND:
+#if defined(SUPPORT_MODULE_RAUDIO)
+                    asset->wave = LoadWaveFromMemory(ext, data, size);
+                    asset->decode_failed = asset->wave.data == NULL;
+#endif
+                    break;
+                case ASSET_TYPE_FONT:
+                    // NOTE(alicia): font atlas is generated on upload,
+                    // LoadFontFromMemory keeps glyphs and atlas together.
+                    asset->file_data     = data;
+                    asset->file_size     = size;
+                    asset->decode_failed = false;
+                    data = NULL;
+                    break;
+                case ASSET_TYPE_SHADER:
+                case ASSET_TYPE_MUSIC:
+                case ASSET_TYPE_MODEL:
+                case ASSET_TYPE_COUNT:
+                    break;
+            }
+        }
+        UnloadFileData(data);
+    }
+
+    if(!asset->reloading) {
+        asset->state.store(ASSET_STATE_DECODED);
+    }
+    PushUpload(asset);
+    ASSETS.jobs.fetch_sub(1);
+}
+static void SubmitDecode(struct Asset *asset) {
+    ASSETS.jobs.fetch_add(1);
+    if(!SubmitJob(DecodeAssetJob, asset)) {
+        // NOTE(alicia): queue is full, decode now rather than fail
+        DecodeAssetJob(asset);
+    }
+}
+
+static void FreeDecoded(struct Asset *asset) {
+    if(asset->image.data) {
+        UnloadImage(asset->image);
+    }
+#if defined(SUPPORT_MODULE_RAUDIO)
+    if(asset->wave.data) {
+        UnloadWave(asset->wave);
+    }
+#endif
+    if(asset->file_data) {
+        UnloadFileData(asset->file_data);
+    }
+    if(asset->vs_text) {
+        UnloadFileText(asset->vs_text);
+    }
+    if(asset->fs_text) {
+        UnloadFileText(asset->fs_text);
+    }
+    memset(&asset->image, 0, sizeof(asset->image));
+    memset(&asset->wave, 0, sizeof(asset->wave));
+    asset->file_data = NULL;
+    asset->file_size = 0;
+    asset->vs_text   = NULL;
+    asset->fs_text   = NULL;
+}
+static void FreeObject(enum AssetType type, struct AssetObject *object) {
+    switch(type) {
+        case ASSET_TYPE_TEXTURE:
+            if(object->texture.id) {
+                UnloadTexture(object->texture);
+            }
+            break;
+        case ASSET_TYPE_SOUND:
+#if defined(SUPPORT_MODULE_RAUDIO)
+            if(object->sound.stream.buffer) {
+                UnloadSound(object->sound);
+            }
+#endif
+            break;
+        // NOTE(alicia): raylib won't unload its default font and shader
+        case ASSET_TYPE_FONT:
+            if(object->font.texture.id) {
+                UnloadFont(object->font);
+            }
+            break;
+        case ASSET_TYPE_SHADER:
+            if(object->shader.id) {
+                UnloadShader(object->shader);
+            }
+            break;
+        case ASSET_TYPE_MUSIC:
+#if defined(SUPPORT_MODULE_RAUDIO)
+            if(object->music.stream.buffer) {
+                UnloadMusicStream(object->music);
+            }
+#endif
+            break;
+        case ASSET_TYPE_MODEL:
+#if defined(SUPPORT_MODULE_RMODELS)
+            if(object->model.meshes) {
+                UnloadModel(object->model);
+            }
+#endif
+            break;
+        case ASSET_TYPE_COUNT:
+            break;
+    }
+    memset(object, 0, sizeof(*object));
+}
+
+static size_t TextureBytes(Texture2D texture) {
+    size_t bytes = 0;
+    int width  = texture.width;
+    int height = texture.height;
+    for(int i = 0; i < (texture.mipmaps > 1 ? texture.mipmaps : 1); ++i) {
+        bytes += GetPixelDataSize(width, height, texture.format);
+        width  = width  > 1 ? width  / 2 : 1;
+        height = height > 1 ? height / 2 : 1;
+    }
+    return bytes;
+}
+#if defined(SUPPORT_MODULE_RMODELS)
+static size_t MeshBytes(const Mesh *mesh, bool gpu) {
+    size_t vertices = mesh->vertexCount;
+    size_t bytes    = 0;
+    bytes += mesh->vertices   ? vertices * 3 * sizeof(float) : 0;
+    bytes += mesh->texcoords  ? vertices * 2 * sizeof(float) : 0;
+    bytes += mesh->texcoords2 ? vertices * 2 * sizeof(float) : 0;
+    bytes += mesh->normals    ? vertices * 3 * sizeof(float) : 0;
+    bytes += mesh->tangents   ? vertices * 4 * sizeof(float) : 0;
+    bytes += mesh->colors     ? vertices * 4 : 0;
+    bytes += mesh->indices    ? (size_t)mesh->triangleCount * 3 * sizeof(unsigned short) : 0;
+    // NOTE(alicia): skinning fields were reworked in raylib 6,
+    // only counted for versions with the layout below.
+#if RAYLIB_VERSION_MAJOR < 6
+    if(!gpu) {
+        // NOTE(alicia): animation data is skinned on cpu
+        bytes += mesh->animVertices ? vertices * 3 * sizeof(float) : 0;
+        bytes += mesh->animNormals  ? vertices * 3 * sizeof(float) : 0;
+        bytes += mesh->boneIds      ? vertices * 4 : 0;
+        bytes += mesh->boneWeights  ? vertices * 4 * sizeof(float) : 0;
+    }
+#else
+    (void)gpu;
+#endif
+    return bytes;
+}
+#endif /* SUPPORT_MODULE_RMODELS */
+// approximate memory held by object
+static AssetMemory ObjectMemory(enum AssetType type, const struct AssetObject *object) {
+    AssetMemory memory = {};
+    switch(type) {
+        case ASSET_TYPE_TEXTURE:
+            memory.gpu = TextureBytes(object->texture);
+            break;
+        case ASSET_TYPE_SOUND: {
+            const Sound *sound = &object->sound;
+            memory.cpu = (size_t)sound->frameCount *
+                sound->stream.channels * (sound->stream.sampleSize / 8);
+        } break;
+        case ASSET_TYPE_FONT: {
+            const Font *font = &object->font;
+            memory.gpu = TextureBytes(font->texture);
+            memory.cpu = (size_t)font->glyphCount * (sizeof(GlyphInfo) + sizeof(Rectangle));
+            for(int i = 0; i < font->glyphCount; ++i) {
+                const Image *image = &font->glyphs[i].image;
+                memory.cpu += GetPixelDataSize(image->width, image->height, image->format);
+            }
+        } break;
+        case ASSET_TYPE_MUSIC: {
+            const Music *music = &object->music;
+            memory.cpu = (size_t)ASSET_MUSIC_STREAM_FRAMES *
+                music->stream.channels * (music->stream.sampleSize / 8);
+        } break;
+        case ASSET_TYPE_MODEL: {
+#if defined(SUPPORT_MODULE_RMODELS)
+            const Model *model = &object->model;
+            // NOTE(alicia): raylib keeps a cpu copy of every uploaded mesh
+            for(int i = 0; i < model->meshCount; ++i) {
+                memory.cpu += MeshBytes(model->meshes + i, false);
+                memory.gpu += MeshBytes(model->meshes + i, true);
+            }
+#if RAYLIB_VERSION_MAJOR < 6
+            memory.cpu += (size_t)model->boneCount * (sizeof(BoneInfo) + sizeof(Transform));
+#endif
+
+            // NOTE(alicia): count each texture once, skip raylib's default texture
+            unsigned int seen[64];
+            int seen_count = 0;
+            for(int i = 0; i < model->materialCount; ++i) {
+                if(!model->materials[i].maps) {
+                    continue;
+                }
+                for(int m = 0; m <= MATERIAL_MAP_BRDF; ++m) {
+                    Texture2D texture = model->materials[i].maps[m].texture;
+                    if(!texture.id || texture.id == rlGetTextureIdDefault()) {
+                        continue;
+                    }
+                    bool counted = false;
+                    for(int s = 0; s < seen_count; ++s) {
+                        counted |= seen[s] == texture.id;
+                    }
+                    if(counted) {
+                        continue;
+                    }
+                    if(seen_count < (int)(sizeof(seen) / sizeof(seen[0]))) {
+                        seen[seen_count++] = texture.id;
+                    }
+                    memory.gpu += TextureBytes(texture);
+                }
+            }
+#endif /* SUPPORT_MODULE_RMODELS */
+        } break;
+        case ASSET_TYPE_SHADER:
+        case ASSET_TYPE_COUNT:
+            break;
+    }
+    return memory;
+}
+// replace memory counted for asset
+static void TrackMemory(struct Asset *asset, AssetMemory memory) {
+    AssetMemory *resident = ASSETS.resident + asset->type;
+    resident->cpu -= asset->memory.cpu;
+    resident->gpu -= asset->memory.gpu;
+    resident->cpu += memory.cpu;
+    resident->gpu += memory.gpu;
+    asset->memory = memory;
+}
+static void ReleaseSlot(struct Asset *asset) {
+    FreeDecoded(asset);
+    FreeObject(asset->type, &asset->object);
+    TrackMemory(asset, AssetMemory{});
+    asset->state.store(ASSET_STATE_NONE);
+    asset->reloading    = false;
+    asset->reload_again = false;
+    asset->pinned       = false;
+    asset->path[0]      = 0;
+    asset->vs_path[0]   = 0;
+    asset->generation++;
+    ASSETS.free[ASSETS.free_count++] = (uint16_t)(asset - ASSETS.slots);
+}
+
+// create GPU/audio object from decoded data, main thread only
+static bool UploadObject(struct Asset *asset, struct AssetObject *out_object) {
+    memset(out_object, 0, sizeof(*out_object));
+    switch(asset->type) {
+        case ASSET_TYPE_TEXTURE:
+            out_object->texture = LoadTextureFromImage(asset->image);
+            return out_object->texture.id != 0;
+        case ASSET_TYPE_SOUND:
+#if defined(SUPPORT_MODULE_RAUDIO)
+            out_object->sound = LoadSoundFromWave(asset->wave);
+            return out_object->sound.stream.buffer != NULL;
+#else
+            break;
+#endif
+        case ASSET_TYPE_FONT:
+            out_object->font = LoadFontFromMemory(GetFileExtension(asset->path),
+                asset->file_data, asset->file_size, ASSET_FONT_SIZE, NULL, 0);
+            return out_object->font.glyphs != NULL && out_object->font.texture.id != 0;
+        case ASSET_TYPE_SHADER:
+            out_object->shader = LoadShaderFromMemory(asset->vs_text, asset->fs_text);
+            // NOTE(alicia): raylib falls back to its default shader on failure
+            return out_object->shader.id != 0 &&
+                out_object->shader.id != rlGetShaderIdDefault();
+        case ASSET_TYPE_MUSIC:
+#if defined(SUPPORT_MODULE_RAUDIO)
+            out_object->music = LoadMusicStream(asset->path);
+            return out_object->music.stream.buffer != NULL;
+#else
+            break;
+#endif
+        case ASSET_TYPE_MODEL:
+#if defined(SUPPORT_MODULE_RMODELS)
+            out_object->model = LoadModel(asset->path);
+            return out_object->model.meshes != NULL && out_object->model.meshCount > 0;
+#else
+            break;
+#endif
+        case ASSET_TYPE_COUNT:
+            break;
+    }
+    return false;
+}
+
+// upload decoded asset, main thread only
+static void UploadAsset(struct Asset *asset) {
+    if(!asset->refs) {
+        // NOTE(alicia): unloaded while decoding
+        ReleaseSlot(asset);
+        return;
+    }
+
+    bool reload = asset->reloading;
+    asset->reloading = false;
+
+    struct AssetObject object;
+    bool success = !asset->decode_failed && UploadObject(asset, &object);
+    FreeDecoded(asset);
+
+    if(success) {
+        FreeObject(asset->type, &asset->object);
+        asset->object = object;
+        TrackMemory(asset, ObjectMemory(asset->type, &object));
+        asset->state.store(ASSET_STATE_READY);
+        if(reload) {
+            TraceLog(LOG_INFO, "ASSETS: Reloaded %s", asset->path[0] ? asset->path : asset->vs_path);
+        }
+    } else {
+        FreeObject(asset->type, &object);
+        TraceLog(LOG_WARNING, "ASSETS: Failed to load %s", asset->path[0] ? asset->path : asset->vs_path);
+        // NOTE(alicia): failed reloads keep the last good object
+        if(!reload || asset->state.load() != ASSET_STATE_READY) {
+            asset->state.store(ASSET_STATE_FAILED);
+        }
+    }
+
+    if(asset->reload_again) {
+        asset->reload_again = false;
+        asset->reloading    = true;
+        SubmitDecode(asset);
+    }
+}
+
+static AssetHandle LoadAssetAsync(enum AssetType type, const char *path, const char *vs_path) {
+    AssetHandle result = {};
+
+    if(!path) {
+        path = "";
+    }
+    if(!vs_path) {
+        vs_path = "";
+    }
+    if(strlen(path) >= ASSET_PATH_MAX || strlen(vs_path) >= ASSET_PATH_MAX) {
+        TraceLog(LOG_WARNING, "ASSETS: Path is too long: %s", path[0] ? path : vs_path);
+        return result;
+    }
+
+    // already loaded?
+    for(int i = 0; i < ASSET_CAPACITY; ++i) {
+        struct Asset *asset = ASSETS.slots + i;
+        if(asset->refs && asset->type == type &&
+            strcmp(asset->path, path) == 0 && strcmp(asset->vs_path, vs_path) == 0
+        ) {
+            asset->refs++;
+            return HandleFromAsset(asset);
+        }
+    }
+
+    if(!ASSETS.free_count) {
+        TraceLog(LOG_WARNING, "ASSETS: Out of asset slots, can't load %s", path[0] ? path : vs_path);
+        return result;
+    }
+
+    struct Asset *asset = ASSETS.slots + ASSETS.free[--ASSETS.free_count];
+    asset->type          = type;
+    asset->refs          = 1;
+    asset->last_used     = ASSETS.frame;
+    asset->decode_failed = false;
+    strcpy(asset->path, path);
+    strcpy(asset->vs_path, vs_path);
+    asset->state.store(ASSET_STATE_LOADING);
+
+    SubmitDecode(asset);
+
+    return HandleFromAsset(asset);
+}
+
+void InitAssets(void) {
+    ASSETS.free_count = 0;
+    for(int i = ASSET_CAPACITY; i-- > 0;) {
+        struct Asset *asset = ASSETS.slots + i;
+        asset->state.store(ASSET_STATE_NONE);
+        asset->refs = 0;
+        ASSETS.free[ASSETS.free_count++] = (uint16_t)i;
+    }
+
+    ASSETS.upload_head  = 0;
+    ASSETS.upload_count = 0;
+    ASSETS.jobs.store(0);
+    ASSETS.budget_ms = ASSET_UPLOAD_BUDGET_MS;
+
+    ASSETS.frame       = 0;
+    ASSETS.budget      = 0;
+    ASSETS.over_budget = false;
+    memset(ASSETS.resident, 0, sizeof(ASSETS.resident));
+}
+
+static size_t ResidentBytes(void) {
+    AssetMemory total = GetAssetMemoryTotal();
+    return total.cpu + total.gpu;
+}
+static bool IsAssetEvictable(struct Asset *asset) {
+    if(!asset->refs || asset->pinned || asset->reloading ||
+        asset->state.load() != ASSET_STATE_READY ||
+        // NOTE(alicia): anything used last frame is likely to be used this frame
+        asset->last_used + 1 >= ASSETS.frame
+    ) {
+        return false;
+    }
+    // stopping audio mid-playback would be noticeable
+    switch(asset->type) {
+#if defined(SUPPORT_MODULE_RAUDIO)
+        case ASSET_TYPE_SOUND:
+            return !IsSoundPlaying(asset->object.sound);
+        case ASSET_TYPE_MUSIC:
+            return !IsMusicStreamPlaying(asset->object.music);
+#endif
+        default:
+            return true;
+    }
+}
+// evict least recently used assets until resident memory is within budget
+static void EvictAssets(void) {
+    if(!ASSETS.budget) {
+        return;
+    }
+
+    size_t resident = ResidentBytes();
+    while(resident > ASSETS.budget) {
+        struct Asset *lru = NULL;
+        for(int i = 0; i < ASSET_CAPACITY; ++i) {
+            struct Asset *asset = ASSETS.slots + i;
+            if(IsAssetEvictable(asset) && (!lru || asset->last_used < lru->last_used)) {
+                lru = asset;
+            }
+        }
+
+        if(!lru) {
+            if(!ASSETS.over_budget) {
+                TraceLog(LOG_WARNING, "ASSETS: %zu bytes in use, over budget of %zu bytes",
+                    resident, ASSETS.budget);
+            }
+            ASSETS.over_budget = true;
+            return;
+        }
+
+        TraceLog(LOG_DEBUG, "ASSETS: Evicting %s", lru->path[0] ? lru->path : lru->vs_path);
+        FreeObject(lru->type, &lru->object);
+        TrackMemory(lru, AssetMemory{});
+        lru->state.store(ASSET_STATE_EVICTED);
+
+        resident = ResidentBytes();
+    }
+    ASSETS.over_budget = false;
+}
+void UpdateAssets(void) {
+    double start = GetTime();
+    ASSETS.frame++;
+
+    // NOTE(alicia): without workers, decoding shares the budget with uploads
+    if(!GetJobWorkerCount()) {
+        RunPendingJobs(ASSETS.budget_ms * 0.5);
+    }
+
+    struct Asset *asset;
+    while((asset = PopUpload())) {
+        UploadAsset(asset);
+        if((GetTime() - start) * 1000.0 >= ASSETS.budget_ms) {
+            break;
+        }
+    }
+
+    EvictAssets();
+}
+void ShutdownAssets(void) {
+    while(ASSETS.jobs.load()) {
+        if(GetJobWorkerCount()) {
+            std::this_thread::yield();
+        } else {
+            RunPendingJobs(1000.0);
+        }
+    }
+    while(PopUpload()) {}
+
+    for(int i = 0; i < ASSET_CAPACITY; ++i) {
+        struct Asset *asset = ASSETS.slots + i;
+        if(asset->state.load() != ASSET_STATE_NONE) {
+            asset->refs = 0;
+            ReleaseSlot(asset);
+        }
+    }
+}
+void SetAssetUploadBudget(double budget_ms) {
+    ASSETS.budget_ms = budget_ms;
+}
+void SetAssetBudget(size_t bytes) {
+    ASSETS.budget      = bytes;
+    ASSETS.over_budget = false;
+}
+size_t GetAssetBudget(void) {
+    return ASSETS.budget;
+}
+
+AssetHandle LoadTextureAsync(const char *path) {
+    return LoadAssetAsync(ASSET_TYPE_TEXTURE, path, NULL);
+}
+AssetHandle LoadSoundAsync(const char *path) {
+#if !defined(SUPPORT_MODULE_RAUDIO)
+    TraceLog(LOG_WARNING, "ASSETS: raudio is disabled, %s won't load", path);
+#endif
+    return LoadAssetAsync(ASSET_TYPE_SOUND, path, NULL);
+}
+AssetHandle LoadFontAsync(const char *path) {
+    return LoadAssetAsync(ASSET_TYPE_FONT, path, NULL);
+}
+AssetHandle LoadShaderAsync(const char *vs_path, const char *fs_path) {
+    return LoadAssetAsync(ASSET_TYPE_SHADER, fs_path, vs_path);
+}
+AssetHandle LoadMusicAsync(const char *path) {
+#if !defined(SUPPORT_MODULE_RAUDIO)
+    TraceLog(LOG_WARNING, "ASSETS: raudio is disabled, %s won't load", path);
+#endif
+    return LoadAssetAsync(ASSET_TYPE_MUSIC, path, NULL);
+}
+AssetHandle LoadModelAsync(const char *path) {
+#if !defined(SUPPORT_MODULE_RMODELS)
+    TraceLog(LOG_WARNING, "ASSETS: rmodels is disabled, %s won't load", path);
+#endif
+    return LoadAssetAsync(ASSET_TYPE_MODEL, path, NULL);
+}
+void UnloadAsset(AssetHandle handle) {
+    struct Asset *asset = AssetFromHandle(handle);
+    if(!asset || --asset->refs) {
+        return;
+    }
+
+    // NOTE(alicia): workers still own assets that are loading,
+    // those are released when they reach the upload queue.
+    int state = asset->state.load();
+    if(!asset->reloading && state != ASSET_STATE_LOADING && state != ASSET_STATE_DECODED) {
+        ReleaseSlot(asset);
+    }
+}
+void SetAssetPinned(AssetHandle handle, bool pinned) {
+    struct Asset *asset = AssetFromHandle(handle);
+    if(asset) {
+        asset->pinned = pinned;
+    }
+}
+
+enum AssetState GetAssetState(AssetHandle handle) {
+    struct Asset *asset = AssetFromHandle(handle);
+    return asset ? (enum AssetState)asset->state.load() : ASSET_STATE_NONE;
+}
+bool IsAssetReady(AssetHandle handle) {
+    return GetAssetState(handle) == ASSET_STATE_READY;
+}
+enum AssetType GetAssetType(AssetHandle handle) {
+    struct Asset *asset = AssetFromHandle(handle);
+    return asset ? asset->type : ASSET_TYPE_COUNT;
+}
+const char *GetAssetPath(AssetHandle handle) {
+    struct Asset *asset = AssetFromHandle(handle);
+    return asset ? asset->path : NULL;
+}
+
+// mark asset as used, returns asset if it's ready
+static struct Asset *UseAsset(AssetHandle handle, enum AssetType type) {
+    struct Asset *asset = AssetFromHandle(handle);
+    if(!asset || asset->type != type) {
+        return NULL;
+    }
+
+    asset->last_used = ASSETS.frame;
+    switch(asset->state.load()) {
+        case ASSET_STATE_READY:
+            return asset;
+        case ASSET_STATE_EVICTED:
+            asset->state.store(ASSET_STATE_LOADING);
+            SubmitDecode(asset);
+            return NULL;
+        default:
+            return NULL;
+    }
+}
+Texture2D GetTexture(AssetHandle handle) {
+    struct Asset *asset = UseAsset(handle, ASSET_TYPE_TEXTURE);
+    if(!asset) {
+        Texture2D empty = {};
+        return empty;
+    }
+    return asset->object.texture;
+}
+Sound GetSound(AssetHandle handle) {
+    struct Asset *asset = UseAsset(handle, ASSET_TYPE_SOUND);
+    if(!asset) {
+        Sound empty = {};
+        return empty;
+    }
+    return asset->object.sound;
+}
+Font GetFont(AssetHandle handle) {
+    struct Asset *asset = UseAsset(handle, ASSET_TYPE_FONT);
+    return asset ? asset->object.font : GetFontDefault();
+}
+Shader GetShader(AssetHandle handle) {
+    struct Asset *asset = UseAsset(handle, ASSET_TYPE_SHADER);
+    if(!asset) {
+        Shader shader = {};
+        shader.id   = rlGetShaderIdDefault();
+        shader.locs = rlGetShaderLocsDefault();
+        return shader;
+    }
+    return asset->object.shader;
+}
+Music GetMusic(AssetHandle handle) {
+    struct Asset *asset = UseAsset(handle, ASSET_TYPE_MUSIC);
+    if(!asset) {
+        Music empty = {};
+        return empty;
+    }
+    return asset->object.music;
+}
+Model GetModel(AssetHandle handle) {
+    struct Asset *asset = UseAsset(handle, ASSET_TYPE_MODEL);
+    if(!asset) {
+        Model empty = {};
+        return empty;
+    }
+    return asset->object.model;
+}
+
+AssetMemory GetAssetMemory(enum AssetType type) {
+    if(type >= ASSET_TYPE_COUNT) {
+        AssetMemory empty = {};
+        return empty;
+    }
+    return ASSETS.resident[type];
+}
+AssetMemory GetAssetMemoryTotal(void) {
+    AssetMemory total = {};
+    for(int i = 0; i < ASSET_TYPE_COUNT; ++i) {
+        total.cpu += ASSETS.resident[i].cpu;
+        total.gpu += ASSETS.resident[i].gpu;
+    }
+    return total;
+}
+AssetMemory GetAssetMemoryOf(AssetHandle handle) {
+    struct Asset *asset = AssetFromHandle(handle);
+    if(!asset) {
+        AssetMemory empty = {};
+        return empty;
+    }
+    return asset->memory;
+}
+
+int GetAssetsLoadingCount(void) {
+    int count = ASSETS.jobs.load();
+    std::lock_guard<std::mutex> guard(ASSETS.upload_lock);
+    return count + ASSETS.upload_count;
+}
+
+static void ReloadAsset(struct Asset *asset) {
+    int state = asset->state.load();
+    if(state == ASSET_STATE_EVICTED) {
+        // NOTE(alicia): nothing to replace, loads from the new file when used
+        return;
+    }
+    if(asset->reloading || state == ASSET_STATE_LOADING || state == ASSET_STATE_DECODED) {
+        // NOTE(alicia): file changed mid-decode, decode again after upload
+        asset->reload_again = true;
+        return;
+    }
+    asset->reloading = true;
+    SubmitDecode(asset);
+}
+int ReloadAssetFile(const char *path) {
+    int count = 0;
+    for(int i = 0; i < ASSET_CAPACITY; ++i) {
+        struct Asset *asset = ASSETS.slots + i;
+        if(asset->refs && (PathMatch(asset->path, path) || PathMatch(asset->vs_path, path))) {
+            ReloadAsset(asset);
+            count++;
+        }
+    }
+    return count;
+}
+int ReloadModifiedAssets(void) {
+    int count = 0;
+    for(int i = 0; i < ASSET_CAPACITY; ++i) {
+        struct Asset *asset = ASSETS.slots + i;
+        int state = asset->state.load();
+        if(!asset->refs || asset->reloading ||
+            (state != ASSET_STATE_READY && state != ASSET_STATE_FAILED)
+        ) {
+            continue;
+        }
+
+        long mod_time = 0;
+        if(asset->path[0]) {
+            mod_time = GetFileModTime(asset->path);
+        }
+        if(asset->vs_path[0]) {
+            long vs_mod_time = GetFileModTime(asset->vs_path);
+            if(vs_mod_time > mod_time) {
+                mod_time = vs_mod_time;
+            }
+        }
+
+        if(mod_time > asset->mod_time) {
+            ReloadAsset(asset);
+            count++;
+        }
+    }
+    return count;
+}
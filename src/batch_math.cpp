@@ -0,0 +1,707 @@
+/**
+ * @file   src/batch_math.cpp
+ * @brief  Math on arrays of floats, vectorized.
+ * @author Alicia D. Amarilla (smushyaa@gmail.com)
+ * @date   October 18, 2026
+*/
+#include "raylib.h"
+#include "batch_math.h"
+
+// NOTE(alicia): a fused multiply-add rounds once instead of twice,
+// the compiler must not fuse scalar kernels or they'd disagree with simd ones.
+// scoped to this file, sources.cpp includes everything into one translation unit.
+#if defined(__clang__)
+    #pragma STDC FP_CONTRACT OFF
+#elif defined(__GNUC__)
+    #pragma GCC push_options
+    #pragma GCC optimize("fp-contract=off")
+#endif
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__SSE2__)
+    #define BATCH_MATH_SSE2
+    #include <immintrin.h>
+
+    // NOTE(alicia): avx2 functions are compiled with a target attribute
+    // and only called once the cpu says it has avx2
+    #if defined(__GNUC__)
+        #define BATCH_MATH_AVX2
+        #define BATCH_MATH_TARGET_AVX2 __attribute__((target("avx2")))
+    #endif
+#endif
+
+#if PLATFORM == PLATFORM_WASM && defined(WASM_SIMD)
+    #define BATCH_MATH_WASM_SIMD128
+    #include <wasm_simd128.h>
+#endif
+
+typedef void TransformPointsFN(
+    Matrix matrix, const float *x, const float *y, const float *z,
+    float *out_x, float *out_y, float *out_z, int count);
+typedef void IntegrateFN(
+    float *position, float *velocity, float acceleration, float damping, float dt, int count);
+typedef int OverlapRectsFN(
+    const float *x, const float *y, const float *width, const float *height,
+    Rectangle area, uint8_t *out_hits, int count);
+typedef int OverlapBoxesFN(
+    const float *min_x, const float *min_y, const float *min_z,
+    const float *max_x, const float *max_y, const float *max_z,
+    BoundingBox area, uint8_t *out_hits, int count);
+typedef int CullSpheresFN(
+    const Frustum *frustum, const float *x, const float *y, const float *z, const float *radius,
+    uint8_t *out_hits, int count);
+
+struct BatchKernels {
+    TransformPointsFN *transform_points;
+    IntegrateFN       *integrate;
+    OverlapRectsFN    *overlap_rects;
+    OverlapBoxesFN    *overlap_boxes;
+    CullSpheresFN     *cull_spheres;
+};
+
+static const char *BATCH_MATH_PATH_NAMES[] = {
+    "scalar",
+    "SSE2",
+    "AVX2",
+    "WASM SIMD128",
+};
+static_assert(
+    sizeof(BATCH_MATH_PATH_NAMES) / sizeof(BATCH_MATH_PATH_NAMES[0]) == BATCH_MATH_PATH_COUNT,
+    "number of batch math path names does not match number of paths!");
+
+// NOTE(alicia): scalar kernels run [begin, count), simd kernels finish their tails with them.
+
+static void TransformPointsScalar(
+    Matrix m, const float *x, const float *y, const float *z,
+    float *out_x, float *out_y, float *out_z, int begin, int count
+) {
+    for(int i = begin; i < count; ++i) {
+        float vx = x[i];
+        float vy = y[i];
+        float vz = z[i];
+        out_x[i] = m.m0 * vx + m.m4 * vy + m.m8  * vz + m.m12;
+        out_y[i] = m.m1 * vx + m.m5 * vy + m.m9  * vz + m.m13;
+        out_z[i] = m.m2 * vx + m.m6 * vy + m.m10 * vz + m.m14;
+    }
+}
+static void IntegrateScalar(
+    float *position, float *velocity, float acceleration, float damping, float dt,
+    int begin, int count
+) {
+    float dv = acceleration * dt;
+    for(int i = begin; i < count; ++i) {
+        float v = (velocity[i] + dv) * damping;
+        velocity[i] = v;
+        position[i] = position[i] + v * dt;
+    }
+}
+static int OverlapRectsScalar(
+    const float *x, const float *y, const float *width, const float *height,
+    Rectangle area, uint8_t *out_hits, int begin, int count
+) {
+    float right  = area.x + area.width;
+    float bottom = area.y + area.height;
+    int   hits   = 0;
+    for(int i = begin; i < count; ++i) {
+        bool hit =
+            x[i] <= right  && area.x <= x[i] + width[i] &&
+            y[i] <= bottom && area.y <= y[i] + height[i];
+        out_hits[i] = hit;
+        hits += hit;
+    }
+    return hits;
+}
+static int OverlapBoxesScalar(
+    const float *min_x, const float *min_y, const float *min_z,
+    const float *max_x, const float *max_y, const float *max_z,
+    BoundingBox area, uint8_t *out_hits, int begin, int count
+) {
+    int hits = 0;
+    for(int i = begin; i < count; ++i) {
+        bool hit =
+            min_x[i] <= area.max.x && area.min.x <= max_x[i] &&
+            min_y[i] <= area.max.y && area.min.y <= max_y[i] &&
+            min_z[i] <= area.max.z && area.min.z <= max_z[i];
+        out_hits[i] = hit;
+        hits += hit;
+    }
+    return hits;
+}
+static int CullSpheresScalar(
+    const Frustum *frustum, const float *x, const float *y, const float *z, const float *radius,
+    uint8_t *out_hits, int begin, int count
+) {
+    int hits = 0;
+    for(int i = begin; i < count; ++i) {
+        bool  hit = true;
+        float r   = -radius[i];
+        for(int p = 0; p < 6; ++p) {
+            Vector4 plane = frustum->planes[p];
+            float d = plane.x * x[i] + plane.y * y[i] + plane.z * z[i] + plane.w;
+            hit = hit && d >= r;
+        }
+        out_hits[i] = hit;
+        hits += hit;
+    }
+    return hits;
+}
+
+static void TransformPoints_Scalar(
+    Matrix m, const float *x, const float *y, const float *z,
+    float *out_x, float *out_y, float *out_z, int count
+) {
+    TransformPointsScalar(m, x, y, z, out_x, out_y, out_z, 0, count);
+}
+static void Integrate_Scalar(
+    float *position, float *velocity, float acceleration, float damping, float dt, int count
+) {
+    IntegrateScalar(position, velocity, acceleration, damping, dt, 0, count);
+}
+static int OverlapRects_Scalar(
+    const float *x, const float *y, const float *width, const float *height,
+    Rectangle area, uint8_t *out_hits, int count
+) {
+    return OverlapRectsScalar(x, y, width, height, area, out_hits, 0, count);
+}
+static int OverlapBoxes_Scalar(
+    const float *min_x, const float *min_y, const float *min_z,
+    const float *max_x, const float *max_y, const float *max_z,
+    BoundingBox area, uint8_t *out_hits, int count
+) {
+    return OverlapBoxesScalar(min_x, min_y, min_z, max_x, max_y, max_z, area, out_hits, 0, count);
+}
+static int CullSpheres_Scalar(
+    const Frustum *frustum, const float *x, const float *y, const float *z, const float *radius,
+    uint8_t *out_hits, int count
+) {
+    return CullSpheresScalar(frustum, x, y, z, radius, out_hits, 0, count);
+}
+
+static const struct BatchKernels SCALAR_KERNELS = {
+    TransformPoints_Scalar,
+    Integrate_Scalar,
+    OverlapRects_Scalar,
+    OverlapBoxes_Scalar,
+    CullSpheres_Scalar,
+};
+
+// write lanes of a compare mask as 0 or 1 bytes, returns number of set lanes
+static int WriteHits(uint8_t *out_hits, int bits, int lanes) {
+    int hits = 0;
+    for(int i = 0; i < lanes; ++i) {
+        int hit = (bits >> i) & 1;
+        out_hits[i] = (uint8_t)hit;
+        hits += hit;
+    }
+    return hits;
+}
+
+#if defined(BATCH_MATH_SSE2)
+
+static void TransformPoints_SSE2(
+    Matrix m, const float *x, const float *y, const float *z,
+    float *out_x, float *out_y, float *out_z, int count
+) {
+    __m128 m0  = _mm_set1_ps(m.m0),  m4 = _mm_set1_ps(m.m4), m8  = _mm_set1_ps(m.m8);
+    __m128 m12 = _mm_set1_ps(m.m12), m1 = _mm_set1_ps(m.m1), m5  = _mm_set1_ps(m.m5);
+    __m128 m9  = _mm_set1_ps(m.m9), m13 = _mm_set1_ps(m.m13), m2 = _mm_set1_ps(m.m2);
+    __m128 m6  = _mm_set1_ps(m.m6), m10 = _mm_set1_ps(m.m10), m14 = _mm_set1_ps(m.m14);
+
+    int i = 0;
+    for(; i + 4 <= count; i += 4) {
+        __m128 vx = _mm_loadu_ps(x + i);
+        __m128 vy = _mm_loadu_ps(y + i);
+        __m128 vz = _mm_loadu_ps(z + i);
+
+        __m128 rx = _mm_add_ps(_mm_add_ps(_mm_add_ps(
+            _mm_mul_ps(m0, vx), _mm_mul_ps(m4, vy)), _mm_mul_ps(m8, vz)), m12);
+        __m128 ry = _mm_add_ps(_mm_add_ps(_mm_add_ps(
+            _mm_mul_ps(m1, vx), _mm_mul_ps(m5, vy)), _mm_mul_ps(m9, vz)), m13);
+        __m128 rz = _mm_add_ps(_mm_add_ps(_mm_add_ps(
+            _mm_mul_ps(m2, vx), _mm_mul_ps(m6, vy)), _mm_mul_ps(m10, vz)), m14);
+
+        _mm_storeu_ps(out_x + i, rx);
+        _mm_storeu_ps(out_y + i, ry);
+        _mm_storeu_ps(out_z + i, rz);
+    }
+    TransformPointsScalar(m, x, y, z, out_x, out_y, out_z, i, count);
+}
+static void Integrate_SSE2(
+    float *position, float *velocity, float acceleration, float damping, float dt, int count
+) {
+    __m128 dv = _mm_set1_ps(acceleration * dt);
+    __m128 vd = _mm_set1_ps(damping);
+    __m128 vt = _mm_set1_ps(dt);
+
+    int i = 0;
+    for(; i + 4 <= count; i += 4) {
+        __m128 v = _mm_mul_ps(_mm_add_ps(_mm_loadu_ps(velocity + i), dv), vd);
+        _mm_storeu_ps(velocity + i, v);
+        _mm_storeu_ps(position + i, _mm_add_ps(_mm_loadu_ps(position + i), _mm_mul_ps(v, vt)));
+    }
+    IntegrateScalar(position, velocity, acceleration, damping, dt, i, count);
+}
+static int OverlapRects_SSE2(
+    const float *x, const float *y, const float *width, const float *height,
+    Rectangle area, uint8_t *out_hits, int count
+) {
+    __m128 left   = _mm_set1_ps(area.x);
+    __m128 top    = _mm_set1_ps(area.y);
+    __m128 right  = _mm_set1_ps(area.x + area.width);
+    __m128 bottom = _mm_set1_ps(area.y + area.height);
+
+    int hits = 0;
+    int i    = 0;
+    for(; i + 4 <= count; i += 4) {
+        __m128 vx = _mm_loadu_ps(x + i);
+        __m128 vy = _mm_loadu_ps(y + i);
+        __m128 mask = _mm_and_ps(
+            _mm_and_ps(_mm_cmple_ps(vx, right), _mm_cmple_ps(left, _mm_add_ps(vx, _mm_loadu_ps(width + i)))),
+            _mm_and_ps(_mm_cmple_ps(vy, bottom), _mm_cmple_ps(top, _mm_add_ps(vy, _mm_loadu_ps(height + i)))));
+        hits += WriteHits(out_hits + i, _mm_movemask_ps(mask), 4);
+    }
+    return hits + OverlapRectsScalar(x, y, width, height, area, out_hits, i, count);
+}
+static int OverlapBoxes_SSE2(
+    const float *min_x, const float *min_y, const float *min_z,
+    const float *max_x, const float *max_y, const float *max_z,
+    BoundingBox area, uint8_t *out_hits, int count
+) {
+    __m128 lo_x = _mm_set1_ps(area.min.x), hi_x = _mm_set1_ps(area.max.x);
+    __m128 lo_y = _mm_set1_ps(area.min.y), hi_y = _mm_set1_ps(area.max.y);
+    __m128 lo_z = _mm_set1_ps(area.min.z), hi_z = _mm_set1_ps(area.max.z);
+
+    int hits = 0;
+    int i    = 0;
+    for(; i + 4 <= count; i += 4) {
+        __m128 mask_x = _mm_and_ps(
+            _mm_cmple_ps(_mm_loadu_ps(min_x + i), hi_x), _mm_cmple_ps(lo_x, _mm_loadu_ps(max_x + i)));
+        __m128 mask_y = _mm_and_ps(
+            _mm_cmple_ps(_mm_loadu_ps(min_y + i), hi_y), _mm_cmple_ps(lo_y, _mm_loadu_ps(max_y + i)));
+        __m128 mask_z = _mm_and_ps(
+            _mm_cmple_ps(_mm_loadu_ps(min_z + i), hi_z), _mm_cmple_ps(lo_z, _mm_loadu_ps(max_z + i)));
+        __m128 mask = _mm_and_ps(_mm_and_ps(mask_x, mask_y), mask_z);
+        hits += WriteHits(out_hits + i, _mm_movemask_ps(mask), 4);
+    }
+    return hits + OverlapBoxesScalar(
+        min_x, min_y, min_z, max_x, max_y, max_z, area, out_hits, i, count);
+}
+static int CullSpheres_SSE2(
+    const Frustum *frustum, const float *x, const float *y, const float *z, const float *radius,
+    uint8_t *out_hits, int count
+) {
+    int hits = 0;
+    int i    = 0;
+    for(; i + 4 <= count; i += 4) {
+        __m128 vx = _mm_loadu_ps(x + i);
+        __m128 vy = _mm_loadu_ps(y + i);
+        __m128 vz = _mm_loadu_ps(z + i);
+        __m128 vr = _mm_sub_ps(_mm_setzero_ps(), _mm_loadu_ps(radius + i));
+
+        __m128 mask = _mm_castsi128_ps(_mm_set1_epi32(-1));
+        for(int p = 0; p < 6; ++p) {
+            Vector4 plane = frustum->planes[p];
+            __m128 d = _mm_add_ps(_mm_add_ps(_mm_add_ps(
+                _mm_mul_ps(_mm_set1_ps(plane.x), vx),
+                _mm_mul_ps(_mm_set1_ps(plane.y), vy)),
+                _mm_mul_ps(_mm_set1_ps(plane.z), vz)),
+                _mm_set1_ps(plane.w));
+            mask = _mm_and_ps(mask, _mm_cmpge_ps(d, vr));
+        }
+        hits += WriteHits(out_hits + i, _mm_movemask_ps(mask), 4);
+    }
+    return hits + CullSpheresScalar(frustum, x, y, z, radius, out_hits, i, count);
+}
+
+static const struct BatchKernels SSE2_KERNELS = {
+    TransformPoints_SSE2,
+    Integrate_SSE2,
+    OverlapRects_SSE2,
+    OverlapBoxes_SSE2,
+    CullSpheres_SSE2,
+};
+
+#endif /* BATCH_MATH_SSE2 */
+
+#if defined(BATCH_MATH_AVX2)
+
+BATCH_MATH_TARGET_AVX2
+static void TransformPoints_AVX2(
+    Matrix m, const float *x, const float *y, const float *z,
+    float *out_x, float *out_y, float *out_z, int count
+) {
+    __m256 m0  = _mm256_set1_ps(m.m0),  m4 = _mm256_set1_ps(m.m4), m8  = _mm256_set1_ps(m.m8);
+    __m256 m12 = _mm256_set1_ps(m.m12), m1 = _mm256_set1_ps(m.m1), m5  = _mm256_set1_ps(m.m5);
+    __m256 m9  = _mm256_set1_ps(m.m9), m13 = _mm256_set1_ps(m.m13), m2 = _mm256_set1_ps(m.m2);
+    __m256 m6  = _mm256_set1_ps(m.m6), m10 = _mm256_set1_ps(m.m10), m14 = _mm256_set1_ps(m.m14);
+
+    int i = 0;
+    for(; i + 8 <= count; i += 8) {
+        __m256 vx = _mm256_loadu_ps(x + i);
+        __m256 vy = _mm256_loadu_ps(y + i);
+        __m256 vz = _mm256_loadu_ps(z + i);
+
+        __m256 rx = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(
+            _mm256_mul_ps(m0, vx), _mm256_mul_ps(m4, vy)), _mm256_mul_ps(m8, vz)), m12);
+        __m256 ry = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(
+            _mm256_mul_ps(m1, vx), _mm256_mul_ps(m5, vy)), _mm256_mul_ps(m9, vz)), m13);
+        __m256 rz = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(
+            _mm256_mul_ps(m2, vx), _mm256_mul_ps(m6, vy)), _mm256_mul_ps(m10, vz)), m14);
+
+        _mm256_storeu_ps(out_x + i, rx);
+        _mm256_storeu_ps(out_y + i, ry);
+        _mm256_storeu_ps(out_z + i, rz);
+    }
+    TransformPointsScalar(m, x, y, z, out_x, out_y, out_z, i, count);
+}
+BATCH_MATH_TARGET_AVX2
+static void Integrate_AVX2(
+    float *position, float *velocity, float acceleration, float damping, float dt, int count
+) {
+    __m256 dv = _mm256_set1_ps(acceleration * dt);
+    __m256 vd = _mm256_set1_ps(damping);
+    __m256 vt = _mm256_set1_ps(dt);
+
+    int i = 0;
+    for(; i + 8 <= count; i += 8) {
+        __m256 v = _mm256_mul_ps(_mm256_add_ps(_mm256_loadu_ps(velocity + i), dv), vd);
+        _mm256_storeu_ps(velocity + i, v);
+        _mm256_storeu_ps(position + i,
+            _mm256_add_ps(_mm256_loadu_ps(position + i), _mm256_mul_ps(v, vt)));
+    }
+    IntegrateScalar(position, velocity, acceleration, damping, dt, i, count);
+}
+BATCH_MATH_TARGET_AVX2
+static int OverlapRects_AVX2(
+    const float *x, const float *y, const float *width, const float *height,
+    Rectangle area, uint8_t *out_hits, int count
+) {
+    __m256 left   = _mm256_set1_ps(area.x);
+    __m256 top    = _mm256_set1_ps(area.y);
+    __m256 right  = _mm256_set1_ps(area.x + area.width);
+    __m256 bottom = _mm256_set1_ps(area.y + area.height);
+
+    int hits = 0;
+    int i    = 0;
+    for(; i + 8 <= count; i += 8) {
+        __m256 vx = _mm256_loadu_ps(x + i);
+        __m256 vy = _mm256_loadu_ps(y + i);
+        __m256 mask = _mm256_and_ps(
+            _mm256_and_ps(
+                _mm256_cmp_ps(vx, right, _CMP_LE_OQ),
+                _mm256_cmp_ps(left, _mm256_add_ps(vx, _mm256_loadu_ps(width + i)), _CMP_LE_OQ)),
+            _mm256_and_ps(
+                _mm256_cmp_ps(vy, bottom, _CMP_LE_OQ),
+                _mm256_cmp_ps(top, _mm256_add_ps(vy, _mm256_loadu_ps(height + i)), _CMP_LE_OQ)));
+        hits += WriteHits(out_hits + i, _mm256_movemask_ps(mask), 8);
+    }
+    return hits + OverlapRectsScalar(x, y, width, height, area, out_hits, i, count);
+}
+BATCH_MATH_TARGET_AVX2
+static int OverlapBoxes_AVX2(
+    const float *min_x, const float *min_y, const float *min_z,
+    const float *max_x, const float *max_y, const float *max_z,
+    BoundingBox area, uint8_t *out_hits, int count
+) {
+    __m256 lo_x = _mm256_set1_ps(area.min.x), hi_x = _mm256_set1_ps(area.max.x);
+    __m256 lo_y = _mm256_set1_ps(area.min.y), hi_y = _mm256_set1_ps(area.max.y);
+    __m256 lo_z = _mm256_set1_ps(area.min.z), hi_z = _mm256_set1_ps(area.max.z);
+
+    int hits = 0;
+    int i    = 0;
+    for(; i + 8 <= count; i += 8) {
+        __m256 mask_x = _mm256_and_ps(
+            _mm256_cmp_ps(_mm256_loadu_ps(min_x + i), hi_x, _CMP_LE_OQ),
+            _mm256_cmp_ps(lo_x, _mm256_loadu_ps(max_x + i), _CMP_LE_OQ));
+        __m256 mask_y = _mm256_and_ps(
+            _mm256_cmp_ps(_mm256_loadu_ps(min_y + i), hi_y, _CMP_LE_OQ),
+            _mm256_cmp_ps(lo_y, _mm256_loadu_ps(max_y + i), _CMP_LE_OQ));
+        __m256 mask_z = _mm256_and_ps(
+            _mm256_cmp_ps(_mm256_loadu_ps(min_z + i), hi_z, _CMP_LE_OQ),
+            _mm256_cmp_ps(lo_z, _mm256_loadu_ps(max_z + i), _CMP_LE_OQ));
+        __m256 mask = _mm256_and_ps(_mm256_and_ps(mask_x, mask_y), mask_z);
+        hits += WriteHits(out_hits + i, _mm256_movemask_ps(mask), 8);
+    }
+    return hits + OverlapBoxesScalar(
+        min_x, min_y, min_z, max_x, max_y, max_z, area, out_hits, i, count);
+}
+BATCH_MATH_TARGET_AVX2
+static int CullSpheres_AVX2(
+    const Frustum *frustum, const float *x, const float *y, const float *z, const float *radius,
+    uint8_t *out_hits, int count
+) {
+    int hits = 0;
+    int i    = 0;
+    for(; i + 8 <= count; i += 8) {
+        __m256 vx = _mm256_loadu_ps(x + i);
+        __m256 vy = _mm256_loadu_ps(y + i);
+        __m256 vz = _mm256_loadu_ps(z + i);
+        __m256 vr = _mm256_sub_ps(_mm256_setzero_ps(), _mm256_loadu_ps(radius + i));
+
+        __m256 mask = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+        for(int p = 0; p < 6; ++p) {
+            Vector4 plane = frustum->planes[p];
+            __m256 d = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(
+                _mm256_mul_ps(_mm256_set1_ps(plane.x), vx),
+                _mm256_mul_ps(_mm256_set1_ps(plane.y), vy)),
+                _mm256_mul_ps(_mm256_set1_ps(plane.z), vz)),
+                _mm256_set1_ps(plane.w));
+            mask = _mm256_and_ps(mask, _mm256_cmp_ps(d, vr, _CMP_GE_OQ));
+        }
+        hits += WriteHits(out_hits + i, _mm256_movemask_ps(mask), 8);
+    }
+    return hits + CullSpheresScalar(frustum, x, y, z, radius, out_hits, i, count);
+}
+
+static const struct BatchKernels AVX2_KERNELS = {
+    TransformPoints_AVX2,
+    Integrate_AVX2,
+    OverlapRects_AVX2,
+    OverlapBoxes_AVX2,
+    CullSpheres_AVX2,
+};
+
+#endif /* BATCH_MATH_AVX2 */
+
+#if defined(BATCH_MATH_WASM_SIMD128)
+
+static void TransformPoints_WASM(
+    Matrix m, const float *x, const float *y, const float *z,
+    float *out_x, float *out_y, float *out_z, int count
+) {
+    v128_t m0  = wasm_f32x4_splat(m.m0),  m4 = wasm_f32x4_splat(m.m4), m8  = wasm_f32x4_splat(m.m8);
+    v128_t m12 = wasm_f32x4_splat(m.m12), m1 = wasm_f32x4_splat(m.m1), m5  = wasm_f32x4_splat(m.m5);
+    v128_t m9  = wasm_f32x4_splat(m.m9), m13 = wasm_f32x4_splat(m.m13), m2 = wasm_f32x4_splat(m.m2);
+    v128_t m6  = wasm_f32x4_splat(m.m6), m10 = wasm_f32x4_splat(m.m10), m14 = wasm_f32x4_splat(m.m14);
+
+    int i = 0;
+    for(; i + 4 <= count; i += 4) {
+        v128_t vx = wasm_v128_load(x + i);
+        v128_t vy = wasm_v128_load(y + i);
+        v128_t vz = wasm_v128_load(z + i);
+
+        v128_t rx = wasm_f32x4_add(wasm_f32x4_add(wasm_f32x4_add(
+            wasm_f32x4_mul(m0, vx), wasm_f32x4_mul(m4, vy)), wasm_f32x4_mul(m8, vz)), m12);
+        v128_t ry = wasm_f32x4_add(wasm_f32x4_add(wasm_f32x4_add(
+            wasm_f32x4_mul(m1, vx), wasm_f32x4_mul(m5, vy)), wasm_f32x4_mul(m9, vz)), m13);
+        v128_t rz = wasm_f32x4_add(wasm_f32x4_add(wasm_f32x4_add(
+            wasm_f32x4_mul(m2, vx), wasm_f32x4_mul(m6, vy)), wasm_f32x4_mul(m10, vz)), m14);
+
+        wasm_v128_store(out_x + i, rx);
+        wasm_v128_store(out_y + i, ry);
+        wasm_v128_store(out_z + i, rz);
+    }
+    TransformPointsScalar(m, x, y, z, out_x, out_y, out_z, i, count);
+}
+static void Integrate_WASM(
+    float *position, float *velocity, float acceleration, float damping, float dt, int count
+) {
+    v128_t dv = wasm_f32x4_splat(acceleration * dt);
+    v128_t vd = wasm_f32x4_splat(damping);
+    v128_t vt = wasm_f32x4_splat(dt);
+
+    int i = 0;
+    for(; i + 4 <= count; i += 4) {
+        v128_t v = wasm_f32x4_mul(wasm_f32x4_add(wasm_v128_load(velocity + i), dv), vd);
+        wasm_v128_store(velocity + i, v);
+        wasm_v128_store(position + i,
+            wasm_f32x4_add(wasm_v128_load(position + i), wasm_f32x4_mul(v, vt)));
+    }
+    IntegrateScalar(position, velocity, acceleration, damping, dt, i, count);
+}
+static int OverlapRects_WASM(
+    const float *x, const float *y, const float *width, const float *height,
+    Rectangle area, uint8_t *out_hits, int count
+) {
+    v128_t left   = wasm_f32x4_splat(area.x);
+    v128_t top    = wasm_f32x4_splat(area.y);
+    v128_t right  = wasm_f32x4_splat(area.x + area.width);
+    v128_t bottom = wasm_f32x4_splat(area.y + area.height);
+
+    int hits = 0;
+    int i    = 0;
+    for(; i + 4 <= count; i += 4) {
+        v128_t vx = wasm_v128_load(x + i);
+        v128_t vy = wasm_v128_load(y + i);
+        v128_t mask = wasm_v128_and(
+            wasm_v128_and(
+                wasm_f32x4_le(vx, right),
+                wasm_f32x4_le(left, wasm_f32x4_add(vx, wasm_v128_load(width + i)))),
+            wasm_v128_and(
+                wasm_f32x4_le(vy, bottom),
+                wasm_f32x4_le(top, wasm_f32x4_add(vy, wasm_v128_load(height + i)))));
+        hits += WriteHits(out_hits + i, (int)wasm_i32x4_bitmask(mask), 4);
+    }
+    return hits + OverlapRectsScalar(x, y, width, height, area, out_hits, i, count);
+}
+static int OverlapBoxes_WASM(
+    const float *min_x, const float *min_y, const float *min_z,
+    const float *max_x, const float *max_y, const float *max_z,
+    BoundingBox area, uint8_t *out_hits, int count
+) {
+    v128_t lo_x = wasm_f32x4_splat(area.min.x), hi_x = wasm_f32x4_splat(area.max.x);
+    v128_t lo_y = wasm_f32x4_splat(area.min.y), hi_y = wasm_f32x4_splat(area.max.y);
+    v128_t lo_z = wasm_f32x4_splat(area.min.z), hi_z = wasm_f32x4_splat(area.max.z);
+
+    int hits = 0;
+    int i    = 0;
+    for(; i + 4 <= count; i += 4) {
+        v128_t mask_x = wasm_v128_and(
+            wasm_f32x4_le(wasm_v128_load(min_x + i), hi_x),
+            wasm_f32x4_le(lo_x, wasm_v128_load(max_x + i)));
+        v128_t mask_y = wasm_v128_and(
+            wasm_f32x4_le(wasm_v128_load(min_y + i), hi_y),
+            wasm_f32x4_le(lo_y, wasm_v128_load(max_y + i)));
+        v128_t mask_z = wasm_v128_and(
+            wasm_f32x4_le(wasm_v128_load(min_z + i), hi_z),
+            wasm_f32x4_le(lo_z, wasm_v128_load(max_z + i)));
+        v128_t mask = wasm_v128_and(wasm_v128_and(mask_x, mask_y), mask_z);
+        hits += WriteHits(out_hits + i, (int)wasm_i32x4_bitmask(mask), 4);
+    }
+    return hits + OverlapBoxesScalar(
+        min_x, min_y, min_z, max_x, max_y, max_z, area, out_hits, i, count);
+}
+static int CullSpheres_WASM(
+    const Frustum *frustum, const float *x, const float *y, const float *z, const float *radius,
+    uint8_t *out_hits, int count
+) {
+    int hits = 0;
+    int i    = 0;
+    for(; i + 4 <= count; i += 4) {
+        v128_t vx = wasm_v128_load(x + i);
+        v128_t vy = wasm_v128_load(y + i);
+        v128_t vz = wasm_v128_load(z + i);
+        v128_t vr = wasm_f32x4_neg(wasm_v128_load(radius + i));
+
+        v128_t mask = wasm_i32x4_splat(-1);
+        for(int p = 0; p < 6; ++p) {
+            Vector4 plane = frustum->planes[p];
+            v128_t d = wasm_f32x4_add(wasm_f32x4_add(wasm_f32x4_add(
+                wasm_f32x4_mul(wasm_f32x4_splat(plane.x), vx),
+                wasm_f32x4_mul(wasm_f32x4_splat(plane.y), vy)),
+                wasm_f32x4_mul(wasm_f32x4_splat(plane.z), vz)),
+                wasm_f32x4_splat(plane.w));
+            mask = wasm_v128_and(mask, wasm_f32x4_ge(d, vr));
+        }
+        hits += WriteHits(out_hits + i, (int)wasm_i32x4_bitmask(mask), 4);
+    }
+    return hits + CullSpheresScalar(frustum, x, y, z, radius, out_hits, i, count);
+}
+
+static const struct BatchKernels WASM_KERNELS = {
+    TransformPoints_WASM,
+    Integrate_WASM,
+    OverlapRects_WASM,
+    OverlapBoxes_WASM,
+    CullSpheres_WASM,
+};
+
+#endif /* BATCH_MATH_WASM_SIMD128 */
+
+static struct {
+    enum BatchMathPath path;
+    const struct BatchKernels *kernels;
+} BATCH_MATH = {
+    BATCH_MATH_PATH_SCALAR,
+    &SCALAR_KERNELS,
+};
+
+static const struct BatchKernels *KernelsForPath(enum BatchMathPath path) {
+    switch(path) {
+        case BATCH_MATH_PATH_SCALAR:
+            return &SCALAR_KERNELS;
+        case BATCH_MATH_PATH_SSE2:
+#if defined(BATCH_MATH_SSE2)
+            return &SSE2_KERNELS;
+#else
+            return NULL;
+#endif
+        case BATCH_MATH_PATH_AVX2:
+#if defined(BATCH_MATH_AVX2)
+            __builtin_cpu_init();
+            return __builtin_cpu_supports("avx2") ? &AVX2_KERNELS : NULL;
+#else
+            return NULL;
+#endif
+        case BATCH_MATH_PATH_WASM_SIMD128:
+#if defined(BATCH_MATH_WASM_SIMD128)
+            return &WASM_KERNELS;
+#else
+            return NULL;
+#endif
+        case BATCH_MATH_PATH_COUNT:
+            break;
+    }
+    return NULL;
+}
+
+void InitBatchMath(void) {
+    // NOTE(alicia): widest first
+    static const enum BatchMathPath PREFERRED[] = {
+        BATCH_MATH_PATH_AVX2,
+        BATCH_MATH_PATH_WASM_SIMD128,
+        BATCH_MATH_PATH_SSE2,
+        BATCH_MATH_PATH_SCALAR,
+    };
+    for(size_t i = 0; i < sizeof(PREFERRED) / sizeof(PREFERRED[0]); ++i) {
+        if(SetBatchMathPath(PREFERRED[i])) {
+            break;
+        }
+    }
+    TraceLog(LOG_INFO, "BATCH MATH: Using %s", GetBatchMathPathName(BATCH_MATH.path));
+}
+bool SetBatchMathPath(enum BatchMathPath path) {
+    const struct BatchKernels *kernels = KernelsForPath(path);
+    if(!kernels) {
+        return false;
+    }
+    BATCH_MATH.path    = path;
+    BATCH_MATH.kernels = kernels;
+    return true;
+}
+enum BatchMathPath GetBatchMathPath(void) {
+    return BATCH_MATH.path;
+}
+const char *GetBatchMathPathName(enum BatchMathPath path) {
+    if(path < 0 || path >= BATCH_MATH_PATH_COUNT) {
+        return "unknown";
+    }
+    return BATCH_MATH_PATH_NAMES[path];
+}
+
+void BatchTransformPoints(
+    Matrix matrix, const float *x, const float *y, const float *z,
+    float *out_x, float *out_y, float *out_z, int count
+) {
+    BATCH_MATH.kernels->transform_points(matrix, x, y, z, out_x, out_y, out_z, count);
+}
+void BatchIntegrate(
+    float *position, float *velocity, float acceleration, float damping, float dt, int count
+) {
+    BATCH_MATH.kernels->integrate(position, velocity, acceleration, damping, dt, count);
+}
+int BatchOverlapRects(
+    const float *x, const float *y, const float *width, const float *height,
+    Rectangle area, uint8_t *out_hits, int count
+) {
+    return BATCH_MATH.kernels->overlap_rects(x, y, width, height, area, out_hits, count);
+}
+int BatchOverlapBoxes(
+    const float *min_x, const float *min_y, const float *min_z,
+    const float *max_x, const float *max_y, const float *max_z,
+    BoundingBox area, uint8_t *out_hits, int count
+) {
+    return BATCH_MATH.kernels->overlap_boxes(
+        min_x, min_y, min_z, max_x, max_y, max_z, area, out_hits, count);
+}
+int BatchCullSpheres(
+    const Frustum *frustum, const float *x, const float *y, const float *z, const float *radius,
+    uint8_t *out_hits, int count
+) {
+    return BATCH_MATH.kernels->cull_spheres(frustum, x, y, z, radius, out_hits, count);
+}
+
+#if defined(__clang__)
+    #pragma STDC FP_CONTRACT DEFAULT
+#elif defined(__GNUC__)
+    #pragma GCC pop_options
+#endif
@@ -0,0 +1,481 @@
+/**
+ * @file   src/ecs.cpp
+ * @brief  Entities, components and systems.
+ * @author Alicia D. Amarilla (smushyaa@gmail.com)
+ * @date   October 18, 2026
+*/
+#include "raylib.h"
+#include "ecs.h"
+#include "jobs.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <atomic>
+#include <thread>
+
+// NOTE(alicia): same layout as asset handles,
+// index + 1 in the low bits and generation in the high bits.
+#define ECS_INDEX_BITS      20
+#define ECS_INDEX_MASK      ((1u << ECS_INDEX_BITS) - 1)
+#define ECS_GENERATION_MASK ((1u << (32 - ECS_INDEX_BITS)) - 1)
+#define ECS_NAME_MAX        32
+
+// systems that may be waiting on late jobs at once
+#define ECS_DISPATCH_MAX 16
+
+struct ComponentPool {
+    char   name[ECS_NAME_MAX];
+    size_t size;
+
+    // entity index -> dense index, only valid when the entity's mask has this component
+    uint32_t *sparse;
+    Entity   *entities;
+    unsigned char *data;
+    int count;
+    int cap;
+};
+
+struct System {
+    char      name[ECS_NAME_MAX];
+    SystemFN *fn;
+    void     *user;
+    int  components[ECS_QUERY_MAX];
+    int  component_count;
+    bool parallel;
+};
+
+// NOTE(alicia): jobs can start after the system they were submitted for
+// already finished on other threads, so dispatches live in a pool and
+// are only reused once every job let go of them.
+struct SystemDispatch {
+    std::atomic<int> refs;
+    std::atomic<int> next;
+    std::atomic<int> done;
+    int chunks;
+
+    const struct System *system;
+    EcsView view;
+    float   dt;
+};
+
+static struct {
+    int capacity;
+    int count;
+
+    uint16_t *generations;
+    uint64_t *masks;
+    uint32_t *free;
+    int       free_count;
+
+    struct ComponentPool components[ECS_COMPONENT_MAX];
+    int component_count;
+
+    struct System systems[ECS_SYSTEM_MAX];
+    int system_count;
+
+    struct SystemDispatch dispatch[ECS_DISPATCH_MAX];
+} ECS;
+
+// index of live entity, -1 if stale or invalid
+static int EntityIndex(Entity entity) {
+    uint32_t index = entity.id & ECS_INDEX_MASK;
+    if(!index || index > (uint32_t)ECS.capacity) {
+        return -1;
+    }
+    index--;
+    if(ECS.generations[index] != (entity.id >> ECS_INDEX_BITS)) {
+        return -1;
+    }
+    return (int)index;
+}
+static Entity EntityFromIndex(uint32_t index) {
+    Entity entity;
+    entity.id = ((uint32_t)ECS.generations[index] << ECS_INDEX_BITS) | (index + 1);
+    return entity;
+}
+
+static bool ValidComponent(int component) {
+    return component >= 0 && component < ECS.component_count;
+}
+
+static bool GrowPool(struct ComponentPool *pool) {
+    int cap = pool->cap ? pool->cap * 2 : 256;
+    if(cap > ECS.capacity) {
+        cap = ECS.capacity;
+    }
+
+    Entity *entities = (Entity *)realloc(pool->entities, cap * sizeof(Entity));
+    if(!entities) {
+        return false;
+    }
+    pool->entities = entities;
+
+    if(pool->size) {
+        unsigned char *data = (unsigned char *)realloc(pool->data, cap * pool->size);
+        if(!data) {
+            return false;
+        }
+        pool->data = data;
+    }
+
+    pool->cap = cap;
+    return true;
+}
+
+static void SwapDense(struct ComponentPool *pool, int a, int b) {
+    if(a == b) {
+        return;
+    }
+
+    Entity ea = pool->entities[a];
+    Entity eb = pool->entities[b];
+    pool->entities[a] = eb;
+    pool->entities[b] = ea;
+    pool->sparse[(ea.id & ECS_INDEX_MASK) - 1] = (uint32_t)b;
+    pool->sparse[(eb.id & ECS_INDEX_MASK) - 1] = (uint32_t)a;
+
+    unsigned char *pa = pool->data + (size_t)a * pool->size;
+    unsigned char *pb = pool->data + (size_t)b * pool->size;
+    unsigned char  tmp[64];
+    for(size_t at = 0; at < pool->size; at += sizeof(tmp)) {
+        size_t len = pool->size - at < sizeof(tmp) ? pool->size - at : sizeof(tmp);
+        memcpy(tmp, pa + at, len);
+        memcpy(pa + at, pb + at, len);
+        memcpy(pb + at, tmp, len);
+    }
+}
+
+static void RemoveFromPool(struct ComponentPool *pool, int index) {
+    uint32_t dense = pool->sparse[index];
+    uint32_t last  = (uint32_t)(pool->count - 1);
+    SwapDense(pool, (int)dense, (int)last);
+    pool->count--;
+}
+
+void InitEcs(int entity_capacity) {
+    if(entity_capacity <= 0) {
+        entity_capacity = ECS_ENTITY_CAPACITY;
+    }
+    if(entity_capacity > (int)ECS_INDEX_MASK) {
+        entity_capacity = (int)ECS_INDEX_MASK;
+    }
+
+    ECS.capacity    = entity_capacity;
+    ECS.count       = 0;
+    ECS.generations = (uint16_t *)calloc(entity_capacity, sizeof(uint16_t));
+    ECS.masks       = (uint64_t *)calloc(entity_capacity, sizeof(uint64_t));
+    ECS.free        = (uint32_t *)malloc(entity_capacity * sizeof(uint32_t));
+    if(!ECS.generations || !ECS.masks || !ECS.free) {
+        TraceLog(LOG_ERROR, "ECS: Failed to allocate %d entities", entity_capacity);
+        free(ECS.generations);
+        free(ECS.masks);
+        free(ECS.free);
+        ECS.generations = NULL;
+        ECS.masks       = NULL;
+        ECS.free        = NULL;
+        ECS.capacity    = 0;
+        return;
+    }
+
+    // NOTE(alicia): popped from the back, lowest indices are used first
+    for(int i = 0; i < entity_capacity; ++i) {
+        ECS.generations[i] = 1;
+        ECS.free[i] = (uint32_t)(entity_capacity - 1 - i);
+    }
+    ECS.free_count = entity_capacity;
+
+    TraceLog(LOG_INFO, "ECS: Initialized with capacity for %d entities", entity_capacity);
+}
+void ShutdownEcs(void) {
+    // NOTE(alicia): wait for late jobs, they still point into dispatches
+    for(int i = 0; i < ECS_DISPATCH_MAX; ++i) {
+        while(ECS.dispatch[i].refs.load(std::memory_order_acquire)) {
+            std::this_thread::yield();
+        }
+    }
+
+    for(int i = 0; i < ECS.component_count; ++i) {
+        struct ComponentPool *pool = ECS.components + i;
+        free(pool->sparse);
+        free(pool->entities);
+        free(pool->data);
+        memset(pool, 0, sizeof(*pool));
+    }
+    free(ECS.generations);
+    free(ECS.masks);
+    free(ECS.free);
+
+    ECS.generations     = NULL;
+    ECS.masks           = NULL;
+    ECS.free            = NULL;
+    ECS.capacity        = 0;
+    ECS.count           = 0;
+    ECS.free_count      = 0;
+    ECS.component_count = 0;
+    ECS.system_count    = 0;
+}
+
+Entity CreateEntity(void) {
+    Entity entity;
+    entity.id = 0;
+    if(!ECS.free_count) {
+        return entity;
+    }
+
+    uint32_t index = ECS.free[--ECS.free_count];
+    ECS.masks[index] = 0;
+    ECS.count++;
+    return EntityFromIndex(index);
+}
+void DestroyEntity(Entity entity) {
+    int index = EntityIndex(entity);
+    if(index < 0) {
+        return;
+    }
+
+    uint64_t mask = ECS.masks[index];
+    for(int i = 0; mask; ++i, mask >>= 1) {
+        if(mask & 1) {
+            RemoveFromPool(ECS.components + i, index);
+        }
+    }
+    ECS.masks[index] = 0;
+
+    uint16_t generation = (uint16_t)((ECS.generations[index] + 1) & ECS_GENERATION_MASK);
+    ECS.generations[index] = generation ? generation : 1;
+
+    ECS.free[ECS.free_count++] = (uint32_t)index;
+    ECS.count--;
+}
+bool IsEntityAlive(Entity entity) {
+    return EntityIndex(entity) >= 0;
+}
+int GetEntityCount(void) {
+    return ECS.count;
+}
+
+int RegisterComponent(const char *name, size_t size) {
+    if(ECS.component_count == ECS_COMPONENT_MAX) {
+        TraceLog(LOG_WARNING, "ECS: Failed to register %s, %d components are registered",
+            name, ECS_COMPONENT_MAX);
+        return -1;
+    }
+
+    struct ComponentPool *pool = ECS.components + ECS.component_count;
+    memset(pool, 0, sizeof(*pool));
+    strncpy(pool->name, name, sizeof(pool->name) - 1);
+    pool->size   = size;
+    pool->sparse = (uint32_t *)malloc(ECS.capacity * sizeof(uint32_t));
+    if(!pool->sparse) {
+        TraceLog(LOG_WARNING, "ECS: Failed to allocate %s", name);
+        return -1;
+    }
+
+    return ECS.component_count++;
+}
+
+void *AddComponent(Entity entity, int component) {
+    int index = EntityIndex(entity);
+    if(index < 0 || !ValidComponent(component)) {
+        return NULL;
+    }
+
+    struct ComponentPool *pool = ECS.components + component;
+    uint64_t bit = (uint64_t)1 << component;
+    if(ECS.masks[index] & bit) {
+        return pool->data + (size_t)pool->sparse[index] * pool->size;
+    }
+
+    if(pool->count == pool->cap && !GrowPool(pool)) {
+        TraceLog(LOG_WARNING, "ECS: Out of memory adding %s", pool->name);
+        return NULL;
+    }
+
+    int dense = pool->count++;
+    pool->sparse[index]   = (uint32_t)dense;
+    pool->entities[dense] = entity;
+    ECS.masks[index] |= bit;
+
+    void *data = pool->data + (size_t)dense * pool->size;
+    memset(data, 0, pool->size);
+    return data;
+}
+void RemoveComponent(Entity entity, int component) {
+    int index = EntityIndex(entity);
+    if(index < 0 || !ValidComponent(component)) {
+        return;
+    }
+
+    uint64_t bit = (uint64_t)1 << component;
+    if(!(ECS.masks[index] & bit)) {
+        return;
+    }
+    RemoveFromPool(ECS.components + component, index);
+    ECS.masks[index] &= ~bit;
+}
+bool HasComponent(Entity entity, int component) {
+    int index = EntityIndex(entity);
+    if(index < 0 || !ValidComponent(component)) {
+        return false;
+    }
+    return (ECS.masks[index] >> component) & 1;
+}
+void *GetComponent(Entity entity, int component) {
+    if(!HasComponent(entity, component)) {
+        return NULL;
+    }
+    struct ComponentPool *pool = ECS.components + component;
+    return pool->data + (size_t)pool->sparse[EntityIndex(entity)] * pool->size;
+}
+int GetComponentCount(int component) {
+    if(!ValidComponent(component)) {
+        return 0;
+    }
+    return ECS.components[component].count;
+}
+
+bool QueryEntities(const int *components, int component_count, EcsView *out_view) {
+    memset(out_view, 0, sizeof(*out_view));
+    if(component_count <= 0 || component_count > ECS_QUERY_MAX) {
+        return false;
+    }
+
+    uint64_t mask = 0;
+    int driver = components[0];
+    for(int i = 0; i < component_count; ++i) {
+        if(!ValidComponent(components[i])) {
+            return false;
+        }
+        mask |= (uint64_t)1 << components[i];
+        if(ECS.components[components[i]].count < ECS.components[driver].count) {
+            driver = components[i];
+        }
+    }
+
+    // NOTE(alicia): matches are swapped to [0, count) of every pool in driver order.
+    // dense slots before count only hold earlier matches,
+    // so each match is always found at or after count.
+    struct ComponentPool *pool = ECS.components + driver;
+    int count = 0;
+    for(int i = 0; i < pool->count; ++i) {
+        uint32_t index = (pool->entities[i].id & ECS_INDEX_MASK) - 1;
+        if((ECS.masks[index] & mask) != mask) {
+            continue;
+        }
+        for(int c = 0; c < component_count; ++c) {
+            struct ComponentPool *other = ECS.components + components[c];
+            SwapDense(other, (int)other->sparse[index], count);
+        }
+        count++;
+    }
+
+    out_view->count    = count;
+    out_view->entities = pool->entities;
+    for(int c = 0; c < component_count; ++c) {
+        out_view->components[c] = ECS.components[components[c]].data;
+    }
+    return true;
+}
+
+int RegisterSystem(
+    const char *name, SystemFN *fn,
+    const int *components, int component_count, bool parallel, void *user
+) {
+    if(ECS.system_count == ECS_SYSTEM_MAX) {
+        TraceLog(LOG_WARNING, "ECS: Failed to register %s, %d systems are registered",
+            name, ECS_SYSTEM_MAX);
+        return -1;
+    }
+    if(component_count <= 0 || component_count > ECS_QUERY_MAX) {
+        TraceLog(LOG_WARNING, "ECS: Failed to register %s, systems query 1 to %d components",
+            name, ECS_QUERY_MAX);
+        return -1;
+    }
+
+    struct System *system = ECS.systems + ECS.system_count;
+    memset(system, 0, sizeof(*system));
+    strncpy(system->name, name, sizeof(system->name) - 1);
+    system->fn       = fn;
+    system->user     = user;
+    system->parallel = parallel;
+    system->component_count = component_count;
+    memcpy(system->components, components, component_count * sizeof(components[0]));
+
+    return ECS.system_count++;
+}
+
+static void RunChunks(struct SystemDispatch *dispatch) {
+    int chunk;
+    while((chunk = dispatch->next.fetch_add(1, std::memory_order_relaxed)) < dispatch->chunks) {
+        int begin = chunk * ECS_CHUNK_SIZE;
+        int end   = begin + ECS_CHUNK_SIZE;
+        if(end > dispatch->view.count) {
+            end = dispatch->view.count;
+        }
+        dispatch->system->fn(&dispatch->view, begin, end, dispatch->dt, dispatch->system->user);
+        dispatch->done.fetch_add(1, std::memory_order_release);
+    }
+}
+static void SystemJob(void *params) {
+    struct SystemDispatch *dispatch = (struct SystemDispatch *)params;
+    RunChunks(dispatch);
+    dispatch->refs.fetch_sub(1, std::memory_order_release);
+}
+
+static struct SystemDispatch *AcquireDispatch(void) {
+    for(int i = 0; i < ECS_DISPATCH_MAX; ++i) {
+        if(!ECS.dispatch[i].refs.load(std::memory_order_acquire)) {
+            return ECS.dispatch + i;
+        }
+    }
+    return NULL;
+}
+
+void RunSystems(float dt) {
+    for(int i = 0; i < ECS.system_count; ++i) {
+        const struct System *system = ECS.systems + i;
+
+        EcsView view;
+        if(!QueryEntities(system->components, system->component_count, &view) || !view.count) {
+            continue;
+        }
+
+        int chunks = (view.count + ECS_CHUNK_SIZE - 1) / ECS_CHUNK_SIZE;
+        int jobs   = chunks - 1;
+        if(jobs > GetJobWorkerCount()) {
+            jobs = GetJobWorkerCount();
+        }
+
+        struct SystemDispatch *dispatch = NULL;
+        if(system->parallel && jobs > 0) {
+            dispatch = AcquireDispatch();
+        }
+        if(!dispatch) {
+            system->fn(&view, 0, view.count, dt, system->user);
+            continue;
+        }
+
+        dispatch->system = system;
+        dispatch->view   = view;
+        dispatch->dt     = dt;
+        dispatch->chunks = chunks;
+        dispatch->next.store(0, std::memory_order_relaxed);
+        dispatch->done.store(0, std::memory_order_relaxed);
+        dispatch->refs.store(1 + jobs, std::memory_order_release);
+
+        for(int j = 0; j < jobs; ++j) {
+            if(!SubmitJob(SystemJob, dispatch)) {
+                dispatch->refs.fetch_sub(jobs - j, std::memory_order_release);
+                break;
+            }
+        }
+
+        // NOTE(alicia): main thread takes chunks too and doesn't wait on
+        // jobs stuck in the queue, they find no chunks left when they start.
+        RunChunks(dispatch);
+        while(dispatch->done.load(std::memory_order_acquire) < chunks) {
+            std::this_thread::yield();
+        }
+        dispatch->refs.fetch_sub(1, std::memory_order_release);
+    }
+}
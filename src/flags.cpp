@@ -0,0 +1,221 @@
+/**
+ * @file   src/flags.cpp
+ * @brief  Command-line flags for benchmark and profiling runs.
+ * @author Alicia D. Amarilla (smushyaa@gmail.com)
+ * @date   October 18, 2026
+*/
+#include "raylib.h"
+#include "flags.h"
+#include "flagship.h"
+
+#include <string.h>
+
+// NOTE(alicia): same order as raylib's TraceLogLevel
+static const char *LOG_LEVEL_NAMES[] = {
+    "all",
+    "trace",
+    "debug",
+    "info",
+    "warning",
+    "error",
+    "fatal",
+    "none",
+};
+static_assert(
+    sizeof(LOG_LEVEL_NAMES) / sizeof(LOG_LEVEL_NAMES[0]) == LOG_NONE + 1,
+    "number of log level names does not match raylib log levels!");
+
+static Flags FLAGS = {
+    0,         // frames
+    -1,        // fps_cap
+    false,     // vsync
+    false,     // headless
+    {},        // profile_out
+    0,         // seed
+    false,     // has_seed
+    {},        // bench_scene
+    LOG_INFO,  // log_level
+    {},        // record
+    {},        // replay
+    0,         // replay_fps
+    false,     // pipeline
+    {},        // log_out
+};
+
+static void DefineFlags(struct FlagshipContext *fls, const char *proc) {
+    flagship_name(fls, "%s", proc);
+    flagship_description(fls, "%s %s", PROJECT_NAME, PROJECT_VERSION);
+
+    flagship_begin_flag(fls, FLAGSHIP_TYPE_INT); {
+        flagship_name(fls, "frames");
+        flagship_description(fls, "exit after given number of frames");
+        flagship_end_flag(fls);
+    }
+
+    flagship_begin_flag(fls, FLAGSHIP_TYPE_INT); {
+        flagship_name(fls, "fps-cap");
+        flagship_description(fls, "target framerate, 0 for uncapped");
+        flagship_note(fls, "overrides framerate in settings.ini");
+        flagship_end_flag(fls);
+    }
+
+    flagship_begin_flag(fls, FLAGSHIP_TYPE_BOOL); {
+        flagship_name(fls, "vsync");
+        flagship_description(fls, "wait for vertical sync");
+        flagship_end_flag(fls);
+    }
+
+    flagship_begin_flag(fls, FLAGSHIP_TYPE_BOOL); {
+        flagship_name(fls, "headless");
+        flagship_description(fls, "run with window hidden");
+        flagship_end_flag(fls);
+    }
+
+    flagship_begin_flag(fls, FLAGSHIP_TYPE_STRING); {
+        flagship_name(fls, "profile-out");
+        flagship_description(fls, "write frame times to given path as csv on exit");
+        flagship_end_flag(fls);
+    }
+
+    flagship_begin_flag(fls, FLAGSHIP_TYPE_INT); {
+        flagship_name(fls, "seed");
+        flagship_description(fls, "seed for random number generator");
+        flagship_end_flag(fls);
+    }
+
+    flagship_begin_flag(fls, FLAGSHIP_TYPE_STRING); {
+        flagship_name(fls, "bench-scene");
+        flagship_description(fls, "name of scene to benchmark");
+        flagship_end_flag(fls);
+    }
+
+    flagship_begin_flag(fls, FLAGSHIP_TYPE_ENUM); {
+        flagship_name(fls, "log-level");
+        flagship_description(fls, "minimum level of logged messages");
+        for(int i = 0; i <= LOG_NONE; ++i) {
+            flagship_enum_variant(fls, "%s", LOG_LEVEL_NAMES[i]);
+        }
+        flagship_default(fls, "%s", LOG_LEVEL_NAMES[LOG_INFO]);
+        flagship_end_flag(fls);
+    }
+
+    flagship_begin_flag(fls, FLAGSHIP_TYPE_STRING); {
+        flagship_name(fls, "record");
+        flagship_description(fls, "record input to given path");
+        flagship_end_flag(fls);
+    }
+
+    flagship_begin_flag(fls, FLAGSHIP_TYPE_STRING); {
+        flagship_name(fls, "replay");
+        flagship_description(fls, "replay input recorded with --record");
+        flagship_note(fls, "seed is taken from the recording");
+        flagship_note(fls, "exits when the recording ends");
+        flagship_end_flag(fls);
+    }
+
+    flagship_begin_flag(fls, FLAGSHIP_TYPE_INT); {
+        flagship_name(fls, "replay-fps");
+        flagship_description(fls, "replay with a fixed frame time of 1/N seconds");
+        flagship_note(fls, "recorded frame times are used when not given");
+        flagship_end_flag(fls);
+    }
+
+    flagship_begin_flag(fls, FLAGSHIP_TYPE_BOOL); {
+        flagship_name(fls, "pipeline");
+        flagship_description(fls, "simulate next frame on its own thread while drawing this one");
+        flagship_note(fls, "ignored on WASM");
+        flagship_end_flag(fls);
+    }
+
+    flagship_begin_flag(fls, FLAGSHIP_TYPE_STRING); {
+        flagship_name(fls, "log-out");
+        flagship_description(fls, "write log to given path instead of stdout, warnings and errors still go to stdout");
+        flagship_note(fls, "ignored on WASM");
+        flagship_end_flag(fls);
+    }
+
+    flagship_begin_flag(fls, FLAGSHIP_TYPE_BOOL); {
+        flagship_name(fls, "help");
+        flagship_name(fls, "h");
+        flagship_description(fls, "print help and exit");
+        flagship_end_flag(fls);
+    }
+}
+
+static void CopyFlagString(char *dst, const char *src) {
+    strncpy(dst, src ? src : "", FLAGS_STRING_MAX - 1);
+    dst[FLAGS_STRING_MAX - 1] = 0;
+}
+
+ParseFlagsResult ParseFlags(int argc, char **argv) {
+    struct FlagshipContext fls;
+    memset(&fls, 0, sizeof(fls));
+    flagship_begin(&fls);
+
+    DefineFlags(&fls, argc ? argv[0] : PROJECT_NAME);
+
+    if(!flagship_parse(&fls, argc, argv, true)) {
+        flagship_end(&fls);
+        return PARSE_FLAGS_ERROR;
+    }
+
+    struct FlagshipResult result;
+    ParseFlagsResult parsed = PARSE_FLAGS_RUN;
+
+    // NOTE(alicia): no modes, flags are searched at the top level
+    if(flagship_search(&fls, NULL, "help", &result)) {
+        flagship_help_print(&fls, NULL, false);
+        parsed = PARSE_FLAGS_EXIT;
+    }
+
+    if(flagship_search(&fls, NULL, "frames", &result)) {
+        FLAGS.frames = result.t_int > 0 ? (int)result.t_int : 0;
+    }
+    if(flagship_search(&fls, NULL, "fps-cap", &result)) {
+        FLAGS.fps_cap = result.t_int > 0 ? (int)result.t_int : 0;
+    }
+    if(flagship_search(&fls, NULL, "vsync", &result)) {
+        FLAGS.vsync = true;
+    }
+    if(flagship_search(&fls, NULL, "headless", &result)) {
+        FLAGS.headless = true;
+    }
+    if(flagship_search(&fls, NULL, "profile-out", &result)) {
+        CopyFlagString(FLAGS.profile_out, result.t_string);
+    }
+    if(flagship_search(&fls, NULL, "seed", &result)) {
+        FLAGS.seed     = (uint64_t)result.t_int;
+        FLAGS.has_seed = true;
+    }
+    if(flagship_search(&fls, NULL, "bench-scene", &result)) {
+        CopyFlagString(FLAGS.bench_scene, result.t_string);
+    }
+    if(flagship_search(&fls, NULL, "log-level", &result)) {
+        FLAGS.log_level = result.t_enum;
+    }
+    if(flagship_search(&fls, NULL, "record", &result)) {
+        CopyFlagString(FLAGS.record, result.t_string);
+    }
+    if(flagship_search(&fls, NULL, "replay", &result)) {
+        CopyFlagString(FLAGS.replay, result.t_string);
+    }
+    if(flagship_search(&fls, NULL, "replay-fps", &result)) {
+        FLAGS.replay_fps = result.t_int > 0 ? (int)result.t_int : 0;
+    }
+    if(flagship_search(&fls, NULL, "pipeline", &result)) {
+        FLAGS.pipeline = true;
+    }
+    if(flagship_search(&fls, NULL, "log-out", &result)) {
+        CopyFlagString(FLAGS.log_out, result.t_string);
+    }
+
+    // NOTE(alicia): strings were copied, flagship can free its results
+    flagship_end(&fls);
+
+    SetTraceLogLevel(FLAGS.log_level);
+
+    return parsed;
+}
+const Flags *GetFlags(void) {
+    return &FLAGS;
+}
@@ -0,0 +1,247 @@
+/**
+ * @file   src/hot_reload.cpp
+ * @brief  Reload assets when their files change.
+ * @author Alicia D. Amarilla (smushyaa@gmail.com)
+ * @date   October 18, 2026
+*/
+#include "raylib.h"
+#include "hot_reload.h"
+#include "assets.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#if defined(HOT_RELOAD) && PLATFORM == PLATFORM_LINUX
+
+#include <sys/inotify.h>
+#include <dirent.h>
+#include <unistd.h>
+#include <errno.h>
+
+#define HOT_RELOAD_WATCH_MAX   256
+#define HOT_RELOAD_CHANGED_MAX 64
+#define HOT_RELOAD_PATH_MAX    256
+
+#define HOT_RELOAD_FILE_EVENTS (IN_CLOSE_WRITE | IN_MOVED_TO)
+#define HOT_RELOAD_DIR_EVENTS  (IN_CREATE | IN_MOVED_TO)
+
+struct Watch {
+    int  wd;
+    char dir[HOT_RELOAD_PATH_MAX];
+};
+
+static struct {
+    int fd;
+    struct Watch watches[HOT_RELOAD_WATCH_MAX];
+    int watch_count;
+
+    // NOTE(alicia): editors can write a file several times per save,
+    // changes are collected for a whole frame and reloaded once.
+    char changed[HOT_RELOAD_CHANGED_MAX][HOT_RELOAD_PATH_MAX];
+    int  changed_count;
+    bool overflow;
+} HOT_RELOAD_STATE = { -1, {}, 0, {}, 0, false };
+
+static void WatchDirectory(const char *dir) {
+    if(HOT_RELOAD_STATE.watch_count == HOT_RELOAD_WATCH_MAX) {
+        TraceLog(LOG_WARNING, "HOT RELOAD: Too many directories, not watching %s", dir);
+        return;
+    }
+    if(strlen(dir) >= HOT_RELOAD_PATH_MAX) {
+        TraceLog(LOG_WARNING, "HOT RELOAD: Path is too long: %s", dir);
+        return;
+    }
+
+    int wd = inotify_add_watch(HOT_RELOAD_STATE.fd, dir,
+        HOT_RELOAD_FILE_EVENTS | HOT_RELOAD_DIR_EVENTS | IN_ONLYDIR);
+    if(wd < 0) {
+        TraceLog(LOG_WARNING, "HOT RELOAD: Failed to watch %s: %s", dir, strerror(errno));
+        return;
+    }
+
+    struct Watch *watch = HOT_RELOAD_STATE.watches + HOT_RELOAD_STATE.watch_count++;
+    watch->wd = wd;
+    strcpy(watch->dir, dir);
+
+    // NOTE(alicia): inotify is not recursive, watch every subdirectory as well
+    DIR *d = opendir(dir);
+    if(!d) {
+        return;
+    }
+    struct dirent *entry;
+    while((entry = readdir(d))) {
+        if(entry->d_type != DT_DIR || strcmp(entry->d_name, ".") == 0 || strcmp(entry->d_name, "..") == 0) {
+            continue;
+        }
+        char path[HOT_RELOAD_PATH_MAX];
+        if(snprintf(path, sizeof(path), "%s/%s", dir, entry->d_name) < (int)sizeof(path)) {
+            WatchDirectory(path);
+        }
+    }
+    closedir(d);
+}
+static struct Watch *FindWatch(int wd) {
+    for(int i = 0; i < HOT_RELOAD_STATE.watch_count; ++i) {
+        if(HOT_RELOAD_STATE.watches[i].wd == wd) {
+            return HOT_RELOAD_STATE.watches + i;
+        }
+    }
+    return NULL;
+}
+static void RemoveWatch(int wd) {
+    struct Watch *watch = FindWatch(wd);
+    if(watch) {
+        *watch = HOT_RELOAD_STATE.watches[--HOT_RELOAD_STATE.watch_count];
+    }
+}
+static void PushChanged(const char *path) {
+    for(int i = 0; i < HOT_RELOAD_STATE.changed_count; ++i) {
+        if(strcmp(HOT_RELOAD_STATE.changed[i], path) == 0) {
+            return;
+        }
+    }
+    if(HOT_RELOAD_STATE.changed_count == HOT_RELOAD_CHANGED_MAX) {
+        HOT_RELOAD_STATE.overflow = true;
+        return;
+    }
+    strcpy(HOT_RELOAD_STATE.changed[HOT_RELOAD_STATE.changed_count++], path);
+}
+
+bool InitHotReload(const char *dir) {
+    HOT_RELOAD_STATE.fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if(HOT_RELOAD_STATE.fd < 0) {
+        TraceLog(LOG_WARNING, "HOT RELOAD: inotify_init1 failed: %s", strerror(errno));
+        return false;
+    }
+
+    WatchDirectory(dir);
+    if(!HOT_RELOAD_STATE.watch_count) {
+        ShutdownHotReload();
+        return false;
+    }
+
+    TraceLog(LOG_INFO, "HOT RELOAD: Watching %d directories in %s", HOT_RELOAD_STATE.watch_count, dir);
+    return true;
+}
+void UpdateHotReload(void) {
+    if(HOT_RELOAD_STATE.fd < 0) {
+        return;
+    }
+
+    alignas(struct inotify_event) char buffer[4096];
+    for(;;) {
+        ssize_t len = read(HOT_RELOAD_STATE.fd, buffer, sizeof(buffer));
+        if(len <= 0) {
+            break;
+        }
+
+        for(ssize_t at = 0; at < len;) {
+            struct inotify_event *event = (struct inotify_event *)(buffer + at);
+            at += sizeof(*event) + event->len;
+
+            if(event->mask & IN_Q_OVERFLOW) {
+                HOT_RELOAD_STATE.overflow = true;
+                continue;
+            }
+            if(event->mask & IN_IGNORED) {
+                RemoveWatch(event->wd);
+                continue;
+            }
+
+            struct Watch *watch = FindWatch(event->wd);
+            if(!watch || !event->len) {
+                continue;
+            }
+
+            char path[HOT_RELOAD_PATH_MAX];
+            if(snprintf(path, sizeof(path), "%s/%s", watch->dir, event->name) >= (int)sizeof(path)) {
+                continue;
+            }
+
+            if(event->mask & IN_ISDIR) {
+                if(event->mask & HOT_RELOAD_DIR_EVENTS) {
+                    WatchDirectory(path);
+                }
+            } else if(event->mask & HOT_RELOAD_FILE_EVENTS) {
+                PushChanged(path);
+            }
+        }
+    }
+
+    if(HOT_RELOAD_STATE.overflow) {
+        // NOTE(alicia): lost track of events, compare modification times instead
+        int count = ReloadModifiedAssets();
+        if(count) {
+            TraceLog(LOG_INFO, "HOT RELOAD: Reloading %d modified assets", count);
+        }
+    } else {
+        for(int i = 0; i < HOT_RELOAD_STATE.changed_count; ++i) {
+            int count = ReloadAssetFile(HOT_RELOAD_STATE.changed[i]);
+            if(count) {
+                TraceLog(LOG_INFO, "HOT RELOAD: %s changed, reloading %d assets",
+                    HOT_RELOAD_STATE.changed[i], count);
+            }
+        }
+    }
+
+    HOT_RELOAD_STATE.changed_count = 0;
+    HOT_RELOAD_STATE.overflow      = false;
+}
+void ShutdownHotReload(void) {
+    if(HOT_RELOAD_STATE.fd >= 0) {
+        // NOTE(alicia): closing the descriptor removes every watch
+        close(HOT_RELOAD_STATE.fd);
+    }
+    HOT_RELOAD_STATE.fd          = -1;
+    HOT_RELOAD_STATE.watch_count = 0;
+}
+
+#elif defined(HOT_RELOAD) && PLATFORM != PLATFORM_WASM
+
+static struct {
+    bool   enabled;
+    double last_poll;
+} HOT_RELOAD_STATE;
+
+bool InitHotReload(const char *dir) {
+    if(!DirectoryExists(dir)) {
+        TraceLog(LOG_WARNING, "HOT RELOAD: %s does not exist", dir);
+        return false;
+    }
+    HOT_RELOAD_STATE.enabled   = true;
+    HOT_RELOAD_STATE.last_poll = GetTime();
+
+    TraceLog(LOG_INFO, "HOT RELOAD: Polling assets every %.1fs", HOT_RELOAD_POLL_SECONDS);
+    return true;
+}
+void UpdateHotReload(void) {
+    if(!HOT_RELOAD_STATE.enabled) {
+        return;
+    }
+    double now = GetTime();
+    if(now - HOT_RELOAD_STATE.last_poll < HOT_RELOAD_POLL_SECONDS) {
+        return;
+    }
+    HOT_RELOAD_STATE.last_poll = now;
+
+    int count = ReloadModifiedAssets();
+    if(count) {
+        TraceLog(LOG_INFO, "HOT RELOAD: Reloading %d modified assets", count);
+    }
+}
+void ShutdownHotReload(void) {
+    HOT_RELOAD_STATE.enabled = false;
+}
+
+#else /* HOT_RELOAD */
+
+// NOTE(alicia): WASM resources are packaged, they can't change while running
+
+bool InitHotReload(const char *dir) {
+    (void)dir;
+    return false;
+}
+void UpdateHotReload(void) {}
+void ShutdownHotReload(void) {}
+
+#endif /* HOT_RELOAD */
@@ -0,0 +1,587 @@
+/**
+ * @file   src/input.cpp
+ * @brief  Input snapshots with deterministic record and replay.
+ * @author Alicia D. Amarilla (smushyaa@gmail.com)
+ * @date   October 18, 2026
+*/
+#include "raylib.h"
+#include "input.h"
+
+#include <stdio.h>
+#include <string.h>
+
+// NOTE(alicia): log layout, every value little-endian:
+//
+// header: u32 magic, u32 version, u64 seed
+// frame:  u8 blocks, f32 dt, then each block in blocks in bit order:
+//     keys:     u16 count, u16 key * count    keys that changed state
+//     mouse:    f32 x, f32 y
+//     wheel:    f32 x, f32 y
+//     buttons:  u8 mouse buttons down
+//     gamepads: u8 changed mask, per changed gamepad:
+//               u8 available, u32 buttons down, f32 axes[INPUT_AXIS_COUNT]
+//     window:   u8 focused | resized << 1, i32 width, i32 height
+//     chars:    u8 count, u32 codepoint * count
+//
+// blocks are only written when they differ from the previous frame,
+// window and chars are also written every frame with an event.
+
+#define INPUT_LOG_MAGIC   0x594c5052 // RPLY
+#define INPUT_LOG_VERSION 1
+
+#define INPUT_MOUSE_BUTTON_COUNT   7
+#define INPUT_GAMEPAD_BUTTON_COUNT 32
+#define INPUT_FRAME_MAX            2048
+
+enum InputBlock {
+    INPUT_BLOCK_KEYS     = (1 << 0),
+    INPUT_BLOCK_MOUSE    = (1 << 1),
+    INPUT_BLOCK_WHEEL    = (1 << 2),
+    INPUT_BLOCK_BUTTONS  = (1 << 3),
+    INPUT_BLOCK_GAMEPADS = (1 << 4),
+    INPUT_BLOCK_WINDOW   = (1 << 5),
+    INPUT_BLOCK_CHARS    = (1 << 6),
+};
+
+struct GamepadState {
+    bool     available;
+    uint32_t buttons;
+    float    axes[INPUT_AXIS_COUNT];
+};
+
+struct InputState {
+    uint64_t keys[INPUT_KEY_COUNT / 64];
+    Vector2  mouse;
+    Vector2  wheel;
+    uint8_t  buttons;
+
+    struct GamepadState gamepads[INPUT_GAMEPAD_COUNT];
+
+    bool focused;
+    bool resized;
+    int  width;
+    int  height;
+
+    int chars[INPUT_CHAR_MAX];
+    int char_count;
+
+    float dt;
+};
+
+struct FrameWriter {
+    uint8_t data[INPUT_FRAME_MAX];
+    size_t  len;
+};
+struct FrameReader {
+    const uint8_t *data;
+    size_t len;
+    size_t at;
+    bool   overflow;
+};
+
+static struct {
+    enum InputMode mode;
+    struct InputState cur;
+    struct InputState prev;
+    int char_read;
+
+    uint64_t frame;
+    double   time;
+
+    // recording
+    FILE *log;
+
+    // replaying
+    unsigned char *data;
+    struct FrameReader reader;
+    bool  finished;
+    float replay_dt;
+} INPUT;
+
+static void Put(struct FrameWriter *w, const void *value, size_t size) {
+    // NOTE(alicia): every target is little-endian, values are copied as-is
+    if(w->len + size <= sizeof(w->data)) {
+        memcpy(w->data + w->len, value, size);
+        w->len += size;
+    }
+}
+static void Put8(struct FrameWriter *w, uint8_t value) {
+    Put(w, &value, sizeof(value));
+}
+static void Put16(struct FrameWriter *w, uint16_t value) {
+    Put(w, &value, sizeof(value));
+}
+static void Put32(struct FrameWriter *w, uint32_t value) {
+    Put(w, &value, sizeof(value));
+}
+static void PutF32(struct FrameWriter *w, float value) {
+    Put(w, &value, sizeof(value));
+}
+
+static void Get(struct FrameReader *r, void *out_value, size_t size) {
+    if(r->at + size > r->len) {
+        r->overflow = true;
+        memset(out_value, 0, size);
+        return;
+    }
+    memcpy(out_value, r->data + r->at, size);
+    r->at += size;
+}
+static uint8_t Get8(struct FrameReader *r) {
+    uint8_t value;
+    Get(r, &value, sizeof(value));
+    return value;
+}
+static uint16_t Get16(struct FrameReader *r) {
+    uint16_t value;
+    Get(r, &value, sizeof(value));
+    return value;
+}
+static uint32_t Get32(struct FrameReader *r) {
+    uint32_t value;
+    Get(r, &value, sizeof(value));
+    return value;
+}
+static float GetF32(struct FrameReader *r) {
+    float value;
+    Get(r, &value, sizeof(value));
+    return value;
+}
+
+static bool KeyBit(const struct InputState *state, int key) {
+    if(key < 0 || key >= INPUT_KEY_COUNT) {
+        return false;
+    }
+    return (state->keys[key / 64] >> (key % 64)) & 1;
+}
+static void ToggleKey(struct InputState *state, int key) {
+    if(key >= 0 && key < INPUT_KEY_COUNT) {
+        state->keys[key / 64] ^= (uint64_t)1 << (key % 64);
+    }
+}
+
+static void PollInput(struct InputState *state) {
+    memset(state, 0, sizeof(*state));
+
+    for(int key = 0; key < INPUT_KEY_COUNT; ++key) {
+        if(IsKeyDown(key)) {
+            ToggleKey(state, key);
+        }
+    }
+    int c;
+    while(state->char_count < INPUT_CHAR_MAX && (c = GetCharPressed())) {
+        state->chars[state->char_count++] = c;
+    }
+
+    state->mouse = GetMousePosition();
+    state->wheel = GetMouseWheelMoveV();
+    for(int button = 0; button < INPUT_MOUSE_BUTTON_COUNT; ++button) {
+        if(IsMouseButtonDown(button)) {
+            state->buttons |= (uint8_t)(1 << button);
+        }
+    }
+
+    for(int i = 0; i < INPUT_GAMEPAD_COUNT; ++i) {
+        struct GamepadState *gamepad = state->gamepads + i;
+        if(!(gamepad->available = IsGamepadAvailable(i))) {
+            continue;
+        }
+        for(int button = 0; button < INPUT_GAMEPAD_BUTTON_COUNT; ++button) {
+            if(IsGamepadButtonDown(i, button)) {
+                gamepad->buttons |= (uint32_t)1 << button;
+            }
+        }
+        for(int axis = 0; axis < INPUT_AXIS_COUNT; ++axis) {
+            gamepad->axes[axis] = GetGamepadAxisMovement(i, axis);
+        }
+    }
+
+    state->focused = IsWindowFocused();
+    state->resized = IsWindowResized();
+    state->width   = GetScreenWidth();
+    state->height  = GetScreenHeight();
+
+    state->dt = GetFrameTime();
+}
+
+static bool Vector2Differs(Vector2 a, Vector2 b) {
+    return a.x != b.x || a.y != b.y;
+}
+static bool GamepadDiffers(const struct GamepadState *a, const struct GamepadState *b) {
+    return a->available != b->available || a->buttons != b->buttons ||
+        memcmp(a->axes, b->axes, sizeof(a->axes)) != 0;
+}
+
+static void WriteFrame(const struct InputState *cur, const struct InputState *prev) {
+    uint8_t blocks = 0;
+    if(memcmp(cur->keys, prev->keys, sizeof(cur->keys)) != 0) {
+        blocks |= INPUT_BLOCK_KEYS;
+    }
+    if(Vector2Differs(cur->mouse, prev->mouse)) {
+        blocks |= INPUT_BLOCK_MOUSE;
+    }
+    if(Vector2Differs(cur->wheel, prev->wheel)) {
+        blocks |= INPUT_BLOCK_WHEEL;
+    }
+    if(cur->buttons != prev->buttons) {
+        blocks |= INPUT_BLOCK_BUTTONS;
+    }
+    uint8_t gamepads = 0;
+    for(int i = 0; i < INPUT_GAMEPAD_COUNT; ++i) {
+        if(GamepadDiffers(cur->gamepads + i, prev->gamepads + i)) {
+            gamepads |= (uint8_t)(1 << i);
+        }
+    }
+    if(gamepads) {
+        blocks |= INPUT_BLOCK_GAMEPADS;
+    }
+    // NOTE(alicia): resized is an event like chars, the reader clears it every frame
+    if(cur->resized || cur->focused != prev->focused ||
+        cur->width != prev->width || cur->height != prev->height
+    ) {
+        blocks |= INPUT_BLOCK_WINDOW;
+    }
+    if(cur->char_count) {
+        blocks |= INPUT_BLOCK_CHARS;
+    }
+
+    struct FrameWriter w;
+    w.len = 0;
+
+    Put8(&w, blocks);
+    PutF32(&w, cur->dt);
+
+    if(blocks & INPUT_BLOCK_KEYS) {
+        uint16_t keys[INPUT_KEY_COUNT];
+        uint16_t count = 0;
+        for(int key = 0; key < INPUT_KEY_COUNT; ++key) {
+            if(KeyBit(cur, key) != KeyBit(prev, key)) {
+                keys[count++] = (uint16_t)key;
+            }
+        }
+        Put16(&w, count);
+        for(uint16_t i = 0; i < count; ++i) {
+            Put16(&w, keys[i]);
+        }
+    }
+    if(blocks & INPUT_BLOCK_MOUSE) {
+        PutF32(&w, cur->mouse.x);
+        PutF32(&w, cur->mouse.y);
+    }
+    if(blocks & INPUT_BLOCK_WHEEL) {
+        PutF32(&w, cur->wheel.x);
+        PutF32(&w, cur->wheel.y);
+    }
+    if(blocks & INPUT_BLOCK_BUTTONS) {
+        Put8(&w, cur->buttons);
+    }
+    if(blocks & INPUT_BLOCK_GAMEPADS) {
+        Put8(&w, gamepads);
+        for(int i = 0; i < INPUT_GAMEPAD_COUNT; ++i) {
+            if(!(gamepads & (1 << i))) {
+                continue;
+            }
+            const struct GamepadState *gamepad = cur->gamepads + i;
+            Put8(&w, gamepad->available);
+            Put32(&w, gamepad->buttons);
+            for(int axis = 0; axis < INPUT_AXIS_COUNT; ++axis) {
+                PutF32(&w, gamepad->axes[axis]);
+            }
+        }
+    }
+    if(blocks & INPUT_BLOCK_WINDOW) {
+        Put8(&w, (uint8_t)(cur->focused | (cur->resized << 1)));
+        Put32(&w, (uint32_t)cur->width);
+        Put32(&w, (uint32_t)cur->height);
+    }
+    if(blocks & INPUT_BLOCK_CHARS) {
+        Put8(&w, (uint8_t)cur->char_count);
+        for(int i = 0; i < cur->char_count; ++i) {
+            Put32(&w, (uint32_t)cur->chars[i]);
+        }
+    }
+
+    if(fwrite(w.data, 1, w.len, INPUT.log) != w.len) {
+        TraceLog(LOG_WARNING, "INPUT: Failed to write frame %llu, stopped recording",
+            (unsigned long long)INPUT.frame);
+        fclose(INPUT.log);
+        INPUT.log  = NULL;
+        INPUT.mode = INPUT_MODE_LIVE;
+    }
+}
+// read next frame on top of previous state, false at end of log
+static bool ReadFrame(struct InputState *state) {
+    struct FrameReader *r = &INPUT.reader;
+    if(r->at >= r->len) {
+        return false;
+    }
+
+    // NOTE(alicia): events only last a frame
+    state->resized    = false;
+    state->char_count = 0;
+
+    uint8_t blocks = Get8(r);
+    state->dt = GetF32(r);
+
+    if(blocks & INPUT_BLOCK_KEYS) {
+        uint16_t count = Get16(r);
+        for(uint16_t i = 0; i < count && !r->overflow; ++i) {
+            ToggleKey(state, Get16(r));
+        }
+    }
+    if(blocks & INPUT_BLOCK_MOUSE) {
+        state->mouse.x = GetF32(r);
+        state->mouse.y = GetF32(r);
+    }
+    if(blocks & INPUT_BLOCK_WHEEL) {
+        state->wheel.x = GetF32(r);
+        state->wheel.y = GetF32(r);
+    }
+    if(blocks & INPUT_BLOCK_BUTTONS) {
+        state->buttons = Get8(r);
+    }
+    if(blocks & INPUT_BLOCK_GAMEPADS) {
+        uint8_t gamepads = Get8(r);
+        for(int i = 0; i < INPUT_GAMEPAD_COUNT; ++i) {
+            if(!(gamepads & (1 << i))) {
+                continue;
+            }
+            struct GamepadState *gamepad = state->gamepads + i;
+            gamepad->available = Get8(r) != 0;
+            gamepad->buttons   = Get32(r);
+            for(int axis = 0; axis < INPUT_AXIS_COUNT; ++axis) {
+                gamepad->axes[axis] = GetF32(r);
+            }
+        }
+    }
+    if(blocks & INPUT_BLOCK_WINDOW) {
+        uint8_t flags  = Get8(r);
+        state->focused = (flags & 1) != 0;
+        state->resized = (flags & 2) != 0;
+        state->width   = (int)Get32(r);
+        state->height  = (int)Get32(r);
+    }
+    if(blocks & INPUT_BLOCK_CHARS) {
+        uint8_t count = Get8(r);
+        for(uint8_t i = 0; i < count && !r->overflow; ++i) {
+            int c = (int)Get32(r);
+            if(state->char_count < INPUT_CHAR_MAX) {
+                state->chars[state->char_count++] = c;
+            }
+        }
+    }
+
+    if(r->overflow) {
+        TraceLog(LOG_WARNING, "INPUT: Replay is truncated at frame %llu",
+            (unsigned long long)INPUT.frame);
+        return false;
+    }
+    return true;
+}
+
+bool InitInput(enum InputMode mode, const char *path, uint64_t seed) {
+    memset(&INPUT, 0, sizeof(INPUT));
+    INPUT.mode = INPUT_MODE_LIVE;
+
+    switch(mode) {
+        case INPUT_MODE_LIVE:
+            break;
+        case INPUT_MODE_RECORD: {
+            INPUT.log = fopen(path, "wb");
+            if(!INPUT.log) {
+                TraceLog(LOG_WARNING, "INPUT: Failed to create %s", path);
+                SetRandomSeed((unsigned int)seed);
+                return false;
+            }
+
+            struct FrameWriter w;
+            w.len = 0;
+            Put32(&w, INPUT_LOG_MAGIC);
+            Put32(&w, INPUT_LOG_VERSION);
+            Put(&w, &seed, sizeof(seed));
+            fwrite(w.data, 1, w.len, INPUT.log);
+
+            TraceLog(LOG_INFO, "INPUT: Recording to %s, seed %llu", path, (unsigned long long)seed);
+        } break;
+        case INPUT_MODE_REPLAY: {
+            int size = 0;
+            INPUT.data = LoadFileData(path, &size);
+            if(!INPUT.data) {
+                TraceLog(LOG_WARNING, "INPUT: Failed to read %s", path);
+                SetRandomSeed((unsigned int)seed);
+                return false;
+            }
+
+            INPUT.reader.data = INPUT.data;
+            INPUT.reader.len  = (size_t)size;
+
+            uint32_t magic   = Get32(&INPUT.reader);
+            uint32_t version = Get32(&INPUT.reader);
+            Get(&INPUT.reader, &seed, sizeof(seed));
+            if(INPUT.reader.overflow || magic != INPUT_LOG_MAGIC || version != INPUT_LOG_VERSION) {
+                TraceLog(LOG_WARNING, "INPUT: %s is not a version %d replay", path, INPUT_LOG_VERSION);
+                UnloadFileData(INPUT.data);
+                INPUT.data = NULL;
+                SetRandomSeed((unsigned int)seed);
+                return false;
+            }
+
+            TraceLog(LOG_INFO, "INPUT: Replaying %s, seed %llu", path, (unsigned long long)seed);
+        } break;
+    }
+
+    INPUT.mode = mode;
+    SetRandomSeed((unsigned int)seed);
+    return true;
+}
+void UpdateInput(void) {
+    INPUT.prev      = INPUT.cur;
+    INPUT.char_read = 0;
+
+    switch(INPUT.mode) {
+        case INPUT_MODE_LIVE:
+            PollInput(&INPUT.cur);
+            break;
+        case INPUT_MODE_RECORD:
+            PollInput(&INPUT.cur);
+            WriteFrame(&INPUT.cur, &INPUT.prev);
+            break;
+        case INPUT_MODE_REPLAY:
+            if(INPUT.finished) {
+                break;
+            }
+            if(!ReadFrame(&INPUT.cur)) {
+                TraceLog(LOG_INFO, "INPUT: Replay finished after %llu frames",
+                    (unsigned long long)INPUT.frame);
+                INPUT.finished = true;
+                INPUT.cur      = INPUT.prev;
+                INPUT.cur.resized    = false;
+                INPUT.cur.char_count = 0;
+            }
+            if(INPUT.replay_dt > 0.0f) {
+                INPUT.cur.dt = INPUT.replay_dt;
+            }
+            break;
+    }
+
+    INPUT.time += INPUT.cur.dt;
+    INPUT.frame++;
+}
+void ShutdownInput(void) {
+    if(INPUT.log) {
+        fclose(INPUT.log);
+        TraceLog(LOG_INFO, "INPUT: Recorded %llu frames", (unsigned long long)INPUT.frame);
+    }
+    if(INPUT.data) {
+        UnloadFileData(INPUT.data);
+    }
+    memset(&INPUT, 0, sizeof(INPUT));
+}
+
+void SetReplayFrameTime(float dt) {
+    INPUT.replay_dt = dt > 0.0f ? dt : 0.0f;
+    if(INPUT.mode == INPUT_MODE_REPLAY && INPUT.replay_dt > 0.0f) {
+        TraceLog(LOG_INFO, "INPUT: Replaying with fixed frame time %.4fs", INPUT.replay_dt);
+    }
+}
+
+enum InputMode GetInputMode(void) {
+    return INPUT.mode;
+}
+bool IsReplayFinished(void) {
+    return INPUT.mode == INPUT_MODE_REPLAY && INPUT.finished;
+}
+uint64_t GetInputFrame(void) {
+    return INPUT.frame;
+}
+
+bool IsInputKeyDown(int key) {
+    return KeyBit(&INPUT.cur, key);
+}
+bool IsInputKeyPressed(int key) {
+    return KeyBit(&INPUT.cur, key) && !KeyBit(&INPUT.prev, key);
+}
+bool IsInputKeyReleased(int key) {
+    return !KeyBit(&INPUT.cur, key) && KeyBit(&INPUT.prev, key);
+}
+int GetInputCharPressed(void) {
+    if(INPUT.char_read >= INPUT.cur.char_count) {
+        return 0;
+    }
+    return INPUT.cur.chars[INPUT.char_read++];
+}
+
+Vector2 GetInputMousePosition(void) {
+    return INPUT.cur.mouse;
+}
+Vector2 GetInputMouseWheelMove(void) {
+    return INPUT.cur.wheel;
+}
+bool IsInputMouseButtonDown(int button) {
+    if(button < 0 || button >= INPUT_MOUSE_BUTTON_COUNT) {
+        return false;
+    }
+    return (INPUT.cur.buttons >> button) & 1;
+}
+bool IsInputMouseButtonPressed(int button) {
+    if(button < 0 || button >= INPUT_MOUSE_BUTTON_COUNT) {
+        return false;
+    }
+    return ((INPUT.cur.buttons & ~INPUT.prev.buttons) >> button) & 1;
+}
+bool IsInputMouseButtonReleased(int button) {
+    if(button < 0 || button >= INPUT_MOUSE_BUTTON_COUNT) {
+        return false;
+    }
+    return ((~INPUT.cur.buttons & INPUT.prev.buttons) >> button) & 1;
+}
+
+bool IsInputGamepadAvailable(int gamepad) {
+    if(gamepad < 0 || gamepad >= INPUT_GAMEPAD_COUNT) {
+        return false;
+    }
+    return INPUT.cur.gamepads[gamepad].available;
+}
+bool IsInputGamepadButtonDown(int gamepad, int button) {
+    if(gamepad < 0 || gamepad >= INPUT_GAMEPAD_COUNT ||
+        button < 0 || button >= INPUT_GAMEPAD_BUTTON_COUNT
+    ) {
+        return false;
+    }
+    return (INPUT.cur.gamepads[gamepad].buttons >> button) & 1;
+}
+bool IsInputGamepadButtonPressed(int gamepad, int button) {
+    if(gamepad < 0 || gamepad >= INPUT_GAMEPAD_COUNT ||
+        button < 0 || button >= INPUT_GAMEPAD_BUTTON_COUNT
+    ) {
+        return false;
+    }
+    uint32_t pressed = INPUT.cur.gamepads[gamepad].buttons & ~INPUT.prev.gamepads[gamepad].buttons;
+    return (pressed >> button) & 1;
+}
+float GetInputGamepadAxisMovement(int gamepad, int axis) {
+    if(gamepad < 0 || gamepad >= INPUT_GAMEPAD_COUNT || axis < 0 || axis >= INPUT_AXIS_COUNT) {
+        return 0.0f;
+    }
+    return INPUT.cur.gamepads[gamepad].axes[axis];
+}
+
+bool IsInputWindowResized(void) {
+    return INPUT.cur.resized;
+}
+bool IsInputWindowFocused(void) {
+    return INPUT.cur.focused;
+}
+int GetInputScreenWidth(void) {
+    return INPUT.cur.width;
+}
+int GetInputScreenHeight(void) {
+    return INPUT.cur.height;
+}
+
+float GetInputFrameTime(void) {
+    return INPUT.cur.dt;
+}
+double GetInputTime(void) {
+    return INPUT.time;
+}
@@ -0,0 +1,145 @@
+/**
+ * @file   src/jobs.cpp
+ * @brief  Worker threads for running jobs off the main thread.
+ * @author Alicia D. Amarilla (smushyaa@gmail.com)
+ * @date   October 18, 2026
+*/
+#include "raylib.h"
+#include "jobs.h"
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+#if PLATFORM == PLATFORM_WASM && !defined(WASM_THREADS)
+    #define JOBS_NO_THREADS
+#endif
+
+#define JOB_WORKER_MAX 32
+
+struct Job {
+    JobFN *fn;
+    void  *params;
+};
+
+static struct {
+    struct Job queue[JOB_QUEUE_CAPACITY];
+    int head;
+    int count;
+
+    std::mutex              lock;
+    std::condition_variable wake;
+    bool stop;
+
+    std::thread workers[JOB_WORKER_MAX];
+    int worker_count;
+} JOBS;
+
+// pop a job, caller must hold JOBS.lock
+static bool PopJob(struct Job *out_job) {
+    if(!JOBS.count) {
+        return false;
+    }
+    *out_job  = JOBS.queue[JOBS.head];
+    JOBS.head = (JOBS.head + 1) % JOB_QUEUE_CAPACITY;
+    JOBS.count--;
+    return true;
+}
+
+static void JobWorker(void) {
+    for(;;) {
+        struct Job job;
+        {
+            std::unique_lock<std::mutex> guard(JOBS.lock);
+            JOBS.wake.wait(guard, [] { return JOBS.stop || JOBS.count; });
+            if(JOBS.stop) {
+                return;
+            }
+            PopJob(&job);
+        }
+        job.fn(job.params);
+    }
+}
+
+void InitJobs(int worker_count) {
+    JOBS.head  = 0;
+    JOBS.count = 0;
+    JOBS.stop  = false;
+
+#if defined(JOBS_NO_THREADS)
+    (void)worker_count;
+    JOBS.worker_count = 0;
+    TraceLog(LOG_INFO, "JOBS: No threads, jobs run on main thread");
+#else
+    if(worker_count <= 0) {
+        worker_count = (int)std::thread::hardware_concurrency() - 1;
+        if(worker_count < 1) {
+            worker_count = 1;
+        }
+    }
+    if(worker_count > JOB_WORKER_MAX) {
+        worker_count = JOB_WORKER_MAX;
+    }
+
+    JOBS.worker_count = worker_count;
+    for(int i = 0; i < worker_count; ++i) {
+        JOBS.workers[i] = std::thread(JobWorker);
+    }
+    TraceLog(LOG_INFO, "JOBS: Started %d workers", worker_count);
+#endif
+}
+void ShutdownJobs(void) {
+    {
+        std::lock_guard<std::mutex> guard(JOBS.lock);
+        JOBS.stop = true;
+    }
+    JOBS.wake.notify_all();
+
+    for(int i = 0; i < JOBS.worker_count; ++i) {
+        JOBS.workers[i].join();
+    }
+    JOBS.worker_count = 0;
+    JOBS.count        = 0;
+}
+
+bool SubmitJob(JobFN *fn, void *params) {
+    {
+        std::lock_guard<std::mutex> guard(JOBS.lock);
+        if(JOBS.count == JOB_QUEUE_CAPACITY) {
+            return false;
+        }
+        int tail = (JOBS.head + JOBS.count) % JOB_QUEUE_CAPACITY;
+        JOBS.queue[tail].fn     = fn;
+        JOBS.queue[tail].params = params;
+        JOBS.count++;
+    }
+    JOBS.wake.notify_one();
+    return true;
+}
+
+int RunPendingJobs(double budget_ms) {
+    double start = GetTime();
+    int    ran   = 0;
+
+    do {
+        struct Job job;
+        {
+            std::lock_guard<std::mutex> guard(JOBS.lock);
+            if(!PopJob(&job)) {
+                break;
+            }
+        }
+        job.fn(job.params);
+        ran++;
+    } while((GetTime() - start) * 1000.0 < budget_ms);
+
+    return ran;
+}
+
+int GetJobWorkerCount(void) {
+    return JOBS.worker_count;
+}
+int GetPendingJobCount(void) {
+    std::lock_guard<std::mutex> guard(JOBS.lock);
+    return JOBS.count;
+}
@@ -0,0 +1,283 @@
+/**
+ * @file   src/log.cpp
+ * @brief  TraceLog output off the frame thread.
+ * @author Alicia D. Amarilla (smushyaa@gmail.com)
+ * @date   October 18, 2026
+*/
+#include "raylib.h"
+#include "log.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <string.h>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+
+#if PLATFORM == PLATFORM_WASM
+    #define LOG_NO_THREADS
+#endif
+
+static_assert(
+    (LOG_RING_CAPACITY & (LOG_RING_CAPACITY - 1)) == 0,
+    "log ring capacity must be a power of two!");
+
+// NOTE(alicia): same prefixes as raylib's own TraceLog
+static const char *LOG_PREFIXES[] = {
+    "",
+    "TRACE: ",
+    "DEBUG: ",
+    "INFO: ",
+    "WARNING: ",
+    "ERROR: ",
+    "FATAL: ",
+    "",
+};
+static_assert(
+    sizeof(LOG_PREFIXES) / sizeof(LOG_PREFIXES[0]) == LOG_NONE + 1,
+    "log prefixes out of date!");
+
+// NOTE(alicia): bounded queue with a sequence number per message,
+// producers claim a message by moving head and publish it by
+// storing its sequence, the writer owns tail.
+struct LogMessage {
+    std::atomic<uint32_t> sequence;
+    int  level;
+    int  length;
+    char text[LOG_MESSAGE_MAX];
+};
+
+static struct {
+    struct LogMessage     ring[LOG_RING_CAPACITY];
+    std::atomic<uint32_t> head;
+    uint32_t              tail;
+
+    FILE *out;
+    bool  owns_out;
+    int   echo_level;
+
+    std::atomic<uint64_t> written;
+    std::atomic<uint64_t> dropped;
+    uint64_t              reported;
+
+    // NOTE(alicia): held while writing, producers never take it
+    std::mutex              lock;
+    std::condition_variable wake;
+    std::thread             thread;
+    std::atomic<bool>       threaded;
+    bool                    stop;
+} LOG;
+
+static int FormatLogMessage(char *out, int level, const char *text, va_list args) {
+    if(level < 0 || level > LOG_NONE) {
+        level = LOG_NONE;
+    }
+    int length = snprintf(out, LOG_MESSAGE_MAX, "%s", LOG_PREFIXES[level]);
+
+    // NOTE(alicia): room for the newline
+    int body = vsnprintf(out + length, LOG_MESSAGE_MAX - length - 1, text, args);
+    if(body > 0) {
+        length += body;
+    }
+    if(length > LOG_MESSAGE_MAX - 2) {
+        length = LOG_MESSAGE_MAX - 2;
+    }
+    out[length++] = '\n';
+    out[length]   = 0;
+    return length;
+}
+
+static void WriteLogMessage(int level, const char *text, int length) {
+    fwrite(text, 1, length, LOG.out);
+    if(LOG.out != stdout && level >= LOG.echo_level) {
+        fwrite(text, 1, length, stdout);
+    }
+}
+
+// write every published message, call with lock held
+static void DrainLog(void) {
+    uint64_t count = 0;
+    for(;;) {
+        struct LogMessage *message = LOG.ring + (LOG.tail & (LOG_RING_CAPACITY - 1));
+        if(message->sequence.load(std::memory_order_acquire) != LOG.tail + 1) {
+            break;
+        }
+        WriteLogMessage(message->level, message->text, message->length);
+        message->sequence.store(LOG.tail + LOG_RING_CAPACITY, std::memory_order_release);
+        LOG.tail++;
+        count++;
+    }
+
+    uint64_t dropped = LOG.dropped.load(std::memory_order_relaxed);
+    bool     noted   = dropped != LOG.reported;
+    if(noted) {
+        char text[LOG_MESSAGE_MAX];
+        int length = snprintf(text, sizeof(text), "%sLOG: Dropped %llu messages, ring was full\n",
+            LOG_PREFIXES[LOG_WARNING], (unsigned long long)(dropped - LOG.reported));
+        WriteLogMessage(LOG_WARNING, text, length);
+        LOG.reported = dropped;
+    }
+
+    if(count || noted) {
+        fflush(LOG.out);
+        if(LOG.out != stdout) {
+            fflush(stdout);
+        }
+    }
+    LOG.written.fetch_add(count, std::memory_order_relaxed);
+}
+
+static void WriteLogNow(int level, const char *text, va_list args) {
+    char buffer[LOG_MESSAGE_MAX];
+    int length = FormatLogMessage(buffer, level, text, args);
+
+    std::lock_guard<std::mutex> guard(LOG.lock);
+    DrainLog();
+    WriteLogMessage(level, buffer, length);
+    fflush(LOG.out);
+    if(LOG.out != stdout) {
+        fflush(stdout);
+    }
+    LOG.written.fetch_add(1, std::memory_order_relaxed);
+}
+
+// stop the writer once, whichever thread gets here first
+static void StopLogThread(void) {
+    if(!LOG.threaded.exchange(false, std::memory_order_acq_rel)) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> guard(LOG.lock);
+        LOG.stop = true;
+    }
+    LOG.wake.notify_one();
+    LOG.thread.join();
+}
+
+static void LogCallback(int level, const char *text, va_list args) {
+    if(level >= LOG_FATAL) {
+        // NOTE(alicia): raylib only exits after a fatal message
+        // when it has no callback, do it here instead.
+        // The writer is joined first, exit would terminate on a joinable thread.
+        StopLogThread();
+        WriteLogNow(level, text, args);
+        exit(EXIT_FAILURE);
+    }
+    if(!LOG.threaded.load(std::memory_order_acquire)) {
+        WriteLogNow(level, text, args);
+        return;
+    }
+
+    uint32_t position = LOG.head.load(std::memory_order_relaxed);
+    struct LogMessage *message;
+    for(;;) {
+        message = LOG.ring + (position & (LOG_RING_CAPACITY - 1));
+        uint32_t sequence = message->sequence.load(std::memory_order_acquire);
+        int32_t  diff     = (int32_t)(sequence - position);
+        if(!diff) {
+            if(LOG.head.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if(diff < 0) {
+            // NOTE(alicia): errors are worth the hitch
+            if(level >= LOG_ERROR) {
+                WriteLogNow(level, text, args);
+            } else {
+                LOG.dropped.fetch_add(1, std::memory_order_relaxed);
+            }
+            return;
+        } else {
+            position = LOG.head.load(std::memory_order_relaxed);
+        }
+    }
+
+    message->level  = level;
+    message->length = FormatLogMessage(message->text, level, text, args);
+    message->sequence.store(position + 1, std::memory_order_release);
+
+    // NOTE(alicia): wake the writer early when a quarter of the ring filled up
+    if(!((position + 1) & (LOG_RING_CAPACITY / 4 - 1))) {
+        LOG.wake.notify_one();
+    }
+}
+
+static void LogThread(void) {
+    std::unique_lock<std::mutex> guard(LOG.lock);
+    for(;;) {
+        LOG.wake.wait_for(guard, std::chrono::milliseconds(LOG_FLUSH_MS), [] { return LOG.stop; });
+        DrainLog();
+        if(LOG.stop) {
+            return;
+        }
+    }
+}
+
+void InitLog(const char *path, int echo_level) {
+    for(uint32_t i = 0; i < LOG_RING_CAPACITY; ++i) {
+        LOG.ring[i].sequence.store(i, std::memory_order_relaxed);
+    }
+    LOG.head.store(0, std::memory_order_relaxed);
+    LOG.tail = 0;
+    LOG.written.store(0, std::memory_order_relaxed);
+    LOG.dropped.store(0, std::memory_order_relaxed);
+    LOG.reported   = 0;
+    LOG.echo_level = echo_level;
+    LOG.stop       = false;
+
+    LOG.out      = stdout;
+    LOG.owns_out = false;
+    const char *failed = NULL;
+    if(path && *path) {
+        FILE *f = fopen(path, "w");
+        if(f) {
+            LOG.out      = f;
+            LOG.owns_out = true;
+        } else {
+            failed = path;
+        }
+    }
+
+#if defined(LOG_NO_THREADS)
+    LOG.threaded.store(false, std::memory_order_release);
+#else
+    LOG.thread = std::thread(LogThread);
+    LOG.threaded.store(true, std::memory_order_release);
+#endif
+
+    SetTraceLogCallback(LogCallback);
+
+    if(failed) {
+        TraceLog(LOG_WARNING, "LOG: Failed to open %s, logging to stdout", failed);
+    } else if(LOG.owns_out) {
+        TraceLog(LOG_INFO, "LOG: Writing to %s", path);
+    }
+}
+void ShutdownLog(void) {
+    StopLogThread();
+
+    SetTraceLogCallback(NULL);
+
+    std::lock_guard<std::mutex> guard(LOG.lock);
+    DrainLog();
+    if(LOG.owns_out) {
+        fclose(LOG.out);
+        LOG.owns_out = false;
+    }
+    LOG.out = stdout;
+}
+
+void FlushLog(void) {
+    std::lock_guard<std::mutex> guard(LOG.lock);
+    if(LOG.out) {
+        DrainLog();
+    }
+}
+LogStats GetLogStats(void) {
+    LogStats stats;
+    stats.written = LOG.written.load(std::memory_order_relaxed);
+    stats.dropped = LOG.dropped.load(std::memory_order_relaxed);
+    return stats;
+}
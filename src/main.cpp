@@ -5,13 +5,59 @@
  * @date   June 27, 2026
 */
 #include "raylib.h"
+#include "asset_groups.h"
+#include "assets.h"
+#include "batch_math.h"
+#include "ecs.h"
+#include "flags.h"
+#include "hot_reload.h"
+#include "input.h"
+#include "jobs.h"
+#include "log.h"
+#include "pipeline.h"
+#include "profile.h"
+#include "render_queue.h"
+#include "scene.h"
+#include "scripts.h"
+#include "settings.h"
+#include "tasks.h"
 #include <stdio.h> // IWYU pragma: keep
+#include <time.h>
 
 #if PLATFORM == PLATFORM_WASM
     #include <emscripten/emscripten.h>
 #endif
 
+static int    FRAME_COUNT = 0;
+static double FRAME_START = 0.0;
+
+void Shutdown(void);
+
+// --frames reached or --replay ran out
+bool FramesDone(void) {
+    int frames = GetFlags()->frames;
+    return (frames && FRAME_COUNT >= frames) || IsReplayFinished();
+}
+
+// game update, on the simulation thread with --pipeline
+void Simulate(float dt, void *user) {
+    (void)user;
+    RunSystems(dt);
+    RunScripts(dt);
+    RunTasks(FRAME_START);
+}
+
 void Update(void) {
+    FRAME_START = GetTime();
+    BeginFrameProfile();
+    UpdateInput();
+    UpdateAssetGroups();
+    UpdateHotReload();
+    UpdateAssets();
+    // NOTE(alicia): before simulate starts, it may run on its own thread
+    UpdateScene(true);
+    BeginPipelineFrame(GetInputFrameTime());
+
     BeginDrawing();
     ClearBackground(BLACK);
 
@@ -28,25 +74,126 @@ void Update(void) {
     DrawText(TextFormat("compiler: %s", PROJECT_COMPILER), x, y, tsz, WHITE);
     y += tsz + gut;
 
+    for(int i = 0; i < GetAssetGroupCount(); ++i) {
+        const char *group = GetAssetGroupName(i);
+        if(!IsAssetGroupReady(group)) {
+            DrawText(TextFormat("loading %s: %.0f%%", group, GetAssetGroupProgress(group) * 100.0f),
+                x, y, tsz, GRAY);
+            y += tsz + gut;
+        }
+    }
+
+    if(GetFlags()->bench_scene[0]) {
+        DrawText(TextFormat("bench: %s", GetFlags()->bench_scene), x, y, tsz, GRAY);
+        y += tsz + gut;
+    }
+
+    FlushRenderQueue();
+
+    EndFrameProfile();
     EndDrawing();
+    EndPipelineFrame();
+
+    FRAME_COUNT++;
+#if PLATFORM == PLATFORM_WASM
+    if(FramesDone()) {
+        emscripten_cancel_main_loop();
+        Shutdown();
+    }
+#endif
+}
+
+void Shutdown(void) {
+    ShutdownPipeline();
+    ShutdownTasks();
+    ShutdownScripts();
+    ShutdownScene();
+    ShutdownFrameProfile();
+    ShutdownRenderQueue();
+    ShutdownInput();
+    ShutdownHotReload();
+    ShutdownEcs();
+    ShutdownAssets();
+    ShutdownJobs();
+    CloseWindow();
+    ShutdownLog();
 }
 
 int main(int argc, char **argv) {
-    (void)argc, (void)argv;
-    InitWindow(WINDOW_WIDTH, WINDOW_HEIGHT,
+    // NOTE(alicia): scripted runs check the exit code for bad flags
+    switch(ParseFlags(argc, argv)) {
+        case PARSE_FLAGS_RUN:
+            break;
+        case PARSE_FLAGS_EXIT:
+            return 0;
+        case PARSE_FLAGS_ERROR:
+            return 1;
+    }
+    const Flags *flags = GetFlags();
+
+#if PLATFORM == PLATFORM_WASM
+    InitLog(NULL, LOG_NONE);
+#else
+    InitLog(flags->log_out, LOG_WARNING);
+#endif
+
+    LoadSettings();
+    const Settings *settings = GetSettings();
+
+    unsigned int config = 0;
+    if(flags->vsync) {
+        config |= FLAG_VSYNC_HINT;
+    }
+    if(flags->headless) {
+        config |= FLAG_WINDOW_HIDDEN;
+    }
+    SetConfigFlags(config);
+
+    InitWindow(settings->window_width, settings->window_height,
         TextFormat("%s | version %s", PROJECT_NAME, PROJECT_VERSION));
 
+    // NOTE(alicia): seeded after InitWindow, it reseeds raylib's generator
+    uint64_t seed = flags->has_seed ? flags->seed : (uint64_t)time(NULL);
+    if(flags->replay[0]) {
+        InitInput(INPUT_MODE_REPLAY, flags->replay, seed);
+        if(flags->replay_fps) {
+            SetReplayFrameTime(1.0f / flags->replay_fps);
+        }
+    } else if(flags->record[0]) {
+        InitInput(INPUT_MODE_RECORD, flags->record, seed);
+    } else {
+        InitInput(INPUT_MODE_LIVE, NULL, seed);
+    }
+
+    InitBatchMath();
+    InitJobs(0);
+    InitEcs(0);
+    InitScripts(0);
+    InitScene(0);
+    InitAssets();
+    SetAssetBudget(settings->asset_budget);
+    InitHotReload("resources");
+    InitAssetGroups();
+    InitRenderQueue();
+    InitPipeline(Simulate, NULL, flags->pipeline);
+    InitFrameProfile(flags->profile_out);
+
 #if PLATFORM == PLATFORM_WASM
+    // NOTE(alicia): browser paces frames, --fps-cap doesn't apply
+    InitTasks(settings->task_budget, settings->framerate);
     emscripten_set_main_loop(Update, 0, 1);
 #else
-    SetTargetFPS(FRAMERATE);
+    int framerate = flags->fps_cap >= 0 ? flags->fps_cap : settings->framerate;
+    InitTasks(settings->task_budget, framerate);
+    SetTargetFPS(framerate);
 
-    while(!WindowShouldClose()) {
+    while(!WindowShouldClose() && !FramesDone()) {
         Update();
     }
+
+    Shutdown();
 #endif
 
-    CloseWindow();
     return 0;
 }
 
@@ -0,0 +1,123 @@
+/**
+ * @file   src/pipeline.cpp
+ * @brief  Simulating the next frame while drawing the current one.
+ * @author Alicia D. Amarilla (smushyaa@gmail.com)
+ * @date   October 18, 2026
+*/
+#include "raylib.h"
+#include "pipeline.h"
+#include "render_queue.h"
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+#if PLATFORM == PLATFORM_WASM
+    #define PIPELINE_NO_THREADS
+#endif
+
+static struct {
+    SimulateFN *simulate;
+    void       *user;
+    bool        threaded;
+
+    std::thread             thread;
+    std::mutex              lock;
+    std::condition_variable wake;
+    std::condition_variable done;
+
+    // NOTE(alicia): frames started and finished, guarded by lock
+    uint64_t started;
+    uint64_t finished;
+    float    dt;
+    bool     stop;
+} PIPELINE;
+
+static void SimulateFrame(float dt) {
+    if(PIPELINE.simulate) {
+        PIPELINE.simulate(dt, PIPELINE.user);
+    }
+    SubmitRenderQueue();
+}
+
+static void PipelineThread(void) {
+    uint64_t frame = 0;
+    for(;;) {
+        float dt;
+        {
+            std::unique_lock<std::mutex> guard(PIPELINE.lock);
+            PIPELINE.wake.wait(guard, [frame] { return PIPELINE.stop || PIPELINE.started > frame; });
+            if(PIPELINE.stop) {
+                return;
+            }
+            frame = PIPELINE.started;
+            dt    = PIPELINE.dt;
+        }
+
+        SimulateFrame(dt);
+
+        {
+            std::lock_guard<std::mutex> guard(PIPELINE.lock);
+            PIPELINE.finished = frame;
+        }
+        PIPELINE.done.notify_one();
+    }
+}
+
+void InitPipeline(SimulateFN *simulate, void *user, bool threaded) {
+    PIPELINE.simulate = simulate;
+    PIPELINE.user     = user;
+    PIPELINE.started  = 0;
+    PIPELINE.finished = 0;
+    PIPELINE.stop     = false;
+
+#if defined(PIPELINE_NO_THREADS)
+    threaded = false;
+#endif
+    PIPELINE.threaded = threaded;
+
+    if(threaded) {
+        PIPELINE.thread = std::thread(PipelineThread);
+        TraceLog(LOG_INFO, "PIPELINE: Simulating on its own thread, draws are a frame behind");
+    }
+}
+void ShutdownPipeline(void) {
+    if(!PIPELINE.threaded) {
+        return;
+    }
+
+    EndPipelineFrame();
+    {
+        std::lock_guard<std::mutex> guard(PIPELINE.lock);
+        PIPELINE.stop = true;
+    }
+    PIPELINE.wake.notify_one();
+    PIPELINE.thread.join();
+    PIPELINE.threaded = false;
+}
+
+void BeginPipelineFrame(float dt) {
+    if(!PIPELINE.threaded) {
+        SimulateFrame(dt);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> guard(PIPELINE.lock);
+        PIPELINE.dt = dt;
+        PIPELINE.started++;
+    }
+    PIPELINE.wake.notify_one();
+}
+void EndPipelineFrame(void) {
+    if(!PIPELINE.threaded) {
+        return;
+    }
+
+    std::unique_lock<std::mutex> guard(PIPELINE.lock);
+    PIPELINE.done.wait(guard, [] { return PIPELINE.finished == PIPELINE.started; });
+}
+
+bool IsPipelineThreaded(void) {
+    return PIPELINE.threaded;
+}
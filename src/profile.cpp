@@ -0,0 +1,130 @@
+/**
+ * @file   src/profile.cpp
+ * @brief  Per-frame timing for --profile-out.
+ * @author Alicia D. Amarilla (smushyaa@gmail.com)
+ * @date   October 18, 2026
+*/
+#include "raylib.h"
+#include "profile.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define PROFILE_PATH_MAX 256
+
+struct FrameTime {
+    float frame_ms;
+    float work_ms;
+};
+
+static struct {
+    bool enabled;
+    char path[PROFILE_PATH_MAX];
+
+    struct FrameTime *frames;
+    size_t len;
+    size_t cap;
+
+    double begin;
+} PROFILE;
+
+static int FloatCmp(const void *a, const void *b) {
+    float fa = *(const float *)a;
+    float fb = *(const float *)b;
+    return (fa > fb) - (fa < fb);
+}
+// sorts values
+static void LogSummary(const char *name, float *values, size_t count) {
+    qsort(values, count, sizeof(values[0]), FloatCmp);
+
+    double total = 0.0;
+    for(size_t i = 0; i < count; ++i) {
+        total += values[i];
+    }
+
+    TraceLog(LOG_INFO, "PROFILE: %s ms avg %.3f p50 %.3f p99 %.3f max %.3f",
+        name, total / count,
+        values[count / 2], values[(count * 99) / 100], values[count - 1]);
+}
+
+void InitFrameProfile(const char *path) {
+    if(!path || !*path) {
+        return;
+    }
+    memset(&PROFILE, 0, sizeof(PROFILE));
+    strncpy(PROFILE.path, path, sizeof(PROFILE.path) - 1);
+    PROFILE.enabled = true;
+}
+void BeginFrameProfile(void) {
+    if(!PROFILE.enabled) {
+        return;
+    }
+
+    double now = GetTime();
+    // NOTE(alicia): first frame has no previous frame to measure against
+    if(PROFILE.begin != 0.0 && PROFILE.len) {
+        PROFILE.frames[PROFILE.len - 1].frame_ms = (float)((now - PROFILE.begin) * 1000.0);
+    }
+    PROFILE.begin = now;
+
+    if(PROFILE.len == PROFILE.cap) {
+        size_t cap = PROFILE.cap ? PROFILE.cap * 2 : 1024;
+        struct FrameTime *frames =
+            (struct FrameTime *)realloc(PROFILE.frames, cap * sizeof(frames[0]));
+        if(!frames) {
+            TraceLog(LOG_WARNING, "PROFILE: Out of memory, stopped recording");
+            PROFILE.enabled = false;
+            return;
+        }
+        PROFILE.frames = frames;
+        PROFILE.cap    = cap;
+    }
+    PROFILE.frames[PROFILE.len].frame_ms = 0.0f;
+    PROFILE.frames[PROFILE.len].work_ms  = 0.0f;
+    PROFILE.len++;
+}
+void EndFrameProfile(void) {
+    if(!PROFILE.enabled || !PROFILE.len) {
+        return;
+    }
+    PROFILE.frames[PROFILE.len - 1].work_ms = (float)((GetTime() - PROFILE.begin) * 1000.0);
+}
+void ShutdownFrameProfile(void) {
+    if(!PROFILE.path[0]) {
+        return;
+    }
+
+    // NOTE(alicia): last frame never finished, drop it
+    size_t count = PROFILE.len ? PROFILE.len - 1 : 0;
+
+    FILE *f = fopen(PROFILE.path, "w");
+    if(f) {
+        fprintf(f, "frame,frame_ms,work_ms\n");
+        for(size_t i = 0; i < count; ++i) {
+            fprintf(f, "%zu,%.4f,%.4f\n", i, PROFILE.frames[i].frame_ms, PROFILE.frames[i].work_ms);
+        }
+        fclose(f);
+        TraceLog(LOG_INFO, "PROFILE: Wrote %zu frames to %s", count, PROFILE.path);
+    } else {
+        TraceLog(LOG_WARNING, "PROFILE: Failed to open %s", PROFILE.path);
+    }
+
+    if(count) {
+        float *values = (float *)malloc(count * sizeof(float));
+        if(values) {
+            for(size_t i = 0; i < count; ++i) {
+                values[i] = PROFILE.frames[i].frame_ms;
+            }
+            LogSummary("frame", values, count);
+            for(size_t i = 0; i < count; ++i) {
+                values[i] = PROFILE.frames[i].work_ms;
+            }
+            LogSummary("work ", values, count);
+            free(values);
+        }
+    }
+
+    free(PROFILE.frames);
+    memset(&PROFILE, 0, sizeof(PROFILE));
+}
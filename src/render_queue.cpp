@@ -0,0 +1,476 @@
+/**
+ * @file   src/render_queue.cpp
+ * @brief  Sorted 2D draw commands.
+ * @author Alicia D. Amarilla (smushyaa@gmail.com)
+ * @date   October 18, 2026
+*/
+#include "raylib.h"
+#include "rlgl.h"
+#include "render_queue.h"
+
+#include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <atomic>
+
+// NOTE(alicia): sort key, most significant first:
+// layer 8 bits | shader 12 bits | texture 16 bits | depth 16 bits | unused 12 bits
+#define RENDER_KEY_LAYER_SHIFT   56
+#define RENDER_KEY_SHADER_SHIFT  44
+#define RENDER_KEY_TEXTURE_SHIFT 28
+#define RENDER_KEY_DEPTH_SHIFT   12
+
+// set on RENDER_QUEUE.ready when it holds a list the reader hasn't taken
+#define RENDER_LIST_NEW 4
+
+enum RenderCommandType {
+    RENDER_COMMAND_QUAD,
+    RENDER_COMMAND_TEXT,
+};
+
+struct RenderCommand {
+    enum RenderCommandType type;
+    Shader    shader;
+    Texture2D texture;
+    Color     tint;
+    union {
+        struct {
+            Rectangle source;
+            Rectangle dest;
+            Vector2   origin;
+            float     rotation;
+        } quad;
+        struct {
+            Font    font;
+            size_t  text; // offset into RenderList.text
+            Vector2 position;
+            float   font_size;
+            float   spacing;
+        } text;
+    };
+};
+
+struct SortItem {
+    uint64_t key;
+    uint32_t index;
+};
+
+struct RenderList {
+    struct RenderCommand *commands;
+    struct SortItem      *items;
+    struct SortItem      *scratch;
+    int count;
+    int cap;
+    int culled;
+
+    char  *text;
+    size_t text_len;
+    size_t text_cap;
+};
+
+// NOTE(alicia): triple buffer, the recording thread owns lists[write],
+// the drawing thread owns lists[read] and the third is handed between them
+// through ready without locking.
+static struct {
+    struct RenderList lists[3];
+    int write;
+    int read;
+    std::atomic<int> ready;
+
+    // recording thread
+    Shader    shader;
+    bool      has_shader;
+    Rectangle view;
+    bool      has_view;
+
+    // drawing thread
+    RenderQueueStats stats;
+} RENDER_QUEUE;
+
+// map float to 16 bits that sort in the same order
+static uint16_t DepthBits(float depth) {
+    uint32_t bits;
+    memcpy(&bits, &depth, sizeof(bits));
+    bits ^= (bits >> 31) ? 0xffffffffu : 0x80000000u;
+    return (uint16_t)(bits >> 16);
+}
+
+static uint64_t MakeKey(int layer, unsigned int shader, unsigned int texture, float depth) {
+    if(layer < 0) {
+        layer = 0;
+    } else if(layer >= RENDER_LAYER_COUNT) {
+        layer = RENDER_LAYER_COUNT - 1;
+    }
+    // NOTE(alicia): ids are truncated, collisions only cost a batch break
+    return
+        ((uint64_t)layer                   << RENDER_KEY_LAYER_SHIFT)   |
+        ((uint64_t)(shader  & 0xfff)       << RENDER_KEY_SHADER_SHIFT)  |
+        ((uint64_t)(texture & 0xffff)      << RENDER_KEY_TEXTURE_SHIFT) |
+        ((uint64_t)DepthBits(depth)        << RENDER_KEY_DEPTH_SHIFT);
+}
+
+static struct RenderCommand *PushCommand(int layer, unsigned int texture, float depth) {
+    struct RenderList *list = RENDER_QUEUE.lists + RENDER_QUEUE.write;
+    if(list->count == list->cap) {
+        int cap = list->cap ? list->cap * 2 : 1024;
+        struct RenderCommand *commands = (struct RenderCommand *)realloc(
+            list->commands, cap * sizeof(commands[0]));
+        if(!commands) {
+            return NULL;
+        }
+        list->commands = commands;
+
+        struct SortItem *items = (struct SortItem *)realloc(
+            list->items, cap * sizeof(items[0]));
+        if(!items) {
+            return NULL;
+        }
+        list->items = items;
+
+        struct SortItem *scratch = (struct SortItem *)realloc(
+            list->scratch, cap * sizeof(scratch[0]));
+        if(!scratch) {
+            return NULL;
+        }
+        list->scratch = scratch;
+        list->cap     = cap;
+    }
+
+    int index = list->count++;
+    struct RenderCommand *command = list->commands + index;
+    if(RENDER_QUEUE.has_shader) {
+        command->shader = RENDER_QUEUE.shader;
+    } else {
+        command->shader.id   = rlGetShaderIdDefault();
+        command->shader.locs = rlGetShaderLocsDefault();
+    }
+
+    unsigned int shader = RENDER_QUEUE.has_shader ? RENDER_QUEUE.shader.id : 0;
+    list->items[index].key   = MakeKey(layer, shader, texture, depth);
+    list->items[index].index = (uint32_t)index;
+    return command;
+}
+
+// conservative bounds of a quad drawn like DrawTexturePro
+static Rectangle QuadBounds(Rectangle dest, Vector2 origin, float rotation) {
+    float w = fabsf(dest.width);
+    float h = fabsf(dest.height);
+    if(rotation == 0.0f) {
+        return { dest.x - origin.x, dest.y - origin.y, w, h };
+    }
+    // NOTE(alicia): circle around the pivot reaching the farthest corner
+    float dx = fmaxf(fabsf(origin.x), fabsf(w - origin.x));
+    float dy = fmaxf(fabsf(origin.y), fabsf(h - origin.y));
+    float r  = sqrtf(dx * dx + dy * dy);
+    return { dest.x - r, dest.y - r, r * 2.0f, r * 2.0f };
+}
+
+// least significant byte first, bytes every key shares are skipped
+static struct SortItem *RadixSort(struct SortItem *items, struct SortItem *scratch, int count) {
+    static uint32_t histogram[8][256];
+    memset(histogram, 0, sizeof(histogram));
+
+    for(int i = 0; i < count; ++i) {
+        uint64_t key = items[i].key;
+        for(int pass = 0; pass < 8; ++pass) {
+            histogram[pass][(key >> (pass * 8)) & 0xff]++;
+        }
+    }
+
+    for(int pass = 0; pass < 8; ++pass) {
+        uint32_t *counts = histogram[pass];
+        int shift = pass * 8;
+        if(counts[(items[0].key >> shift) & 0xff] == (uint32_t)count) {
+            continue;
+        }
+
+        uint32_t offset = 0;
+        for(int b = 0; b < 256; ++b) {
+            uint32_t n = counts[b];
+            counts[b]  = offset;
+            offset    += n;
+        }
+        for(int i = 0; i < count; ++i) {
+            scratch[counts[(items[i].key >> shift) & 0xff]++] = items[i];
+        }
+
+        struct SortItem *swap = items;
+        items   = scratch;
+        scratch = swap;
+    }
+    return items;
+}
+
+// same vertices as DrawTexturePro
+static void EmitQuad(const struct RenderCommand *command) {
+    Rectangle source = command->quad.source;
+    Rectangle dest   = command->quad.dest;
+    Vector2   origin = command->quad.origin;
+    float width  = (float)command->texture.width;
+    float height = (float)command->texture.height;
+
+    bool flip_x = false;
+    if(source.width < 0) {
+        flip_x = true;
+        source.width *= -1;
+    }
+    if(source.height < 0) {
+        source.y -= source.height;
+    }
+    if(dest.width < 0) {
+        dest.width *= -1;
+    }
+    if(dest.height < 0) {
+        dest.height *= -1;
+    }
+
+    Vector2 tl, tr, bl, br;
+    if(command->quad.rotation == 0.0f) {
+        float x = dest.x - origin.x;
+        float y = dest.y - origin.y;
+        tl = { x, y };
+        tr = { x + dest.width, y };
+        bl = { x, y + dest.height };
+        br = { x + dest.width, y + dest.height };
+    } else {
+        float s  = sinf(command->quad.rotation * DEG2RAD);
+        float c  = cosf(command->quad.rotation * DEG2RAD);
+        float x  = dest.x;
+        float y  = dest.y;
+        float dx = -origin.x;
+        float dy = -origin.y;
+
+        tl = { x + dx * c - dy * s, y + dx * s + dy * c };
+        tr = { x + (dx + dest.width) * c - dy * s, y + (dx + dest.width) * s + dy * c };
+        bl = { x + dx * c - (dy + dest.height) * s, y + dx * s + (dy + dest.height) * c };
+        br = {
+            x + (dx + dest.width) * c - (dy + dest.height) * s,
+            y + (dx + dest.width) * s + (dy + dest.height) * c };
+    }
+
+    float u0 = (flip_x ? source.x + source.width : source.x) / width;
+    float u1 = (flip_x ? source.x : source.x + source.width) / width;
+    float v0 = source.y / height;
+    float v1 = (source.y + source.height) / height;
+
+    // NOTE(alicia): flushes and restores texture when rlgl's batch is full
+    rlCheckRenderBatchLimit(4);
+
+    Color tint = command->tint;
+    rlColor4ub(tint.r, tint.g, tint.b, tint.a);
+    rlNormal3f(0.0f, 0.0f, 1.0f);
+
+    rlTexCoord2f(u0, v0);
+    rlVertex2f(tl.x, tl.y);
+    rlTexCoord2f(u0, v1);
+    rlVertex2f(bl.x, bl.y);
+    rlTexCoord2f(u1, v1);
+    rlVertex2f(br.x, br.y);
+    rlTexCoord2f(u1, v0);
+    rlVertex2f(tr.x, tr.y);
+}
+
+void InitRenderQueue(void) {
+    memset(RENDER_QUEUE.lists, 0, sizeof(RENDER_QUEUE.lists));
+    RENDER_QUEUE.write = 0;
+    RENDER_QUEUE.read  = 1;
+    RENDER_QUEUE.ready.store(2, std::memory_order_relaxed);
+    RENDER_QUEUE.has_shader = false;
+    RENDER_QUEUE.has_view   = false;
+    memset(&RENDER_QUEUE.stats, 0, sizeof(RENDER_QUEUE.stats));
+}
+void ShutdownRenderQueue(void) {
+    for(int i = 0; i < 3; ++i) {
+        struct RenderList *list = RENDER_QUEUE.lists + i;
+        free(list->commands);
+        free(list->items);
+        free(list->scratch);
+        free(list->text);
+    }
+    InitRenderQueue();
+}
+
+void BeginQueueShader(Shader shader) {
+    RENDER_QUEUE.shader     = shader;
+    RENDER_QUEUE.has_shader = true;
+}
+void EndQueueShader(void) {
+    RENDER_QUEUE.has_shader = false;
+}
+
+void SetRenderQueueView(Rectangle view) {
+    RENDER_QUEUE.view     = view;
+    RENDER_QUEUE.has_view = true;
+}
+void ClearRenderQueueView(void) {
+    RENDER_QUEUE.has_view = false;
+}
+
+void QueueTexture(
+    Texture2D texture, Rectangle source, Rectangle dest,
+    Vector2 origin, float rotation, Color tint, int layer, float depth
+) {
+    if(!texture.id) {
+        return;
+    }
+    if(RENDER_QUEUE.has_view) {
+        Rectangle view   = RENDER_QUEUE.view;
+        Rectangle bounds = QuadBounds(dest, origin, rotation);
+        if(bounds.x > view.x + view.width  || bounds.x + bounds.width  < view.x ||
+           bounds.y > view.y + view.height || bounds.y + bounds.height < view.y
+        ) {
+            RENDER_QUEUE.lists[RENDER_QUEUE.write].culled++;
+            return;
+        }
+    }
+    struct RenderCommand *command = PushCommand(layer, texture.id, depth);
+    if(!command) {
+        TraceLog(LOG_WARNING, "RENDER QUEUE: Out of memory, dropped command");
+        return;
+    }
+    command->type     = RENDER_COMMAND_QUAD;
+    command->texture  = texture;
+    command->tint     = tint;
+    command->quad.source   = source;
+    command->quad.dest     = dest;
+    command->quad.origin   = origin;
+    command->quad.rotation = rotation;
+}
+void QueueRectangle(
+    Rectangle rec, Vector2 origin, float rotation, Color color, int layer, float depth
+) {
+    // NOTE(alicia): raylib draws shapes from a white texture,
+    // rectangles batch with sprites using the same one
+    QueueTexture(
+        GetShapesTexture(), GetShapesTextureRectangle(),
+        rec, origin, rotation, color, layer, depth);
+}
+void QueueText(
+    Font font, const char *text, Vector2 position,
+    float font_size, float spacing, Color tint, int layer, float depth
+) {
+    struct RenderList *list = RENDER_QUEUE.lists + RENDER_QUEUE.write;
+
+    size_t len = strlen(text) + 1;
+    if(list->text_len + len > list->text_cap) {
+        size_t cap = list->text_cap ? list->text_cap * 2 : 4096;
+        while(cap < list->text_len + len) {
+            cap *= 2;
+        }
+        char *buffer = (char *)realloc(list->text, cap);
+        if(!buffer) {
+            TraceLog(LOG_WARNING, "RENDER QUEUE: Out of memory, dropped command");
+            return;
+        }
+        list->text     = buffer;
+        list->text_cap = cap;
+    }
+
+    struct RenderCommand *command = PushCommand(layer, font.texture.id, depth);
+    if(!command) {
+        TraceLog(LOG_WARNING, "RENDER QUEUE: Out of memory, dropped command");
+        return;
+    }
+    command->type    = RENDER_COMMAND_TEXT;
+    command->texture = font.texture;
+    command->tint    = tint;
+    command->text.font      = font;
+    command->text.text      = list->text_len;
+    command->text.position  = position;
+    command->text.font_size = font_size;
+    command->text.spacing   = spacing;
+
+    memcpy(list->text + list->text_len, text, len);
+    list->text_len += len;
+}
+
+void SubmitRenderQueue(void) {
+    int previous = RENDER_QUEUE.ready.exchange(
+        RENDER_QUEUE.write | RENDER_LIST_NEW, std::memory_order_acq_rel);
+    RENDER_QUEUE.write = previous & ~RENDER_LIST_NEW;
+
+    // NOTE(alicia): either never drawn or already drawn, safe to reuse
+    struct RenderList *list = RENDER_QUEUE.lists + RENDER_QUEUE.write;
+    list->count    = 0;
+    list->culled   = 0;
+    list->text_len = 0;
+}
+void FlushRenderQueue(void) {
+    if(RENDER_QUEUE.ready.load(std::memory_order_acquire) & RENDER_LIST_NEW) {
+        RENDER_QUEUE.read = RENDER_QUEUE.ready.exchange(
+            RENDER_QUEUE.read, std::memory_order_acq_rel) & ~RENDER_LIST_NEW;
+    }
+    struct RenderList *list = RENDER_QUEUE.lists + RENDER_QUEUE.read;
+
+    RENDER_QUEUE.stats.commands = list->count;
+    RENDER_QUEUE.stats.batches  = 0;
+    RENDER_QUEUE.stats.culled   = list->culled;
+    if(!list->count) {
+        return;
+    }
+
+    struct SortItem *items = RadixSort(list->items, list->scratch, list->count);
+
+    unsigned int shader  = rlGetShaderIdDefault();
+    unsigned int texture = 0;
+    bool quads = false;
+
+    for(int i = 0; i < list->count; ++i) {
+        const struct RenderCommand *command = list->commands + items[i].index;
+
+        bool new_shader  = command->shader.id != shader;
+        bool new_texture = command->texture.id != texture;
+        if(new_shader || new_texture) {
+            RENDER_QUEUE.stats.batches++;
+            if(quads) {
+                rlEnd();
+                quads = false;
+            }
+        }
+        if(new_shader) {
+            if(shader != rlGetShaderIdDefault()) {
+                EndShaderMode();
+            }
+            if(command->shader.id != rlGetShaderIdDefault()) {
+                BeginShaderMode(command->shader);
+            }
+            shader = command->shader.id;
+        }
+        texture = command->texture.id;
+
+        switch(command->type) {
+            case RENDER_COMMAND_QUAD:
+                if(!quads) {
+                    rlSetTexture(texture);
+                    rlBegin(RL_QUADS);
+                    quads = true;
+                }
+                EmitQuad(command);
+                break;
+            case RENDER_COMMAND_TEXT:
+                // NOTE(alicia): glyphs are drawn by raylib,
+                // they share the font texture so the batch isn't broken
+                if(quads) {
+                    rlEnd();
+                    quads = false;
+                }
+                DrawTextEx(
+                    command->text.font, list->text + command->text.text,
+                    command->text.position, command->text.font_size,
+                    command->text.spacing, command->tint);
+                break;
+        }
+    }
+
+    if(quads) {
+        rlEnd();
+    }
+    rlSetTexture(0);
+    if(shader != rlGetShaderIdDefault()) {
+        EndShaderMode();
+    }
+}
+RenderQueueStats GetRenderQueueStats(void) {
+    return RENDER_QUEUE.stats;
+}
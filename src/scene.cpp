@@ -0,0 +1,697 @@
+/**
+ * @file   src/scene.cpp
+ * @brief  Hierarchy of transforms.
+ * @author Alicia D. Amarilla (smushyaa@gmail.com)
+ * @date   October 18, 2026
+*/
+#include "raylib.h"
+#include "raymath.h"
+#include "scene.h"
+#include "jobs.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <atomic>
+#include <thread>
+
+// NOTE(alicia): same layout as entity handles,
+// index + 1 in the low bits and generation in the high bits.
+#define SCENE_INDEX_BITS      20
+#define SCENE_INDEX_MASK      ((1u << SCENE_INDEX_BITS) - 1)
+#define SCENE_GENERATION_MASK ((1u << (32 - SCENE_INDEX_BITS)) - 1)
+#define SCENE_NONE            UINT32_MAX
+/// Depths being split across job workers at once.
+#define SCENE_DISPATCH_MAX    4
+
+// NOTE(alicia): same as ECS system dispatches,
+// reused only once every job let go of them.
+struct SceneDispatch {
+    std::atomic<int> refs;
+    std::atomic<int> next;
+    std::atomic<int> done;
+    std::atomic<int> updated;
+    std::atomic<int> cleared;
+    int chunks;
+    int begin;
+    int end;
+};
+
+static struct {
+    int capacity;
+    int count;
+
+    // NOTE(alicia): by slot, stable while the node is alive
+    uint16_t *generations;
+    uint32_t *dense;
+    uint32_t *parents;
+    uint32_t *first_child;
+    uint32_t *next_sibling;
+    uint32_t *prev_sibling;
+    int      *depths;
+    uint32_t *free;
+    int       free_count;
+    // local bounds and culling tree item, -1 for nodes without bounds
+    BoundingBox *bounds;
+    int         *items;
+
+    // NOTE(alicia): by dense index, sorted by depth when sorted is set
+    Matrix   *local;
+    Matrix   *world;
+    int      *parent;
+    uint32_t *slots;
+    uint32_t *stamps;
+    uint8_t  *dirty;
+
+    // first dense index of every depth, levels[max_depth + 1] is count
+    int  *levels;
+    int   max_depth;
+    bool  sorted;
+    void *scratch;
+
+    int      dirty_count;
+    int      dirty_depth;
+    uint32_t pass;
+
+    // NOTE(alicia): tree item ids are tree node indices, item_slots maps
+    // them back to slots and is SCENE_NONE for ids that aren't items
+    SpatialTree *tree;
+    uint32_t    *item_slots;
+    int          item_cap;
+
+    SceneStats stats;
+
+    struct SceneDispatch dispatch[SCENE_DISPATCH_MAX];
+} SCENE;
+
+// slot of live node, -1 if stale or invalid
+static int SceneSlot(SceneNode node) {
+    uint32_t index = node.id & SCENE_INDEX_MASK;
+    if(!index || (int)index > SCENE.capacity) {
+        return -1;
+    }
+    index--;
+    if(SCENE.generations[index] != (node.id >> SCENE_INDEX_BITS)) {
+        return -1;
+    }
+    return (int)index;
+}
+static SceneNode SceneNodeOf(uint32_t slot) {
+    SceneNode node;
+    node.id = ((uint32_t)SCENE.generations[slot] << SCENE_INDEX_BITS) | (slot + 1);
+    return node;
+}
+
+static void MarkNodeDirty(uint32_t slot) {
+    uint32_t index = SCENE.dense[slot];
+    if(!SCENE.dirty[index]) {
+        SCENE.dirty[index] = 1;
+        SCENE.dirty_count++;
+    }
+    if(SCENE.depths[slot] < SCENE.dirty_depth) {
+        SCENE.dirty_depth = SCENE.depths[slot];
+    }
+}
+
+static void LinkNode(uint32_t slot, uint32_t parent) {
+    SCENE.parents[slot]      = parent;
+    SCENE.prev_sibling[slot] = SCENE_NONE;
+    SCENE.next_sibling[slot] = SCENE_NONE;
+    if(parent == SCENE_NONE) {
+        return;
+    }
+    uint32_t first = SCENE.first_child[parent];
+    if(first != SCENE_NONE) {
+        SCENE.prev_sibling[first] = slot;
+    }
+    SCENE.next_sibling[slot]  = first;
+    SCENE.first_child[parent] = slot;
+}
+static void UnlinkNode(uint32_t slot) {
+    uint32_t parent = SCENE.parents[slot];
+    uint32_t prev   = SCENE.prev_sibling[slot];
+    uint32_t next   = SCENE.next_sibling[slot];
+    if(prev != SCENE_NONE) {
+        SCENE.next_sibling[prev] = next;
+    } else if(parent != SCENE_NONE) {
+        SCENE.first_child[parent] = next;
+    }
+    if(next != SCENE_NONE) {
+        SCENE.prev_sibling[next] = prev;
+    }
+    SCENE.parents[slot] = SCENE.prev_sibling[slot] = SCENE.next_sibling[slot] = SCENE_NONE;
+}
+
+// next slot of a preorder walk of root's subtree, SCENE_NONE when done
+static uint32_t NextInSubtree(uint32_t slot, uint32_t root) {
+    if(SCENE.first_child[slot] != SCENE_NONE) {
+        return SCENE.first_child[slot];
+    }
+    while(slot != root) {
+        if(SCENE.next_sibling[slot] != SCENE_NONE) {
+            return SCENE.next_sibling[slot];
+        }
+        slot = SCENE.parents[slot];
+    }
+    return SCENE_NONE;
+}
+
+// world space box around bounds of node
+static BoundingBox NodeWorldBox(uint32_t slot) {
+    BoundingBox box = SCENE.bounds[slot];
+    Matrix m = SCENE.world[SCENE.dense[slot]];
+
+    // NOTE(alicia): transform center, extents grow by the absolute matrix
+    Vector3 c = Vector3Scale(Vector3Add(box.min, box.max), 0.5f);
+    Vector3 e = Vector3Scale(Vector3Subtract(box.max, box.min), 0.5f);
+    Vector3 center = Vector3Transform(c, m);
+    Vector3 extent = {
+        fabsf(m.m0) * e.x + fabsf(m.m4) * e.y + fabsf(m.m8)  * e.z,
+        fabsf(m.m1) * e.x + fabsf(m.m5) * e.y + fabsf(m.m9)  * e.z,
+        fabsf(m.m2) * e.x + fabsf(m.m6) * e.y + fabsf(m.m10) * e.z,
+    };
+
+    BoundingBox result;
+    result.min = Vector3Subtract(center, extent);
+    result.max = Vector3Add(center, extent);
+    return result;
+}
+static void RemoveNodeItem(uint32_t slot) {
+    int item = SCENE.items[slot];
+    if(item < 0) {
+        return;
+    }
+    RemoveTreeItem(SCENE.tree, item);
+    SCENE.item_slots[item] = SCENE_NONE;
+    SCENE.items[slot]      = -1;
+}
+static void InsertNodeItem(uint32_t slot) {
+    int item = InsertTreeItem(SCENE.tree, NodeWorldBox(slot));
+    if(item < 0) {
+        TraceLog(LOG_WARNING, "SCENE: Out of memory for node bounds");
+        return;
+    }
+    if(item >= SCENE.item_cap) {
+        int cap = SCENE.item_cap ? SCENE.item_cap : 256;
+        while(cap <= item) {
+            cap *= 2;
+        }
+        uint32_t *item_slots = (uint32_t *)realloc(SCENE.item_slots, cap * sizeof(uint32_t));
+        if(!item_slots) {
+            RemoveTreeItem(SCENE.tree, item);
+            TraceLog(LOG_WARNING, "SCENE: Out of memory for node bounds");
+            return;
+        }
+        for(int i = SCENE.item_cap; i < cap; ++i) {
+            item_slots[i] = SCENE_NONE;
+        }
+        SCENE.item_slots = item_slots;
+        SCENE.item_cap   = cap;
+    }
+    SCENE.item_slots[item] = slot;
+    SCENE.items[slot]      = item;
+}
+
+static void FreeNodeSlot(uint32_t slot) {
+    RemoveNodeItem(slot);
+
+    uint32_t index = SCENE.dense[slot];
+    if(SCENE.dirty[index]) {
+        SCENE.dirty_count--;
+    }
+
+    uint32_t last = (uint32_t)(SCENE.count - 1);
+    if(index != last) {
+        SCENE.local[index]  = SCENE.local[last];
+        SCENE.world[index]  = SCENE.world[last];
+        SCENE.slots[index]  = SCENE.slots[last];
+        SCENE.stamps[index] = SCENE.stamps[last];
+        SCENE.dirty[index]  = SCENE.dirty[last];
+        SCENE.dense[SCENE.slots[index]] = index;
+    }
+    SCENE.count--;
+
+    uint16_t generation = (uint16_t)((SCENE.generations[slot] + 1) & SCENE_GENERATION_MASK);
+    SCENE.generations[slot] = generation ? generation : 1;
+    SCENE.first_child[slot] = SCENE_NONE;
+    SCENE.free[SCENE.free_count++] = slot;
+    SCENE.sorted = false;
+}
+
+// permute count elements of size bytes so array[i] = old array[order[i]]
+static void PermuteNodes(void *array, size_t size, const uint32_t *order, int count) {
+    uint8_t *src = (uint8_t *)array;
+    uint8_t *dst = (uint8_t *)SCENE.scratch;
+    for(int i = 0; i < count; ++i) {
+        memcpy(dst + i * size, src + order[i] * size, size);
+    }
+    memcpy(src, dst, count * size);
+}
+
+// NOTE(alicia): counting sort, stable so siblings keep their order
+static void SortScene(void) {
+    int max_depth = 0;
+    for(int i = 0; i < SCENE.count; ++i) {
+        int depth = SCENE.depths[SCENE.slots[i]];
+        if(depth > max_depth) {
+            max_depth = depth;
+        }
+    }
+
+    memset(SCENE.levels, 0, (max_depth + 2) * sizeof(int));
+    for(int i = 0; i < SCENE.count; ++i) {
+        SCENE.levels[SCENE.depths[SCENE.slots[i]] + 1]++;
+    }
+    for(int d = 0; d <= max_depth; ++d) {
+        SCENE.levels[d + 1] += SCENE.levels[d];
+    }
+
+    // NOTE(alicia): order lives in parent until the permutes are done
+    uint32_t *order = (uint32_t *)SCENE.parent;
+    for(int i = 0; i < SCENE.count; ++i) {
+        int depth = SCENE.depths[SCENE.slots[i]];
+        order[SCENE.levels[depth]++] = (uint32_t)i;
+    }
+    for(int d = max_depth; d > 0; --d) {
+        SCENE.levels[d] = SCENE.levels[d - 1];
+    }
+    SCENE.levels[0] = 0;
+
+    PermuteNodes(SCENE.local,  sizeof(Matrix),   order, SCENE.count);
+    PermuteNodes(SCENE.world,  sizeof(Matrix),   order, SCENE.count);
+    PermuteNodes(SCENE.slots,  sizeof(uint32_t), order, SCENE.count);
+    PermuteNodes(SCENE.stamps, sizeof(uint32_t), order, SCENE.count);
+    PermuteNodes(SCENE.dirty,  sizeof(uint8_t),  order, SCENE.count);
+
+    for(int i = 0; i < SCENE.count; ++i) {
+        SCENE.dense[SCENE.slots[i]] = (uint32_t)i;
+    }
+    for(int i = 0; i < SCENE.count; ++i) {
+        uint32_t parent = SCENE.parents[SCENE.slots[i]];
+        SCENE.parent[i] = parent == SCENE_NONE ? -1 : (int)SCENE.dense[parent];
+    }
+
+    SCENE.max_depth = max_depth;
+    SCENE.sorted    = true;
+}
+
+// recompute dirty nodes in [begin, end) and children of recomputed nodes,
+// returns nodes recomputed and adds dirty flags cleared to cleared
+static int UpdateNodeRange(int begin, int end, uint32_t pass, int *cleared) {
+    int updated = 0;
+    for(int i = begin; i < end; ++i) {
+        int parent = SCENE.parent[i];
+        if(!SCENE.dirty[i] && (parent < 0 || SCENE.stamps[parent] != pass)) {
+            continue;
+        }
+
+        SCENE.world[i]  = parent < 0 ? SCENE.local[i] : MatrixMultiply(SCENE.local[i], SCENE.world[parent]);
+        SCENE.stamps[i] = pass;
+        if(SCENE.dirty[i]) {
+            SCENE.dirty[i] = 0;
+            (*cleared)++;
+        }
+        updated++;
+    }
+    return updated;
+}
+
+static void RunSceneChunks(struct SceneDispatch *dispatch) {
+    int chunk;
+    while((chunk = dispatch->next.fetch_add(1, std::memory_order_relaxed)) < dispatch->chunks) {
+        int begin = dispatch->begin + chunk * SCENE_CHUNK_SIZE;
+        int end   = begin + SCENE_CHUNK_SIZE;
+        if(end > dispatch->end) {
+            end = dispatch->end;
+        }
+        int cleared = 0;
+        int updated = UpdateNodeRange(begin, end, SCENE.pass, &cleared);
+        dispatch->updated.fetch_add(updated, std::memory_order_relaxed);
+        dispatch->cleared.fetch_add(cleared, std::memory_order_relaxed);
+        dispatch->done.fetch_add(1, std::memory_order_release);
+    }
+}
+static void SceneJob(void *params) {
+    struct SceneDispatch *dispatch = (struct SceneDispatch *)params;
+    RunSceneChunks(dispatch);
+    dispatch->refs.fetch_sub(1, std::memory_order_release);
+}
+
+static struct SceneDispatch *AcquireSceneDispatch(void) {
+    for(int i = 0; i < SCENE_DISPATCH_MAX; ++i) {
+        if(!SCENE.dispatch[i].refs.load(std::memory_order_acquire)) {
+            return SCENE.dispatch + i;
+        }
+    }
+    return NULL;
+}
+
+// update one depth, across job workers if it's large enough
+static int UpdateSceneDepth(int begin, int end, bool parallel, int *cleared) {
+    int chunks = (end - begin + SCENE_CHUNK_SIZE - 1) / SCENE_CHUNK_SIZE;
+    int jobs   = chunks - 1;
+    if(jobs > GetJobWorkerCount()) {
+        jobs = GetJobWorkerCount();
+    }
+
+    struct SceneDispatch *dispatch = NULL;
+    if(parallel && jobs > 0) {
+        dispatch = AcquireSceneDispatch();
+    }
+    if(!dispatch) {
+        return UpdateNodeRange(begin, end, SCENE.pass, cleared);
+    }
+
+    dispatch->begin  = begin;
+    dispatch->end    = end;
+    dispatch->chunks = chunks;
+    dispatch->next.store(0, std::memory_order_relaxed);
+    dispatch->done.store(0, std::memory_order_relaxed);
+    dispatch->updated.store(0, std::memory_order_relaxed);
+    dispatch->cleared.store(0, std::memory_order_relaxed);
+    dispatch->refs.store(1 + jobs, std::memory_order_release);
+
+    for(int j = 0; j < jobs; ++j) {
+        if(!SubmitJob(SceneJob, dispatch)) {
+            dispatch->refs.fetch_sub(jobs - j, std::memory_order_release);
+            break;
+        }
+    }
+
+    // NOTE(alicia): the next depth reads this one's world transforms,
+    // so every chunk has to finish first.
+    RunSceneChunks(dispatch);
+    while(dispatch->done.load(std::memory_order_acquire) < chunks) {
+        std::this_thread::yield();
+    }
+    int updated = dispatch->updated.load(std::memory_order_relaxed);
+    *cleared += dispatch->cleared.load(std::memory_order_relaxed);
+    dispatch->refs.fetch_sub(1, std::memory_order_release);
+    return updated;
+}
+
+void InitScene(int node_capacity) {
+    if(node_capacity <= 0) {
+        node_capacity = SCENE_NODE_CAPACITY;
+    }
+    if(node_capacity > (int)SCENE_INDEX_MASK) {
+        node_capacity = (int)SCENE_INDEX_MASK;
+    }
+    size_t n = (size_t)node_capacity;
+
+    SCENE.generations  = (uint16_t *)calloc(n, sizeof(uint16_t));
+    SCENE.dense        = (uint32_t *)calloc(n, sizeof(uint32_t));
+    SCENE.parents      = (uint32_t *)calloc(n, sizeof(uint32_t));
+    SCENE.first_child  = (uint32_t *)calloc(n, sizeof(uint32_t));
+    SCENE.next_sibling = (uint32_t *)calloc(n, sizeof(uint32_t));
+    SCENE.prev_sibling = (uint32_t *)calloc(n, sizeof(uint32_t));
+    SCENE.depths       = (int *)calloc(n, sizeof(int));
+    SCENE.free         = (uint32_t *)calloc(n, sizeof(uint32_t));
+    SCENE.bounds       = (BoundingBox *)calloc(n, sizeof(BoundingBox));
+    SCENE.items        = (int *)calloc(n, sizeof(int));
+    SCENE.local        = (Matrix *)calloc(n, sizeof(Matrix));
+    SCENE.world        = (Matrix *)calloc(n, sizeof(Matrix));
+    SCENE.parent       = (int *)calloc(n, sizeof(int));
+    SCENE.slots        = (uint32_t *)calloc(n, sizeof(uint32_t));
+    SCENE.stamps       = (uint32_t *)calloc(n, sizeof(uint32_t));
+    SCENE.dirty        = (uint8_t *)calloc(n, sizeof(uint8_t));
+    SCENE.levels       = (int *)calloc(n + 1, sizeof(int));
+    SCENE.scratch      = calloc(n, sizeof(Matrix));
+    SCENE.tree         = CreateSpatialTree(SCENE_CULL_MARGIN);
+
+    if(!SCENE.generations || !SCENE.dense || !SCENE.parents || !SCENE.first_child ||
+        !SCENE.next_sibling || !SCENE.prev_sibling || !SCENE.depths || !SCENE.free ||
+        !SCENE.bounds || !SCENE.items ||
+        !SCENE.local || !SCENE.world || !SCENE.parent || !SCENE.slots ||
+        !SCENE.stamps || !SCENE.dirty || !SCENE.levels || !SCENE.scratch || !SCENE.tree
+    ) {
+        TraceLog(LOG_ERROR, "SCENE: Failed to allocate storage for %d nodes", node_capacity);
+        ShutdownScene();
+        return;
+    }
+
+    SCENE.capacity = node_capacity;
+    for(int i = 0; i < node_capacity; ++i) {
+        SCENE.generations[i] = 1;
+        SCENE.first_child[i] = SCENE_NONE;
+        SCENE.items[i]       = -1;
+        // NOTE(alicia): lowest slots first
+        SCENE.free[i] = (uint32_t)(node_capacity - 1 - i);
+    }
+    SCENE.free_count  = node_capacity;
+    SCENE.sorted      = true;
+    SCENE.dirty_depth = INT_MAX;
+}
+void ShutdownScene(void) {
+    free(SCENE.generations);
+    free(SCENE.dense);
+    free(SCENE.parents);
+    free(SCENE.first_child);
+    free(SCENE.next_sibling);
+    free(SCENE.prev_sibling);
+    free(SCENE.depths);
+    free(SCENE.free);
+    free(SCENE.bounds);
+    free(SCENE.items);
+    free(SCENE.item_slots);
+    DestroySpatialTree(SCENE.tree);
+    free(SCENE.local);
+    free(SCENE.world);
+    free(SCENE.parent);
+    free(SCENE.slots);
+    free(SCENE.stamps);
+    free(SCENE.dirty);
+    free(SCENE.levels);
+    free(SCENE.scratch);
+
+    SCENE.generations  = NULL;
+    SCENE.dense        = NULL;
+    SCENE.parents      = NULL;
+    SCENE.first_child  = NULL;
+    SCENE.next_sibling = NULL;
+    SCENE.prev_sibling = NULL;
+    SCENE.depths       = NULL;
+    SCENE.free         = NULL;
+    SCENE.bounds       = NULL;
+    SCENE.items        = NULL;
+    SCENE.item_slots   = NULL;
+    SCENE.item_cap     = 0;
+    SCENE.tree         = NULL;
+    SCENE.local        = NULL;
+    SCENE.world        = NULL;
+    SCENE.parent       = NULL;
+    SCENE.slots        = NULL;
+    SCENE.stamps       = NULL;
+    SCENE.dirty        = NULL;
+    SCENE.levels       = NULL;
+    SCENE.scratch      = NULL;
+    SCENE.capacity     = 0;
+    SCENE.count        = 0;
+    SCENE.free_count   = 0;
+    SCENE.dirty_count  = 0;
+    SCENE.stats        = {};
+}
+
+SceneNode CreateSceneNode(SceneNode parent) {
+    SceneNode node = {};
+    if(!SCENE.free_count) {
+        TraceLog(LOG_WARNING, "SCENE: Failed to create node, %d nodes are alive", SCENE.capacity);
+        return node;
+    }
+    int parent_slot = SceneSlot(parent);
+
+    uint32_t slot  = SCENE.free[--SCENE.free_count];
+    uint32_t index = (uint32_t)SCENE.count++;
+    SCENE.dense[slot]   = index;
+    SCENE.local[index]  = MatrixIdentity();
+    SCENE.world[index]  = MatrixIdentity();
+    SCENE.slots[index]  = slot;
+    SCENE.stamps[index] = 0;
+    SCENE.dirty[index]  = 0;
+
+    SCENE.first_child[slot] = SCENE_NONE;
+    LinkNode(slot, parent_slot < 0 ? SCENE_NONE : (uint32_t)parent_slot);
+    SCENE.depths[slot] = parent_slot < 0 ? 0 : SCENE.depths[parent_slot] + 1;
+
+    SCENE.sorted = false;
+    MarkNodeDirty(slot);
+    return SceneNodeOf(slot);
+}
+void DestroySceneNode(SceneNode node) {
+    int root = SceneSlot(node);
+    if(root < 0) {
+        return;
+    }
+
+    // NOTE(alicia): collect first, freeing while walking would lose the links
+    uint32_t *subtree = (uint32_t *)SCENE.scratch;
+    int count = 0;
+    for(uint32_t slot = (uint32_t)root; slot != SCENE_NONE; slot = NextInSubtree(slot, (uint32_t)root)) {
+        subtree[count++] = slot;
+    }
+
+    UnlinkNode((uint32_t)root);
+    for(int i = 0; i < count; ++i) {
+        FreeNodeSlot(subtree[i]);
+    }
+}
+bool IsSceneNodeAlive(SceneNode node) {
+    return SceneSlot(node) >= 0;
+}
+int GetSceneNodeCount(void) {
+    return SCENE.count;
+}
+
+bool SetSceneNodeParent(SceneNode node, SceneNode parent) {
+    int slot = SceneSlot(node);
+    if(slot < 0) {
+        return false;
+    }
+    int parent_slot = SceneSlot(parent);
+    for(int at = parent_slot; at >= 0; at = SCENE.parents[at] == SCENE_NONE ? -1 : (int)SCENE.parents[at]) {
+        if(at == slot) {
+            return false;
+        }
+    }
+
+    UnlinkNode((uint32_t)slot);
+    LinkNode((uint32_t)slot, parent_slot < 0 ? SCENE_NONE : (uint32_t)parent_slot);
+
+    int depth = parent_slot < 0 ? 0 : SCENE.depths[parent_slot] + 1;
+    int delta = depth - SCENE.depths[slot];
+    if(delta) {
+        for(uint32_t at = (uint32_t)slot; at != SCENE_NONE; at = NextInSubtree(at, (uint32_t)slot)) {
+            SCENE.depths[at] += delta;
+        }
+    }
+
+    SCENE.sorted = false;
+    MarkNodeDirty((uint32_t)slot);
+    return true;
+}
+SceneNode GetSceneNodeParent(SceneNode node) {
+    int slot = SceneSlot(node);
+    if(slot < 0 || SCENE.parents[slot] == SCENE_NONE) {
+        SceneNode result = {};
+        return result;
+    }
+    return SceneNodeOf(SCENE.parents[slot]);
+}
+
+void SetSceneNodeLocal(SceneNode node, Matrix local) {
+    int slot = SceneSlot(node);
+    if(slot < 0) {
+        return;
+    }
+    SCENE.local[SCENE.dense[slot]] = local;
+    MarkNodeDirty((uint32_t)slot);
+}
+void SetSceneNodeTransform(SceneNode node, Transform transform) {
+    Matrix local = MatrixMultiply(
+        MatrixMultiply(
+            MatrixScale(transform.scale.x, transform.scale.y, transform.scale.z),
+            QuaternionToMatrix(transform.rotation)),
+        MatrixTranslate(transform.translation.x, transform.translation.y, transform.translation.z));
+    SetSceneNodeLocal(node, local);
+}
+Matrix GetSceneNodeLocal(SceneNode node) {
+    int slot = SceneSlot(node);
+    if(slot < 0) {
+        return MatrixIdentity();
+    }
+    return SCENE.local[SCENE.dense[slot]];
+}
+Matrix GetSceneNodeWorld(SceneNode node) {
+    int slot = SceneSlot(node);
+    if(slot < 0) {
+        return MatrixIdentity();
+    }
+    return SCENE.world[SCENE.dense[slot]];
+}
+
+void UpdateScene(bool parallel) {
+    if(!SCENE.sorted) {
+        SortScene();
+    }
+
+    SceneStats stats = {};
+    stats.nodes = SCENE.count;
+    stats.depth = SCENE.max_depth;
+
+    if(SCENE.dirty_count) {
+        SCENE.pass++;
+        if(!SCENE.pass) {
+            // NOTE(alicia): wrapped, old stamps could match again
+            memset(SCENE.stamps, 0, SCENE.count * sizeof(uint32_t));
+            SCENE.pass = 1;
+        }
+
+        for(int d = SCENE.dirty_depth; d <= SCENE.max_depth; ++d) {
+            int cleared = 0;
+            int updated = UpdateSceneDepth(SCENE.levels[d], SCENE.levels[d + 1], parallel, &cleared);
+            SCENE.dirty_count -= cleared;
+            stats.updated     += updated;
+
+            // NOTE(alicia): nothing left dirty and nothing changed at this depth,
+            // deeper nodes can't have changed either
+            if(!updated && !SCENE.dirty_count) {
+                break;
+            }
+        }
+
+        // NOTE(alicia): the tree isn't thread safe, items move after every depth is done
+        for(int item = 0; stats.updated && item < SCENE.item_cap; ++item) {
+            uint32_t slot = SCENE.item_slots[item];
+            if(slot == SCENE_NONE || SCENE.stamps[SCENE.dense[slot]] != SCENE.pass) {
+                continue;
+            }
+            stats.moved += MoveTreeItem(SCENE.tree, item, NodeWorldBox(slot));
+        }
+    }
+    SCENE.dirty_depth = INT_MAX;
+    SCENE.stats = stats;
+}
+SceneStats GetSceneStats(void) {
+    return SCENE.stats;
+}
+
+void SetSceneNodeBounds(SceneNode node, BoundingBox bounds) {
+    int slot = SceneSlot(node);
+    if(slot < 0) {
+        return;
+    }
+    SCENE.bounds[slot] = bounds;
+    RemoveNodeItem((uint32_t)slot);
+    InsertNodeItem((uint32_t)slot);
+}
+void ClearSceneNodeBounds(SceneNode node) {
+    int slot = SceneSlot(node);
+    if(slot < 0) {
+        return;
+    }
+    RemoveNodeItem((uint32_t)slot);
+}
+int CullScene(const Frustum *frustum, SceneNode *out_nodes, int max_nodes) {
+    if(!SCENE.tree) {
+        return 0;
+    }
+    // NOTE(alicia): scratch holds capacity matrices, plenty for item ids
+    int *items = (int *)SCENE.scratch;
+    int limit  = max_nodes < SCENE.capacity ? max_nodes : SCENE.capacity;
+    int found  = QueryTreeFrustum(SCENE.tree, frustum, items, limit);
+    for(int i = 0; i < found && i < limit; ++i) {
+        out_nodes[i] = SceneNodeOf(SCENE.item_slots[items[i]]);
+    }
+    return found;
+}
+
+#if defined(SUPPORT_MODULE_RMODELS)
+void DrawSceneModel(SceneNode node, Model model, Color tint) {
+    model.transform = MatrixMultiply(model.transform, GetSceneNodeWorld(node));
+    DrawModel(model, Vector3{ 0.0f, 0.0f, 0.0f }, 1.0f, tint);
+}
+void DrawSceneMesh(SceneNode node, Mesh mesh, Material material) {
+    DrawMesh(mesh, material, GetSceneNodeWorld(node));
+}
+#endif /* SUPPORT_MODULE_RMODELS */
@@ -0,0 +1,356 @@
+/**
+ * @file   src/scripts.cpp
+ * @brief  Gameplay sequences written as coroutines.
+ * @author Alicia D. Amarilla (smushyaa@gmail.com)
+ * @date   October 18, 2026
+*/
+#include "raylib.h"
+#include "scripts.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+// NOTE(alicia): same layout as entity handles,
+// index + 1 in the low bits and generation in the high bits.
+#define SCRIPT_INDEX_BITS      20
+#define SCRIPT_INDEX_MASK      ((1u << SCRIPT_INDEX_BITS) - 1)
+#define SCRIPT_GENERATION_MASK ((1u << (32 - SCRIPT_INDEX_BITS)) - 1)
+
+/// Power of two size classes from SCRIPT_FRAME_MIN to SCRIPT_FRAME_MAX.
+#define SCRIPT_FRAME_CLASSES 6
+/// Bytes carved into blocks when a size class runs out.
+#define SCRIPT_POOL_CHUNK    (64 * 1024)
+
+static_assert(
+    (SCRIPT_FRAME_MIN << (SCRIPT_FRAME_CLASSES - 1)) == SCRIPT_FRAME_MAX,
+    "script frame classes out of date!");
+static_assert(SCRIPT_POOL_CHUNK % SCRIPT_FRAME_MAX == 0, "script pool chunk must fit whole frames!");
+
+struct ScriptBlock {
+    struct ScriptBlock *next;
+};
+// NOTE(alicia): aligned so blocks after the header are too
+struct alignas(16) ScriptChunk {
+    struct ScriptChunk *next;
+};
+
+// NOTE(alicia): kept apart from SCRIPTS, frames can be allocated
+// before InitScripts and freed after ShutdownScripts.
+static struct {
+    struct ScriptBlock *free[SCRIPT_FRAME_CLASSES];
+    struct ScriptChunk *chunks;
+    size_t bytes;
+    bool   warned;
+} SCRIPT_POOL;
+
+struct ScriptState {
+    std::coroutine_handle<ScriptPromise> handle;
+    ScriptWait wait;
+    uint32_t   id;
+};
+
+static struct {
+    // NOTE(alicia): dense, the resume loop only walks this
+    struct ScriptState *states;
+    // slot to index in states
+    uint32_t *dense;
+    uint16_t *generations;
+    uint32_t *free;
+    int free_count;
+    int count;
+    int capacity;
+
+    ScriptStats stats;
+} SCRIPTS;
+
+static int ScriptClass(size_t size) {
+    size_t block = SCRIPT_FRAME_MIN;
+    for(int i = 0; i < SCRIPT_FRAME_CLASSES; ++i, block <<= 1) {
+        if(size <= block) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+void *AllocScriptFrame(size_t size) {
+    int c = ScriptClass(size);
+    if(c < 0) {
+        if(!SCRIPT_POOL.warned) {
+            TraceLog(LOG_WARNING,
+                "SCRIPTS: %zu byte frame is larger than %d, allocating from the heap",
+                size, SCRIPT_FRAME_MAX);
+            SCRIPT_POOL.warned = true;
+        }
+        return malloc(size);
+    }
+
+    if(!SCRIPT_POOL.free[c]) {
+        struct ScriptChunk *chunk =
+            (struct ScriptChunk *)malloc(sizeof(struct ScriptChunk) + SCRIPT_POOL_CHUNK);
+        if(!chunk) {
+            return NULL;
+        }
+        chunk->next        = SCRIPT_POOL.chunks;
+        SCRIPT_POOL.chunks = chunk;
+        SCRIPT_POOL.bytes += SCRIPT_POOL_CHUNK;
+
+        size_t   block = (size_t)SCRIPT_FRAME_MIN << c;
+        uint8_t *bytes = (uint8_t *)(chunk + 1);
+        for(size_t at = 0; at < SCRIPT_POOL_CHUNK; at += block) {
+            struct ScriptBlock *entry = (struct ScriptBlock *)(bytes + at);
+            entry->next         = SCRIPT_POOL.free[c];
+            SCRIPT_POOL.free[c] = entry;
+        }
+    }
+
+    struct ScriptBlock *block = SCRIPT_POOL.free[c];
+    SCRIPT_POOL.free[c] = block->next;
+    return block;
+}
+void FreeScriptFrame(void *frame, size_t size) {
+    if(!frame) {
+        return;
+    }
+    int c = ScriptClass(size);
+    if(c < 0) {
+        free(frame);
+        return;
+    }
+    struct ScriptBlock *block = (struct ScriptBlock *)frame;
+    block->next         = SCRIPT_POOL.free[c];
+    SCRIPT_POOL.free[c] = block;
+}
+
+static struct ScriptState *ScriptStateOf(ScriptHandle script) {
+    uint32_t index = script.id & SCRIPT_INDEX_MASK;
+    if(!index || (int)index > SCRIPTS.capacity) {
+        return NULL;
+    }
+    index--;
+    if(SCRIPTS.generations[index] != (script.id >> SCRIPT_INDEX_BITS)) {
+        return NULL;
+    }
+    return SCRIPTS.states + SCRIPTS.dense[index];
+}
+
+// destroy finished and stopped scripts, keeps the rest in order
+static void CompactScripts(void) {
+    int live = 0;
+    for(int i = 0; i < SCRIPTS.count; ++i) {
+        struct ScriptState *state = SCRIPTS.states + i;
+        uint32_t slot = (state->id & SCRIPT_INDEX_MASK) - 1;
+
+        if(state->wait.kind == SCRIPT_WAIT_DONE) {
+            state->handle.destroy();
+
+            uint16_t generation =
+                (uint16_t)((SCRIPTS.generations[slot] + 1) & SCRIPT_GENERATION_MASK);
+            SCRIPTS.generations[slot] = generation ? generation : 1;
+            SCRIPTS.free[SCRIPTS.free_count++] = slot;
+            continue;
+        }
+
+        if(live != i) {
+            SCRIPTS.states[live] = *state;
+        }
+        SCRIPTS.dense[slot] = (uint32_t)live;
+        live++;
+    }
+    SCRIPTS.count = live;
+}
+
+void InitScripts(int capacity) {
+    if(capacity <= 0) {
+        capacity = SCRIPT_CAPACITY;
+    }
+    if(capacity > (int)SCRIPT_INDEX_MASK) {
+        capacity = (int)SCRIPT_INDEX_MASK;
+    }
+
+    memset(&SCRIPTS, 0, sizeof(SCRIPTS));
+    SCRIPTS.states      = (struct ScriptState *)calloc(capacity, sizeof(struct ScriptState));
+    SCRIPTS.dense       = (uint32_t *)calloc(capacity, sizeof(uint32_t));
+    SCRIPTS.generations = (uint16_t *)calloc(capacity, sizeof(uint16_t));
+    SCRIPTS.free        = (uint32_t *)calloc(capacity, sizeof(uint32_t));
+
+    if(!SCRIPTS.states || !SCRIPTS.dense || !SCRIPTS.generations || !SCRIPTS.free) {
+        TraceLog(LOG_ERROR, "SCRIPTS: Failed to allocate storage for %d scripts", capacity);
+        free(SCRIPTS.states);
+        free(SCRIPTS.dense);
+        free(SCRIPTS.generations);
+        free(SCRIPTS.free);
+        memset(&SCRIPTS, 0, sizeof(SCRIPTS));
+        return;
+    }
+
+    SCRIPTS.capacity = capacity;
+    for(int i = 0; i < capacity; ++i) {
+        SCRIPTS.generations[i] = 1;
+        // NOTE(alicia): lowest slots first
+        SCRIPTS.free[i] = (uint32_t)(capacity - 1 - i);
+    }
+    SCRIPTS.free_count = capacity;
+}
+void ShutdownScripts(void) {
+    for(int i = 0; i < SCRIPTS.count; ++i) {
+        SCRIPTS.states[i].handle.destroy();
+    }
+    free(SCRIPTS.states);
+    free(SCRIPTS.dense);
+    free(SCRIPTS.generations);
+    free(SCRIPTS.free);
+    memset(&SCRIPTS, 0, sizeof(SCRIPTS));
+
+    struct ScriptChunk *chunk = SCRIPT_POOL.chunks;
+    while(chunk) {
+        struct ScriptChunk *next = chunk->next;
+        free(chunk);
+        chunk = next;
+    }
+    memset(&SCRIPT_POOL, 0, sizeof(SCRIPT_POOL));
+}
+
+ScriptHandle StartScript(Script script) {
+    ScriptHandle result = {};
+    if(!script.handle) {
+        TraceLog(LOG_WARNING, "SCRIPTS: Failed to allocate script");
+        return result;
+    }
+    if(!SCRIPTS.free_count) {
+        TraceLog(LOG_WARNING, "SCRIPTS: Failed to start script, %d scripts are running",
+            SCRIPTS.capacity);
+        return result;
+    }
+
+    uint32_t slot = SCRIPTS.free[--SCRIPTS.free_count];
+    result.id = ((uint32_t)SCRIPTS.generations[slot] << SCRIPT_INDEX_BITS) | (slot + 1);
+
+    struct ScriptState *state = SCRIPTS.states + SCRIPTS.count;
+    state->handle    = script.handle;
+    state->wait      = {};
+    state->wait.kind = SCRIPT_WAIT_FRAME;
+    state->id        = result.id;
+    SCRIPTS.dense[slot] = (uint32_t)SCRIPTS.count;
+    SCRIPTS.count++;
+
+    script.handle = nullptr;
+    state->handle.promise().slot = slot;
+
+    state->handle.resume();
+    if(state->handle.done()) {
+        state->wait.kind = SCRIPT_WAIT_DONE;
+    }
+    return result;
+}
+void StopScript(ScriptHandle script) {
+    struct ScriptState *state = ScriptStateOf(script);
+    if(state) {
+        state->wait.kind = SCRIPT_WAIT_DONE;
+    }
+}
+bool IsScriptRunning(ScriptHandle script) {
+    struct ScriptState *state = ScriptStateOf(script);
+    return state && state->wait.kind != SCRIPT_WAIT_DONE;
+}
+int GetScriptCount(void) {
+    return SCRIPTS.count;
+}
+
+void RunScripts(float dt) {
+    int resumed = 0;
+
+    // NOTE(alicia): scripts started during the loop already ran until their first co_await
+    int count = SCRIPTS.count;
+    for(int i = 0; i < count; ++i) {
+        struct ScriptState *state = SCRIPTS.states + i;
+        switch(state->wait.kind) {
+            case SCRIPT_WAIT_FRAME:
+                break;
+            case SCRIPT_WAIT_SECONDS:
+                state->wait.seconds -= dt;
+                if(state->wait.seconds > 0.0f) {
+                    continue;
+                }
+                break;
+            case SCRIPT_WAIT_ASSET:
+            case SCRIPT_WAIT_SCRIPT:
+                if(!IsScriptWaitDone(&state->wait)) {
+                    continue;
+                }
+                break;
+            case SCRIPT_WAIT_DONE:
+                continue;
+        }
+
+        // NOTE(alicia): awaiting anything other than our awaiters resumes next frame
+        state->wait.kind = SCRIPT_WAIT_FRAME;
+        state->handle.resume();
+        resumed++;
+
+        if(state->handle.done()) {
+            state->wait.kind = SCRIPT_WAIT_DONE;
+        }
+    }
+
+    CompactScripts();
+
+    SCRIPTS.stats.running = SCRIPTS.count;
+    SCRIPTS.stats.resumed = resumed;
+    SCRIPTS.stats.pool    = SCRIPT_POOL.bytes;
+}
+ScriptStats GetScriptStats(void) {
+    return SCRIPTS.stats;
+}
+
+bool IsScriptWaitDone(const ScriptWait *wait) {
+    switch(wait->kind) {
+        case SCRIPT_WAIT_FRAME:
+            return false;
+        case SCRIPT_WAIT_SECONDS:
+            return wait->seconds <= 0.0f;
+        case SCRIPT_WAIT_ASSET: {
+            AssetHandle asset = { wait->id };
+            enum AssetState state = GetAssetState(asset);
+            return state != ASSET_STATE_LOADING && state != ASSET_STATE_DECODED;
+        }
+        case SCRIPT_WAIT_SCRIPT: {
+            ScriptHandle script = { wait->id };
+            return !IsScriptRunning(script);
+        }
+        case SCRIPT_WAIT_DONE:
+            return true;
+    }
+    return true;
+}
+void SetScriptWait(uint32_t slot, const ScriptWait *wait) {
+    struct ScriptState *state = SCRIPTS.states + SCRIPTS.dense[slot];
+    // NOTE(alicia): stopped while running, stays stopped
+    if(state->wait.kind != SCRIPT_WAIT_DONE) {
+        state->wait = *wait;
+    }
+}
+
+ScriptAwaiter NextFrame(void) {
+    ScriptAwaiter result = {};
+    result.wait.kind = SCRIPT_WAIT_FRAME;
+    return result;
+}
+ScriptAwaiter Seconds(float seconds) {
+    ScriptAwaiter result = {};
+    result.wait.kind    = SCRIPT_WAIT_SECONDS;
+    result.wait.seconds = seconds;
+    return result;
+}
+ScriptAwaiter AssetReady(AssetHandle asset) {
+    ScriptAwaiter result = {};
+    result.wait.kind = SCRIPT_WAIT_ASSET;
+    result.wait.id   = asset.id;
+    return result;
+}
+ScriptAwaiter ScriptDone(ScriptHandle script) {
+    ScriptAwaiter result = {};
+    result.wait.kind = SCRIPT_WAIT_SCRIPT;
+    result.wait.id   = script.id;
+    return result;
+}
@@ -0,0 +1,146 @@
+/**
+ * @file   src/settings.cpp
+ * @brief  Runtime settings.
+ * @author Alicia D. Amarilla (smushyaa@gmail.com)
+ * @date   October 18, 2026
+*/
+#include "raylib.h"
+#include "settings.h"
+#include "ini-parser.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define SETTINGS_PATH_MAX 512
+
+static Settings SETTINGS = {
+    SETTINGS_WINDOW_WIDTH,
+    SETTINGS_WINDOW_HEIGHT,
+    SETTINGS_FRAMERATE,
+    (size_t)SETTINGS_ASSET_BUDGET,
+    SETTINGS_TASK_BUDGET,
+};
+
+static void LoadSettingsFile(struct IniParserContext *ini, const char *path) {
+    if(!path || !FileExists(path)) {
+        return;
+    }
+    if(ini_parser_deserialize_file_path(ini, path)) {
+        TraceLog(LOG_INFO, "SETTINGS: Loaded %s", path);
+    } else {
+        TraceLog(LOG_WARNING, "SETTINGS: Failed to read %s", path);
+    }
+}
+
+void LoadSettings(void) {
+    struct IniParserContext ini;
+    memset(&ini, 0, sizeof(ini));
+    ini_parser_begin(&ini);
+
+    // NOTE(alicia): same fields as settings_write in cb.c
+    ini_parser_begin_section(&ini, "window"); {
+        ini_parser_begin_field(&ini, "width"); {
+            ini_parser_value(&ini, "%d", SETTINGS_WINDOW_WIDTH);
+            ini_parser_end_field(&ini);
+        }
+        ini_parser_begin_field(&ini, "height"); {
+            ini_parser_value(&ini, "%d", SETTINGS_WINDOW_HEIGHT);
+            ini_parser_end_field(&ini);
+        }
+        ini_parser_begin_field(&ini, "framerate"); {
+            ini_parser_value(&ini, "%d", SETTINGS_FRAMERATE);
+            ini_parser_end_field(&ini);
+        }
+        ini_parser_end_section(&ini);
+    }
+    ini_parser_begin_section(&ini, "assets"); {
+        ini_parser_begin_field(&ini, "budget"); {
+            ini_parser_value(&ini, "%zu", (size_t)SETTINGS_ASSET_BUDGET);
+            ini_parser_end_field(&ini);
+        }
+        ini_parser_end_section(&ini);
+    }
+    ini_parser_begin_section(&ini, "tasks"); {
+        ini_parser_begin_field(&ini, "budget"); {
+            ini_parser_value(&ini, "%d", SETTINGS_TASK_BUDGET);
+            ini_parser_end_field(&ini);
+        }
+        ini_parser_end_section(&ini);
+    }
+
+#if PLATFORM != PLATFORM_WASM
+    // NOTE(alicia): later files override earlier ones
+    char path[SETTINGS_PATH_MAX];
+    snprintf(path, sizeof(path), "%ssettings.ini", GetApplicationDirectory());
+    LoadSettingsFile(&ini, path);
+    LoadSettingsFile(&ini, GetUserSettingsPath());
+#endif
+
+    ini_parser_begin_section(&ini, "window");
+    SETTINGS.window_width  = (int)ini_parser_read_integer(&ini, "width");
+    SETTINGS.window_height = (int)ini_parser_read_integer(&ini, "height");
+    SETTINGS.framerate     = (int)ini_parser_read_integer(&ini, "framerate");
+    ini_parser_end_section(&ini);
+
+    ini_parser_begin_section(&ini, "assets");
+    long long budget = ini_parser_read_integer(&ini, "budget");
+    ini_parser_end_section(&ini);
+
+    ini_parser_begin_section(&ini, "tasks");
+    SETTINGS.task_budget = (int)ini_parser_read_integer(&ini, "budget");
+    ini_parser_end_section(&ini);
+
+    ini_parser_end(&ini);
+
+    if(SETTINGS.window_width < 100) {
+        SETTINGS.window_width = 100;
+    }
+    if(SETTINGS.window_height < 100) {
+        SETTINGS.window_height = 100;
+    }
+    if(SETTINGS.framerate < 20) {
+        SETTINGS.framerate = 20;
+    }
+    SETTINGS.asset_budget = budget > 0 ? (size_t)budget : 0;
+    if(SETTINGS.task_budget < 0) {
+        SETTINGS.task_budget = 0;
+    }
+}
+const Settings *GetSettings(void) {
+    return &SETTINGS;
+}
+
+const char *GetUserSettingsPath(void) {
+    static char path[SETTINGS_PATH_MAX];
+
+#if PLATFORM == PLATFORM_LINUX
+    const char *config = getenv("XDG_CONFIG_HOME");
+    const char *home   = getenv("HOME");
+    if(config && *config) {
+        snprintf(path, sizeof(path), "%s/%s/settings.ini", config, PROJECT_NAME);
+    } else if(home && *home) {
+        snprintf(path, sizeof(path), "%s/.config/%s/settings.ini", home, PROJECT_NAME);
+    } else {
+        return NULL;
+    }
+#elif PLATFORM == PLATFORM_WINDOWS
+    const char *appdata = getenv("APPDATA");
+    if(!appdata || !*appdata) {
+        return NULL;
+    }
+    snprintf(path, sizeof(path), "%s\\%s\\settings.ini", appdata, PROJECT_NAME);
+#elif PLATFORM == PLATFORM_MACOS
+    const char *home = getenv("HOME");
+    if(!home || !*home) {
+        return NULL;
+    }
+    snprintf(path, sizeof(path),
+        "%s/Library/Application Support/%s/settings.ini", home, PROJECT_NAME);
+#else
+    (void)path;
+    return NULL;
+#endif
+
+    return path;
+}
@@ -1,2 +1,19 @@
 /* generated sources */
+#include "../src/asset_groups.cpp"
+#include "../src/assets.cpp"
+#include "../src/batch_math.cpp"
+#include "../src/ecs.cpp"
+#include "../src/flags.cpp"
+#include "../src/hot_reload.cpp"
+#include "../src/input.cpp"
+#include "../src/jobs.cpp"
+#include "../src/log.cpp"
 #include "../src/main.cpp"
+#include "../src/pipeline.cpp"
+#include "../src/profile.cpp"
+#include "../src/render_queue.cpp"
+#include "../src/scene.cpp"
+#include "../src/scripts.cpp"
+#include "../src/settings.cpp"
+#include "../src/spatial.cpp"
+#include "../src/tasks.cpp"
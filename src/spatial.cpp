@@ -0,0 +1,1039 @@
+/**
+ * @file   src/spatial.cpp
+ * @brief  Spatial indices for culling and proximity queries.
+ * @author Alicia D. Amarilla (smushyaa@gmail.com)
+ * @date   October 18, 2026
+*/
+#include "raylib.h"
+#include "raymath.h"
+#include "rlgl.h"
+#include "spatial.h"
+
+#include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define GRID_CELL_CAPACITY 1024
+
+#define TREE_NULL      (-1)
+#define TREE_STACK_MAX 256
+
+struct GridItem {
+    Rectangle bounds;
+    // cell range, inclusive
+    int x0, y0, x1, y1;
+    uint32_t stamp;
+    bool     alive;
+};
+
+struct GridCell {
+    uint64_t key;
+    bool     used;
+    int *items;
+    int  count;
+    int  cap;
+};
+
+struct SpatialGrid {
+    float cell_size;
+    float inv_cell_size;
+
+    struct GridItem *items;
+    int *free;
+    int  free_count;
+    int  item_len;
+    int  item_cap;
+    int  item_count;
+
+    struct GridCell *cells;
+    int cell_cap;
+    int cell_used;
+
+    // NOTE(alicia): items found by a query are stamped
+    // so items in more than one cell are only reported once
+    uint32_t stamp;
+};
+
+struct TreeNode {
+    BoundingBox box;
+    // next free node when free
+    int parent;
+    int left;
+    int right;
+    // 0 for leaves, -1 when free
+    int height;
+};
+
+struct SpatialTree {
+    struct TreeNode *nodes;
+    int cap;
+    int free;
+    int root;
+    int item_count;
+    float margin;
+};
+
+// NOTE(alicia): grid --------------------------------------------------------
+
+static uint64_t CellKey(int x, int y) {
+    return ((uint64_t)(uint32_t)x << 32) | (uint32_t)y;
+}
+static int CellKeyX(uint64_t key) {
+    return (int)(uint32_t)(key >> 32);
+}
+static int CellKeyY(uint64_t key) {
+    return (int)(uint32_t)key;
+}
+static uint32_t HashCellKey(uint64_t key) {
+    key *= 0x9e3779b97f4a7c15ull;
+    return (uint32_t)(key >> 32);
+}
+
+static int CellCoord(const SpatialGrid *grid, float x) {
+    return (int)floorf(x * grid->inv_cell_size);
+}
+static void CellRange(const SpatialGrid *grid, Rectangle rect, int *x0, int *y0, int *x1, int *y1) {
+    *x0 = CellCoord(grid, rect.x);
+    *y0 = CellCoord(grid, rect.y);
+    *x1 = CellCoord(grid, rect.x + rect.width);
+    *y1 = CellCoord(grid, rect.y + rect.height);
+}
+
+static bool GrowCells(SpatialGrid *grid) {
+    int cap = grid->cell_cap * 2;
+    struct GridCell *cells = (struct GridCell *)calloc(cap, sizeof(cells[0]));
+    if(!cells) {
+        return false;
+    }
+
+    for(int i = 0; i < grid->cell_cap; ++i) {
+        struct GridCell *cell = grid->cells + i;
+        if(!cell->used) {
+            continue;
+        }
+        uint32_t at = HashCellKey(cell->key) & (cap - 1);
+        while(cells[at].used) {
+            at = (at + 1) & (cap - 1);
+        }
+        cells[at] = *cell;
+    }
+
+    free(grid->cells);
+    grid->cells    = cells;
+    grid->cell_cap = cap;
+    return true;
+}
+static struct GridCell *FindCell(SpatialGrid *grid, int x, int y, bool create) {
+    if(create && (grid->cell_used + 1) * 4 > grid->cell_cap * 3 && !GrowCells(grid)) {
+        return NULL;
+    }
+
+    uint64_t key = CellKey(x, y);
+    uint32_t at  = HashCellKey(key) & (grid->cell_cap - 1);
+    while(grid->cells[at].used) {
+        if(grid->cells[at].key == key) {
+            return grid->cells + at;
+        }
+        at = (at + 1) & (grid->cell_cap - 1);
+    }
+    if(!create) {
+        return NULL;
+    }
+
+    // NOTE(alicia): cells are never removed, empty ones are kept for reuse
+    struct GridCell *cell = grid->cells + at;
+    memset(cell, 0, sizeof(*cell));
+    cell->key  = key;
+    cell->used = true;
+    grid->cell_used++;
+    return cell;
+}
+
+static void AddToCells(SpatialGrid *grid, int id) {
+    const struct GridItem *item = grid->items + id;
+    for(int y = item->y0; y <= item->y1; ++y) {
+        for(int x = item->x0; x <= item->x1; ++x) {
+            struct GridCell *cell = FindCell(grid, x, y, true);
+            if(!cell) {
+                TraceLog(LOG_WARNING, "SPATIAL: Out of memory, item %d is missing from cells", id);
+                return;
+            }
+            if(cell->count == cell->cap) {
+                int  cap   = cell->cap ? cell->cap * 2 : 8;
+                int *items = (int *)realloc(cell->items, cap * sizeof(items[0]));
+                if(!items) {
+                    TraceLog(LOG_WARNING, "SPATIAL: Out of memory, item %d is missing from cells", id);
+                    return;
+                }
+                cell->items = items;
+                cell->cap   = cap;
+            }
+            cell->items[cell->count++] = id;
+        }
+    }
+}
+static void RemoveFromCells(SpatialGrid *grid, int id) {
+    const struct GridItem *item = grid->items + id;
+    for(int y = item->y0; y <= item->y1; ++y) {
+        for(int x = item->x0; x <= item->x1; ++x) {
+            struct GridCell *cell = FindCell(grid, x, y, false);
+            if(!cell) {
+                continue;
+            }
+            for(int i = 0; i < cell->count; ++i) {
+                if(cell->items[i] == id) {
+                    cell->items[i] = cell->items[--cell->count];
+                    break;
+                }
+            }
+        }
+    }
+}
+
+static bool ValidGridItem(const SpatialGrid *grid, int id) {
+    return id >= 0 && id < grid->item_len && grid->items[id].alive;
+}
+
+static uint32_t NextStamp(SpatialGrid *grid) {
+    if(!++grid->stamp) {
+        for(int i = 0; i < grid->item_len; ++i) {
+            grid->items[i].stamp = 0;
+        }
+        grid->stamp = 1;
+    }
+    return grid->stamp;
+}
+
+static bool RectsOverlap(Rectangle a, Rectangle b) {
+    return
+        a.x <= b.x + b.width  && b.x <= a.x + a.width &&
+        a.y <= b.y + b.height && b.y <= a.y + a.height;
+}
+// slab test of segment from origin to origin + direction * distance
+static bool SegmentHitsRect(Vector2 origin, Vector2 direction, float distance, Rectangle rect) {
+    float tmin = 0.0f;
+    float tmax = distance;
+
+    float o[2]  = { origin.x, origin.y };
+    float d[2]  = { direction.x, direction.y };
+    float lo[2] = { rect.x, rect.y };
+    float hi[2] = { rect.x + rect.width, rect.y + rect.height };
+    for(int axis = 0; axis < 2; ++axis) {
+        if(d[axis] == 0.0f) {
+            if(o[axis] < lo[axis] || o[axis] > hi[axis]) {
+                return false;
+            }
+            continue;
+        }
+        float inv = 1.0f / d[axis];
+        float t0  = (lo[axis] - o[axis]) * inv;
+        float t1  = (hi[axis] - o[axis]) * inv;
+        if(t0 > t1) {
+            float swap = t0;
+            t0 = t1;
+            t1 = swap;
+        }
+        tmin = t0 > tmin ? t0 : tmin;
+        tmax = t1 < tmax ? t1 : tmax;
+        if(tmin > tmax) {
+            return false;
+        }
+    }
+    return true;
+}
+
+typedef bool GridTestFN(Rectangle bounds, const void *shape);
+
+struct GridQuery {
+    GridTestFN *test;
+    const void *shape;
+    int *out_items;
+    int  max_items;
+    int  found;
+    uint32_t stamp;
+};
+
+static void QueryCell(SpatialGrid *grid, const struct GridCell *cell, struct GridQuery *query) {
+    for(int i = 0; i < cell->count; ++i) {
+        int id = cell->items[i];
+        struct GridItem *item = grid->items + id;
+        if(item->stamp == query->stamp) {
+            continue;
+        }
+        item->stamp = query->stamp;
+
+        if(query->test(item->bounds, query->shape)) {
+            if(query->found < query->max_items) {
+                query->out_items[query->found] = id;
+            }
+            query->found++;
+        }
+    }
+}
+static int QueryCellRange(
+    SpatialGrid *grid, int x0, int y0, int x1, int y1,
+    GridTestFN *test, const void *shape, int *out_items, int max_items
+) {
+    struct GridQuery query;
+    query.test      = test;
+    query.shape     = shape;
+    query.out_items = out_items;
+    query.max_items = max_items;
+    query.found     = 0;
+    query.stamp     = NextStamp(grid);
+
+    // NOTE(alicia): large areas walk the cells that exist instead
+    int64_t area = (int64_t)(x1 - x0 + 1) * (int64_t)(y1 - y0 + 1);
+    if(area > grid->cell_used) {
+        for(int i = 0; i < grid->cell_cap; ++i) {
+            const struct GridCell *cell = grid->cells + i;
+            if(!cell->used || !cell->count) {
+                continue;
+            }
+            int x = CellKeyX(cell->key);
+            int y = CellKeyY(cell->key);
+            if(x >= x0 && x <= x1 && y >= y0 && y <= y1) {
+                QueryCell(grid, cell, &query);
+            }
+        }
+        return query.found;
+    }
+
+    for(int y = y0; y <= y1; ++y) {
+        for(int x = x0; x <= x1; ++x) {
+            const struct GridCell *cell = FindCell(grid, x, y, false);
+            if(cell) {
+                QueryCell(grid, cell, &query);
+            }
+        }
+    }
+    return query.found;
+}
+
+static bool TestRect(Rectangle bounds, const void *shape) {
+    return RectsOverlap(bounds, *(const Rectangle *)shape);
+}
+
+struct Circle {
+    Vector2 center;
+    float   radius;
+};
+static bool TestCircle(Rectangle bounds, const void *shape) {
+    const struct Circle *circle = (const struct Circle *)shape;
+    float x  = Clamp(circle->center.x, bounds.x, bounds.x + bounds.width);
+    float y  = Clamp(circle->center.y, bounds.y, bounds.y + bounds.height);
+    float dx = circle->center.x - x;
+    float dy = circle->center.y - y;
+    return dx * dx + dy * dy <= circle->radius * circle->radius;
+}
+
+struct Segment {
+    Vector2 origin;
+    Vector2 direction;
+    float   distance;
+};
+static bool TestSegment(Rectangle bounds, const void *shape) {
+    const struct Segment *segment = (const struct Segment *)shape;
+    return SegmentHitsRect(segment->origin, segment->direction, segment->distance, bounds);
+}
+
+SpatialGrid *CreateSpatialGrid(float cell_size) {
+    SpatialGrid *grid = (SpatialGrid *)calloc(1, sizeof(SpatialGrid));
+    if(!grid) {
+        return NULL;
+    }
+    grid->cells = (struct GridCell *)calloc(GRID_CELL_CAPACITY, sizeof(grid->cells[0]));
+    if(!grid->cells) {
+        free(grid);
+        return NULL;
+    }
+    grid->cell_cap      = GRID_CELL_CAPACITY;
+    grid->cell_size     = cell_size > 0.0f ? cell_size : 1.0f;
+    grid->inv_cell_size = 1.0f / grid->cell_size;
+    return grid;
+}
+void DestroySpatialGrid(SpatialGrid *grid) {
+    if(!grid) {
+        return;
+    }
+    for(int i = 0; i < grid->cell_cap; ++i) {
+        free(grid->cells[i].items);
+    }
+    free(grid->cells);
+    free(grid->items);
+    free(grid->free);
+    free(grid);
+}
+
+int InsertGridItem(SpatialGrid *grid, Rectangle bounds) {
+    int id;
+    if(grid->free_count) {
+        id = grid->free[--grid->free_count];
+    } else {
+        if(grid->item_len == grid->item_cap) {
+            int cap = grid->item_cap ? grid->item_cap * 2 : 256;
+            struct GridItem *items = (struct GridItem *)realloc(grid->items, cap * sizeof(items[0]));
+            if(!items) {
+                return -1;
+            }
+            grid->items = items;
+
+            int *free_ids = (int *)realloc(grid->free, cap * sizeof(free_ids[0]));
+            if(!free_ids) {
+                return -1;
+            }
+            grid->free     = free_ids;
+            grid->item_cap = cap;
+        }
+        id = grid->item_len++;
+    }
+
+    struct GridItem *item = grid->items + id;
+    item->bounds = bounds;
+    item->stamp  = 0;
+    item->alive  = true;
+    CellRange(grid, bounds, &item->x0, &item->y0, &item->x1, &item->y1);
+    AddToCells(grid, id);
+
+    grid->item_count++;
+    return id;
+}
+void RemoveGridItem(SpatialGrid *grid, int id) {
+    if(!ValidGridItem(grid, id)) {
+        return;
+    }
+    RemoveFromCells(grid, id);
+    grid->items[id].alive = false;
+    grid->free[grid->free_count++] = id;
+    grid->item_count--;
+}
+void MoveGridItem(SpatialGrid *grid, int id, Rectangle bounds) {
+    if(!ValidGridItem(grid, id)) {
+        return;
+    }
+    struct GridItem *item = grid->items + id;
+    item->bounds = bounds;
+
+    int x0, y0, x1, y1;
+    CellRange(grid, bounds, &x0, &y0, &x1, &y1);
+    if(x0 == item->x0 && y0 == item->y0 && x1 == item->x1 && y1 == item->y1) {
+        return;
+    }
+
+    RemoveFromCells(grid, id);
+    item->x0 = x0;
+    item->y0 = y0;
+    item->x1 = x1;
+    item->y1 = y1;
+    AddToCells(grid, id);
+}
+Rectangle GetGridItemBounds(const SpatialGrid *grid, int id) {
+    if(!ValidGridItem(grid, id)) {
+        Rectangle empty = {};
+        return empty;
+    }
+    return grid->items[id].bounds;
+}
+int GetGridItemCount(const SpatialGrid *grid) {
+    return grid->item_count;
+}
+
+int QueryGridRect(SpatialGrid *grid, Rectangle area, int *out_items, int max_items) {
+    int x0, y0, x1, y1;
+    CellRange(grid, area, &x0, &y0, &x1, &y1);
+    return QueryCellRange(grid, x0, y0, x1, y1, TestRect, &area, out_items, max_items);
+}
+int QueryGridCircle(SpatialGrid *grid, Vector2 center, float radius, int *out_items, int max_items) {
+    struct Circle circle;
+    circle.center = center;
+    circle.radius = radius;
+
+    Rectangle area = { center.x - radius, center.y - radius, radius * 2.0f, radius * 2.0f };
+    int x0, y0, x1, y1;
+    CellRange(grid, area, &x0, &y0, &x1, &y1);
+    return QueryCellRange(grid, x0, y0, x1, y1, TestCircle, &circle, out_items, max_items);
+}
+int QueryGridRay(
+    SpatialGrid *grid, Vector2 origin, Vector2 direction, float distance,
+    int *out_items, int max_items
+) {
+    float length = sqrtf(direction.x * direction.x + direction.y * direction.y);
+    if(length == 0.0f || distance < 0.0f) {
+        return 0;
+    }
+
+    struct Segment segment;
+    segment.origin      = origin;
+    segment.direction.x = direction.x / length;
+    segment.direction.y = direction.y / length;
+    segment.distance    = distance;
+
+    struct GridQuery query;
+    query.test      = TestSegment;
+    query.shape     = &segment;
+    query.out_items = out_items;
+    query.max_items = max_items;
+    query.found     = 0;
+    query.stamp     = NextStamp(grid);
+
+    // NOTE(alicia): walk cells along the segment (Amanatides & Woo)
+    Vector2 d = segment.direction;
+    int x  = CellCoord(grid, origin.x);
+    int y  = CellCoord(grid, origin.y);
+    int ex = CellCoord(grid, origin.x + d.x * distance);
+    int ey = CellCoord(grid, origin.y + d.y * distance);
+
+    int step_x = d.x > 0.0f ? 1 : (d.x < 0.0f ? -1 : 0);
+    int step_y = d.y > 0.0f ? 1 : (d.y < 0.0f ? -1 : 0);
+    float cs = grid->cell_size;
+    float t_max_x   = step_x ? ((x + (step_x > 0)) * cs - origin.x) / d.x : INFINITY;
+    float t_max_y   = step_y ? ((y + (step_y > 0)) * cs - origin.y) / d.y : INFINITY;
+    float t_delta_x = step_x ? cs / fabsf(d.x) : INFINITY;
+    float t_delta_y = step_y ? cs / fabsf(d.y) : INFINITY;
+
+    int steps = abs(ex - x) + abs(ey - y) + 1;
+    for(int i = 0; i < steps; ++i) {
+        const struct GridCell *cell = FindCell(grid, x, y, false);
+        if(cell) {
+            QueryCell(grid, cell, &query);
+        }
+        if(x == ex && y == ey) {
+            break;
+        }
+        if(t_max_x < t_max_y) {
+            x       += step_x;
+            t_max_x += t_delta_x;
+        } else {
+            y       += step_y;
+            t_max_y += t_delta_y;
+        }
+    }
+    return query.found;
+}
+void QueryGridPairs(SpatialGrid *grid, GridPairFN *fn, void *user) {
+    for(int c = 0; c < grid->cell_cap; ++c) {
+        const struct GridCell *cell = grid->cells + c;
+        if(!cell->used || cell->count < 2) {
+            continue;
+        }
+        int cx = CellKeyX(cell->key);
+        int cy = CellKeyY(cell->key);
+
+        for(int i = 0; i < cell->count; ++i) {
+            const struct GridItem *a = grid->items + cell->items[i];
+            for(int j = i + 1; j < cell->count; ++j) {
+                const struct GridItem *b = grid->items + cell->items[j];
+
+                // NOTE(alicia): pairs sharing several cells are only
+                // reported by the first cell they share
+                int x = a->x0 > b->x0 ? a->x0 : b->x0;
+                int y = a->y0 > b->y0 ? a->y0 : b->y0;
+                if(x != cx || y != cy) {
+                    continue;
+                }
+                if(RectsOverlap(a->bounds, b->bounds)) {
+                    fn(cell->items[i], cell->items[j], user);
+                }
+            }
+        }
+    }
+}
+
+// NOTE(alicia): tree --------------------------------------------------------
+
+static BoundingBox BoxUnion(BoundingBox a, BoundingBox b) {
+    BoundingBox result;
+    result.min = Vector3Min(a.min, b.min);
+    result.max = Vector3Max(a.max, b.max);
+    return result;
+}
+static float BoxArea(BoundingBox box) {
+    float x = box.max.x - box.min.x;
+    float y = box.max.y - box.min.y;
+    float z = box.max.z - box.min.z;
+    return 2.0f * (x * y + y * z + z * x);
+}
+static bool BoxContains(BoundingBox outer, BoundingBox inner) {
+    return
+        outer.min.x <= inner.min.x && outer.min.y <= inner.min.y && outer.min.z <= inner.min.z &&
+        outer.max.x >= inner.max.x && outer.max.y >= inner.max.y && outer.max.z >= inner.max.z;
+}
+static bool BoxesOverlap(BoundingBox a, BoundingBox b) {
+    return
+        a.min.x <= b.max.x && b.min.x <= a.max.x &&
+        a.min.y <= b.max.y && b.min.y <= a.max.y &&
+        a.min.z <= b.max.z && b.min.z <= a.max.z;
+}
+
+static bool IsLeaf(const struct TreeNode *node) {
+    return node->left == TREE_NULL;
+}
+static int MaxInt(int a, int b) {
+    return a > b ? a : b;
+}
+
+static int AllocNode(SpatialTree *tree) {
+    if(tree->free == TREE_NULL) {
+        int cap = tree->cap ? tree->cap * 2 : 256;
+        struct TreeNode *nodes = (struct TreeNode *)realloc(tree->nodes, cap * sizeof(nodes[0]));
+        if(!nodes) {
+            return TREE_NULL;
+        }
+        for(int i = tree->cap; i < cap; ++i) {
+            nodes[i].parent = i + 1 < cap ? i + 1 : TREE_NULL;
+            nodes[i].height = -1;
+        }
+        tree->nodes = nodes;
+        tree->free  = tree->cap;
+        tree->cap   = cap;
+    }
+
+    int index = tree->free;
+    struct TreeNode *node = tree->nodes + index;
+    tree->free   = node->parent;
+    node->parent = TREE_NULL;
+    node->left   = TREE_NULL;
+    node->right  = TREE_NULL;
+    node->height = 0;
+    return index;
+}
+static void FreeNode(SpatialTree *tree, int index) {
+    tree->nodes[index].parent = tree->free;
+    tree->nodes[index].height = -1;
+    tree->free = index;
+}
+
+static void ReplaceChild(SpatialTree *tree, int parent, int old_child, int new_child) {
+    if(parent == TREE_NULL) {
+        tree->root = new_child;
+    } else if(tree->nodes[parent].left == old_child) {
+        tree->nodes[parent].left = new_child;
+    } else {
+        tree->nodes[parent].right = new_child;
+    }
+}
+
+// rotate a taller grandchild up, returns new root of subtree
+static int Balance(SpatialTree *tree, int ia) {
+    struct TreeNode *nodes = tree->nodes;
+    struct TreeNode *a = nodes + ia;
+    if(IsLeaf(a) || a->height < 2) {
+        return ia;
+    }
+
+    int ib = a->left;
+    int ic = a->right;
+    struct TreeNode *b = nodes + ib;
+    struct TreeNode *c = nodes + ic;
+    int balance = c->height - b->height;
+
+    if(balance > 1) {
+        int if_ = c->left;
+        int ig  = c->right;
+        struct TreeNode *f = nodes + if_;
+        struct TreeNode *g = nodes + ig;
+
+        c->left   = ia;
+        c->parent = a->parent;
+        a->parent = ic;
+        ReplaceChild(tree, c->parent, ia, ic);
+
+        if(f->height > g->height) {
+            c->right  = if_;
+            a->right  = ig;
+            g->parent = ia;
+            a->box    = BoxUnion(b->box, g->box);
+            c->box    = BoxUnion(a->box, f->box);
+            a->height = 1 + MaxInt(b->height, g->height);
+            c->height = 1 + MaxInt(a->height, f->height);
+        } else {
+            c->right  = ig;
+            a->right  = if_;
+            f->parent = ia;
+            a->box    = BoxUnion(b->box, f->box);
+            c->box    = BoxUnion(a->box, g->box);
+            a->height = 1 + MaxInt(b->height, f->height);
+            c->height = 1 + MaxInt(a->height, g->height);
+        }
+        return ic;
+    }
+
+    if(balance < -1) {
+        int id = b->left;
+        int ie = b->right;
+        struct TreeNode *d = nodes + id;
+        struct TreeNode *e = nodes + ie;
+
+        b->left   = ia;
+        b->parent = a->parent;
+        a->parent = ib;
+        ReplaceChild(tree, b->parent, ia, ib);
+
+        if(d->height > e->height) {
+            b->right  = id;
+            a->left   = ie;
+            e->parent = ia;
+            a->box    = BoxUnion(c->box, e->box);
+            b->box    = BoxUnion(a->box, d->box);
+            a->height = 1 + MaxInt(c->height, e->height);
+            b->height = 1 + MaxInt(a->height, d->height);
+        } else {
+            b->right  = ie;
+            a->left   = id;
+            d->parent = ia;
+            a->box    = BoxUnion(c->box, d->box);
+            b->box    = BoxUnion(a->box, e->box);
+            a->height = 1 + MaxInt(c->height, d->height);
+            b->height = 1 + MaxInt(a->height, e->height);
+        }
+        return ib;
+    }
+
+    return ia;
+}
+// rebalance and refit boxes from index to root
+static void Refit(SpatialTree *tree, int index) {
+    while(index != TREE_NULL) {
+        index = Balance(tree, index);
+
+        struct TreeNode *node = tree->nodes + index;
+        const struct TreeNode *left  = tree->nodes + node->left;
+        const struct TreeNode *right = tree->nodes + node->right;
+        node->height = 1 + MaxInt(left->height, right->height);
+        node->box    = BoxUnion(left->box, right->box);
+
+        index = node->parent;
+    }
+}
+
+static bool InsertLeaf(SpatialTree *tree, int leaf) {
+    if(tree->root == TREE_NULL) {
+        tree->root = leaf;
+        tree->nodes[leaf].parent = TREE_NULL;
+        return true;
+    }
+
+    // NOTE(alicia): descend toward the sibling that grows surface area least
+    BoundingBox box = tree->nodes[leaf].box;
+    int index = tree->root;
+    while(!IsLeaf(tree->nodes + index)) {
+        const struct TreeNode *node = tree->nodes + index;
+
+        float area     = BoxArea(node->box);
+        float combined = BoxArea(BoxUnion(node->box, box));
+        float cost     = 2.0f * combined;
+        float inherit  = 2.0f * (combined - area);
+
+        float costs[2];
+        int children[2] = { node->left, node->right };
+        for(int i = 0; i < 2; ++i) {
+            const struct TreeNode *child = tree->nodes + children[i];
+            float grown = BoxArea(BoxUnion(box, child->box));
+            costs[i] = IsLeaf(child) ? grown + inherit : grown - BoxArea(child->box) + inherit;
+        }
+
+        if(cost < costs[0] && cost < costs[1]) {
+            break;
+        }
+        index = costs[0] < costs[1] ? children[0] : children[1];
+    }
+
+    int sibling = index;
+    int parent  = AllocNode(tree);
+    if(parent == TREE_NULL) {
+        return false;
+    }
+
+    // NOTE(alicia): nodes may have moved when allocating
+    struct TreeNode *nodes = tree->nodes;
+    int old_parent = nodes[sibling].parent;
+    nodes[parent].parent = old_parent;
+    nodes[parent].box    = BoxUnion(box, nodes[sibling].box);
+    nodes[parent].height = nodes[sibling].height + 1;
+    nodes[parent].left   = sibling;
+    nodes[parent].right  = leaf;
+    ReplaceChild(tree, old_parent, sibling, parent);
+    nodes[sibling].parent = parent;
+    nodes[leaf].parent    = parent;
+
+    Refit(tree, parent);
+    return true;
+}
+static void RemoveLeaf(SpatialTree *tree, int leaf) {
+    if(leaf == tree->root) {
+        tree->root = TREE_NULL;
+        return;
+    }
+
+    struct TreeNode *nodes = tree->nodes;
+    int parent       = nodes[leaf].parent;
+    int grand_parent = nodes[parent].parent;
+    int sibling      = nodes[parent].left == leaf ? nodes[parent].right : nodes[parent].left;
+
+    ReplaceChild(tree, grand_parent, parent, sibling);
+    nodes[sibling].parent = grand_parent;
+    FreeNode(tree, parent);
+
+    Refit(tree, grand_parent);
+}
+
+static bool ValidTreeItem(const SpatialTree *tree, int id) {
+    return id >= 0 && id < tree->cap &&
+        tree->nodes[id].height == 0 && IsLeaf(tree->nodes + id);
+}
+
+static BoundingBox Grow(BoundingBox box, float margin) {
+    box.min.x -= margin;
+    box.min.y -= margin;
+    box.min.z -= margin;
+    box.max.x += margin;
+    box.max.y += margin;
+    box.max.z += margin;
+    return box;
+}
+
+typedef bool TreeTestFN(BoundingBox box, const void *shape);
+
+static int QueryTree(
+    SpatialTree *tree, TreeTestFN *test, const void *shape, int *out_items, int max_items
+) {
+    if(tree->root == TREE_NULL) {
+        return 0;
+    }
+
+    int stack[TREE_STACK_MAX];
+    int top   = 0;
+    int found = 0;
+    stack[top++] = tree->root;
+
+    while(top) {
+        int index = stack[--top];
+        const struct TreeNode *node = tree->nodes + index;
+        if(!test(node->box, shape)) {
+            continue;
+        }
+
+        if(IsLeaf(node)) {
+            if(found < max_items) {
+                out_items[found] = index;
+            }
+            found++;
+        } else if(top + 2 <= TREE_STACK_MAX) {
+            stack[top++] = node->left;
+            stack[top++] = node->right;
+        } else {
+            TraceLog(LOG_WARNING, "SPATIAL: Tree is too deep, query is incomplete");
+        }
+    }
+    return found;
+}
+
+static bool TestBox(BoundingBox box, const void *shape) {
+    return BoxesOverlap(box, *(const BoundingBox *)shape);
+}
+
+struct Sphere {
+    Vector3 center;
+    float   radius;
+};
+static bool TestSphere(BoundingBox box, const void *shape) {
+    const struct Sphere *sphere = (const struct Sphere *)shape;
+    Vector3 closest = Vector3Clamp(sphere->center, box.min, box.max);
+    return Vector3DistanceSqr(closest, sphere->center) <= sphere->radius * sphere->radius;
+}
+
+struct RaySegment {
+    Ray   ray;
+    float distance;
+};
+static bool TestRay(BoundingBox box, const void *shape) {
+    const struct RaySegment *segment = (const struct RaySegment *)shape;
+    float tmin = 0.0f;
+    float tmax = segment->distance;
+
+    float o[3]  = { segment->ray.position.x, segment->ray.position.y, segment->ray.position.z };
+    float d[3]  = { segment->ray.direction.x, segment->ray.direction.y, segment->ray.direction.z };
+    float lo[3] = { box.min.x, box.min.y, box.min.z };
+    float hi[3] = { box.max.x, box.max.y, box.max.z };
+    for(int axis = 0; axis < 3; ++axis) {
+        if(d[axis] == 0.0f) {
+            if(o[axis] < lo[axis] || o[axis] > hi[axis]) {
+                return false;
+            }
+            continue;
+        }
+        float inv = 1.0f / d[axis];
+        float t0  = (lo[axis] - o[axis]) * inv;
+        float t1  = (hi[axis] - o[axis]) * inv;
+        if(t0 > t1) {
+            float swap = t0;
+            t0 = t1;
+            t1 = swap;
+        }
+        tmin = t0 > tmin ? t0 : tmin;
+        tmax = t1 < tmax ? t1 : tmax;
+        if(tmin > tmax) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool TestFrustum(BoundingBox box, const void *shape) {
+    const Frustum *frustum = (const Frustum *)shape;
+    for(int i = 0; i < 6; ++i) {
+        Vector4 plane = frustum->planes[i];
+        // NOTE(alicia): corner furthest along the plane normal
+        float x = plane.x >= 0.0f ? box.max.x : box.min.x;
+        float y = plane.y >= 0.0f ? box.max.y : box.min.y;
+        float z = plane.z >= 0.0f ? box.max.z : box.min.z;
+        if(plane.x * x + plane.y * y + plane.z * z + plane.w < 0.0f) {
+            return false;
+        }
+    }
+    return true;
+}
+
+SpatialTree *CreateSpatialTree(float margin) {
+    SpatialTree *tree = (SpatialTree *)calloc(1, sizeof(SpatialTree));
+    if(!tree) {
+        return NULL;
+    }
+    tree->free   = TREE_NULL;
+    tree->root   = TREE_NULL;
+    tree->margin = margin > 0.0f ? margin : 0.0f;
+    return tree;
+}
+void DestroySpatialTree(SpatialTree *tree) {
+    if(!tree) {
+        return;
+    }
+    free(tree->nodes);
+    free(tree);
+}
+
+int InsertTreeItem(SpatialTree *tree, BoundingBox bounds) {
+    int leaf = AllocNode(tree);
+    if(leaf == TREE_NULL) {
+        return -1;
+    }
+    tree->nodes[leaf].box = Grow(bounds, tree->margin);
+    if(!InsertLeaf(tree, leaf)) {
+        FreeNode(tree, leaf);
+        return -1;
+    }
+    tree->item_count++;
+    return leaf;
+}
+void RemoveTreeItem(SpatialTree *tree, int id) {
+    if(!ValidTreeItem(tree, id)) {
+        return;
+    }
+    RemoveLeaf(tree, id);
+    FreeNode(tree, id);
+    tree->item_count--;
+}
+bool MoveTreeItem(SpatialTree *tree, int id, BoundingBox bounds) {
+    if(!ValidTreeItem(tree, id) || BoxContains(tree->nodes[id].box, bounds)) {
+        return false;
+    }
+
+    RemoveLeaf(tree, id);
+    tree->nodes[id].box = Grow(bounds, tree->margin);
+    if(!InsertLeaf(tree, id)) {
+        // NOTE(alicia): out of memory for a parent node, item is dropped
+        TraceLog(LOG_WARNING, "SPATIAL: Out of memory, item %d was removed", id);
+        FreeNode(tree, id);
+        tree->item_count--;
+    }
+    return true;
+}
+BoundingBox GetTreeItemBounds(const SpatialTree *tree, int id) {
+    if(!ValidTreeItem(tree, id)) {
+        BoundingBox empty = {};
+        return empty;
+    }
+    return tree->nodes[id].box;
+}
+int GetTreeItemCount(const SpatialTree *tree) {
+    return tree->item_count;
+}
+
+int QueryTreeBox(SpatialTree *tree, BoundingBox area, int *out_items, int max_items) {
+    return QueryTree(tree, TestBox, &area, out_items, max_items);
+}
+int QueryTreeSphere(SpatialTree *tree, Vector3 center, float radius, int *out_items, int max_items) {
+    struct Sphere sphere;
+    sphere.center = center;
+    sphere.radius = radius;
+    return QueryTree(tree, TestSphere, &sphere, out_items, max_items);
+}
+int QueryTreeRay(SpatialTree *tree, Ray ray, float distance, int *out_items, int max_items) {
+    struct RaySegment segment;
+    segment.ray      = ray;
+    segment.distance = distance;
+    return QueryTree(tree, TestRay, &segment, out_items, max_items);
+}
+int QueryTreeFrustum(SpatialTree *tree, const Frustum *frustum, int *out_items, int max_items) {
+    return QueryTree(tree, TestFrustum, frustum, out_items, max_items);
+}
+
+// NOTE(alicia): cameras -----------------------------------------------------
+
+Rectangle GetCameraView2D(Camera2D camera, int width, int height) {
+    Vector2 corners[4] = {
+        GetScreenToWorld2D({ 0.0f, 0.0f }, camera),
+        GetScreenToWorld2D({ (float)width, 0.0f }, camera),
+        GetScreenToWorld2D({ 0.0f, (float)height }, camera),
+        GetScreenToWorld2D({ (float)width, (float)height }, camera),
+    };
+
+    Vector2 min = corners[0];
+    Vector2 max = corners[0];
+    for(int i = 1; i < 4; ++i) {
+        min = Vector2Min(min, corners[i]);
+        max = Vector2Max(max, corners[i]);
+    }
+
+    Rectangle view = { min.x, min.y, max.x - min.x, max.y - min.y };
+    return view;
+}
+Frustum GetCameraFrustum(Camera3D camera, float aspect) {
+    double near_plane = rlGetCullDistanceNear();
+    double far_plane  = rlGetCullDistanceFar();
+
+    Matrix projection;
+    if(camera.projection == CAMERA_PERSPECTIVE) {
+        projection = MatrixPerspective(camera.fovy * DEG2RAD, aspect, near_plane, far_plane);
+    } else {
+        double top   = camera.fovy / 2.0;
+        double right = top * aspect;
+        projection = MatrixOrtho(-right, right, -top, top, near_plane, far_plane);
+    }
+    Matrix view = MatrixLookAt(camera.position, camera.target, camera.up);
+    Matrix m    = MatrixMultiply(view, projection);
+
+    // NOTE(alicia): planes from rows of the clip matrix (Gribb & Hartmann)
+    Vector4 row0 = { m.m0, m.m4, m.m8,  m.m12 };
+    Vector4 row1 = { m.m1, m.m5, m.m9,  m.m13 };
+    Vector4 row2 = { m.m2, m.m6, m.m10, m.m14 };
+    Vector4 row3 = { m.m3, m.m7, m.m11, m.m15 };
+
+    Frustum frustum;
+    frustum.planes[0] = Vector4Add(row3, row0);      // left
+    frustum.planes[1] = Vector4Subtract(row3, row0); // right
+    frustum.planes[2] = Vector4Add(row3, row1);      // bottom
+    frustum.planes[3] = Vector4Subtract(row3, row1); // top
+    frustum.planes[4] = Vector4Add(row3, row2);      // near
+    frustum.planes[5] = Vector4Subtract(row3, row2); // far
+
+    for(int i = 0; i < 6; ++i) {
+        Vector4 *plane = frustum.planes + i;
+        float length = sqrtf(plane->x * plane->x + plane->y * plane->y + plane->z * plane->z);
+        if(length > 0.0f) {
+            *plane = Vector4Scale(*plane, 1.0f / length);
+        }
+    }
+    return frustum;
+}
@@ -0,0 +1,231 @@
+/**
+ * @file   src/tasks.cpp
+ * @brief  Long running work spread across frames.
+ * @author Alicia D. Amarilla (smushyaa@gmail.com)
+ * @date   October 18, 2026
+*/
+#include "raylib.h"
+#include "tasks.h"
+
+#include <string.h>
+
+// NOTE(alicia): same layout as asset handles,
+// index + 1 in the low bits and generation in the high bits.
+#define TASK_INDEX_BITS 16
+#define TASK_INDEX_MASK ((1u << TASK_INDEX_BITS) - 1)
+
+static_assert(TASK_CAPACITY < TASK_INDEX_MASK, "task capacity does not fit in handle!");
+
+static const char *TASK_PRIORITY_NAMES[] = {
+    "low",
+    "normal",
+    "high",
+};
+static_assert(
+    sizeof(TASK_PRIORITY_NAMES) / sizeof(TASK_PRIORITY_NAMES[0]) == TASK_PRIORITY_COUNT,
+    "task priority names out of date!");
+
+struct TaskSlot {
+    const char  *name;
+    TaskFN      *fn;
+    void        *user;
+    TaskPriority priority;
+    // GetTime() seconds, 0 for none
+    double       deadline;
+    uint64_t     order;
+    uint16_t     generation;
+    bool         used;
+};
+
+static struct {
+    struct TaskSlot slots[TASK_CAPACITY];
+    int      count;
+    uint64_t next_order;
+
+    double    budget_ms;
+    double    frame_ms;
+    TaskStats stats;
+} TASKS;
+
+static int TaskIndex(Task task) {
+    uint32_t index = task.id & TASK_INDEX_MASK;
+    if(!index || index > TASK_CAPACITY) {
+        return -1;
+    }
+    index--;
+    struct TaskSlot *slot = TASKS.slots + index;
+    if(!slot->used || slot->generation != (task.id >> TASK_INDEX_BITS)) {
+        return -1;
+    }
+    return (int)index;
+}
+
+static void FreeTask(int index) {
+    struct TaskSlot *slot = TASKS.slots + index;
+    slot->used = false;
+    slot->generation++;
+    if(!slot->generation) {
+        slot->generation = 1;
+    }
+    TASKS.count--;
+}
+
+// true if a should run before b
+static bool TaskBefore(const struct TaskSlot *a, const struct TaskSlot *b, double now) {
+    bool a_late = a->deadline && a->deadline <= now;
+    bool b_late = b->deadline && b->deadline <= now;
+    if(a_late != b_late) {
+        return a_late;
+    }
+    if(a->priority != b->priority) {
+        return a->priority > b->priority;
+    }
+    if(a->deadline != b->deadline) {
+        // NOTE(alicia): tasks without a deadline go last
+        if(!a->deadline || !b->deadline) {
+            return a->deadline != 0;
+        }
+        return a->deadline < b->deadline;
+    }
+    return a->order < b->order;
+}
+
+static int NextTask(double now) {
+    int best = -1;
+    for(int i = 0; i < TASK_CAPACITY; ++i) {
+        struct TaskSlot *slot = TASKS.slots + i;
+        if(slot->used && (best < 0 || TaskBefore(slot, TASKS.slots + best, now))) {
+            best = i;
+        }
+    }
+    return best;
+}
+
+void InitTasks(double budget_ms, int target_fps) {
+    memset(&TASKS, 0, sizeof(TASKS));
+    for(int i = 0; i < TASK_CAPACITY; ++i) {
+        TASKS.slots[i].generation = 1;
+    }
+    TASKS.budget_ms = budget_ms > 0.0 ? budget_ms : 0.0;
+    TASKS.frame_ms  = target_fps > 0 ? 1000.0 / target_fps : 0.0;
+
+    TraceLog(LOG_INFO, "TASKS: %.1fms per frame", TASKS.budget_ms);
+}
+void ShutdownTasks(void) {
+    for(int i = 0; i < TASK_CAPACITY; ++i) {
+        struct TaskSlot *slot = TASKS.slots + i;
+        if(slot->used) {
+            TraceLog(LOG_DEBUG, "TASKS: Cancelled %s", slot->name);
+            slot->fn(slot->user, 0.0);
+            FreeTask(i);
+        }
+    }
+}
+
+Task StartTask(const char *name, TaskFN *fn, void *user, TaskPriority priority, double deadline) {
+    Task task = {};
+    if(!fn) {
+        return task;
+    }
+
+    int index = -1;
+    for(int i = 0; i < TASK_CAPACITY; ++i) {
+        if(!TASKS.slots[i].used) {
+            index = i;
+            break;
+        }
+    }
+    if(index < 0) {
+        TraceLog(LOG_WARNING, "TASKS: Failed to start %s, %d tasks are running",
+            name ? name : "task", TASK_CAPACITY);
+        return task;
+    }
+
+    if((int)priority < 0 || priority >= TASK_PRIORITY_COUNT) {
+        priority = TASK_PRIORITY_NORMAL;
+    }
+
+    struct TaskSlot *slot = TASKS.slots + index;
+    slot->name     = name ? name : "task";
+    slot->fn       = fn;
+    slot->user     = user;
+    slot->priority = priority;
+    slot->deadline = deadline > 0.0 ? GetTime() + deadline : 0.0;
+    slot->order    = TASKS.next_order++;
+    slot->used     = true;
+    TASKS.count++;
+
+    task.id = ((uint32_t)slot->generation << TASK_INDEX_BITS) | (uint32_t)(index + 1);
+    return task;
+}
+void CancelTask(Task task) {
+    int index = TaskIndex(task);
+    if(index < 0) {
+        return;
+    }
+    struct TaskSlot *slot = TASKS.slots + index;
+    slot->fn(slot->user, 0.0);
+    FreeTask(index);
+}
+bool IsTaskRunning(Task task) {
+    return TaskIndex(task) >= 0;
+}
+int GetTaskCount(void) {
+    return TASKS.count;
+}
+
+void RunTasks(double frame_start) {
+    TaskStats stats = {};
+
+    double start = GetTime();
+    double end   = start + TASKS.budget_ms / 1000.0;
+    if(TASKS.frame_ms > 0.0) {
+        // NOTE(alicia): yield early when the frame is about to miss its target
+        double frame_end = frame_start + (TASKS.frame_ms - TASK_FRAME_RESERVE_MS) / 1000.0;
+        if(frame_end < end) {
+            end = frame_end;
+        }
+        // NOTE(alicia): frames under sustained load are already past their target,
+        // late tasks would never run and only pile up
+        double slice = TASKS.budget_ms < TASK_MIN_SLICE_MS ? TASKS.budget_ms : TASK_MIN_SLICE_MS;
+        if(end < start + slice / 1000.0) {
+            end = start + slice / 1000.0;
+        }
+    }
+
+    double now = start;
+    while(TASKS.count && now < end) {
+        int index = NextTask(now);
+        struct TaskSlot *slot = TASKS.slots + index;
+
+        bool done = slot->fn(slot->user, (end - now) * 1000.0);
+        stats.calls++;
+        now = GetTime();
+
+        if(done) {
+            TraceLog(LOG_DEBUG, "TASKS: Finished %s", slot->name);
+            FreeTask(index);
+            stats.finished++;
+        }
+    }
+
+    for(int i = 0; i < TASK_CAPACITY; ++i) {
+        struct TaskSlot *slot = TASKS.slots + i;
+        if(slot->used && slot->deadline && slot->deadline <= now) {
+            stats.late++;
+        }
+    }
+    stats.pending = TASKS.count;
+    stats.ms      = (now - start) * 1000.0;
+    TASKS.stats   = stats;
+}
+TaskStats GetTaskStats(void) {
+    return TASKS.stats;
+}
+
+const char *GetTaskPriorityName(TaskPriority priority) {
+    if((int)priority < 0 || priority >= TASK_PRIORITY_COUNT) {
+        return "unknown";
+    }
+    return TASK_PRIORITY_NAMES[priority];
+}